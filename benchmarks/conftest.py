@@ -1,5 +1,7 @@
+import numpy as np
 import pytest
 
+from pyvrp import Client, Depot, Location, ProblemData, VehicleType
 from tests.helpers import read, read_solution
 
 
@@ -36,3 +38,69 @@ def gtsp():
 @pytest.fixture(scope="session")
 def pdptw():
     return read("data/lrc206.vrp", round_func="exact")
+
+
+# Synthetic instance sizes used to catch scaling regressions. We do not go much
+# beyond a few thousand clients here, since the dense distance and duration
+# matrices of larger instances do not fit comfortably in CI memory.
+SYNTHETIC_SIZES = [100, 1_000, 5_000]
+
+
+# Number of distance matrix rows to compute at a time in make_synthetic().
+_BLOCK_SIZE = 256
+
+
+def make_synthetic(num_clients: int, seed: int = 42) -> ProblemData:
+    """
+    Generates a random VRPTW instance with the given number of clients. The
+    clients are uniformly distributed around a single, central depot.
+    """
+    rng = np.random.default_rng(seed)
+    coords = rng.integers(0, 10_000, size=(num_clients + 1, 2))
+    coords[0] = [5_000, 5_000]  # depot in the center of the grid
+
+    # Computes the distances one block of rows at a time. A dense difference
+    # array of all pairs would take several times the memory of the distance
+    # matrix itself for the larger instances.
+    dist = np.empty((num_clients + 1, num_clients + 1), dtype=np.int64)
+    for start in range(0, num_clients + 1, _BLOCK_SIZE):
+        rows = slice(start, start + _BLOCK_SIZE)
+        diff = coords[rows, np.newaxis, :] - coords
+        dist[rows] = np.rint(np.hypot(diff[..., 0], diff[..., 1]))
+
+    horizon = 50_000
+    starts = rng.integers(0, horizon - 5_000, size=num_clients)
+    widths = rng.integers(500, 5_000, size=num_clients)
+    demands = rng.integers(1, 10, size=num_clients)
+
+    clients = [
+        Client(
+            location=idx + 1,
+            delivery=[int(demands[idx])],
+            service_duration=10,
+            tw_early=int(starts[idx]),
+            tw_late=int(starts[idx] + widths[idx]),
+        )
+        for idx in range(num_clients)
+    ]
+
+    num_vehicles = max(num_clients // 10, 1)
+    return ProblemData(
+        locations=[Location(x=int(x), y=int(y)) for x, y in coords],
+        clients=clients,
+        depots=[Depot(location=0, tw_late=horizon)],
+        vehicle_types=[
+            VehicleType(num_vehicles, capacity=[100], tw_late=horizon)
+        ],
+        distance_matrices=[dist],
+        duration_matrices=[dist],
+    )
+
+
+@pytest.fixture(
+    scope="session",
+    params=SYNTHETIC_SIZES,
+    ids=[f"n{size}" for size in SYNTHETIC_SIZES],
+)
+def synthetic(request):
+    return make_synthetic(request.param)
@@ -0,0 +1,17 @@
+import pytest
+
+from tests.helpers import make_search_route
+
+
+@pytest.mark.parametrize("num_clients", [10, 100, 1_000])
+def test_update(num_clients, benchmark, synthetic):
+    """
+    Tests how the cost of updating a route's cached statistics scales with
+    the length of the route.
+    """
+    if num_clients > synthetic.num_clients:
+        pytest.skip("Instance does not have enough clients.")
+
+    clients = [f"C{idx}" for idx in range(num_clients)]
+    route = make_search_route(synthetic, clients)
+    benchmark(route.update)
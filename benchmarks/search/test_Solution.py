@@ -0,0 +1,28 @@
+from pyvrp import RandomNumberGenerator
+from pyvrp import Solution as PyVRPSolution
+from pyvrp.search._search import Solution
+
+
+def test_load(synthetic, benchmark):
+    """
+    Tests how loading a solution into the search representation scales with
+    instance size.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    sol = PyVRPSolution.make_random(synthetic, rng)
+
+    search_sol = Solution(synthetic)
+    benchmark(search_sol.load, sol)
+
+
+def test_unload(synthetic, benchmark):
+    """
+    Tests how unloading the search representation back into a solution scales
+    with instance size.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    sol = PyVRPSolution.make_random(synthetic, rng)
+
+    search_sol = Solution(synthetic)
+    search_sol.load(sol)
+    benchmark(search_sol.unload)
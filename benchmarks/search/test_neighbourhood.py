@@ -0,0 +1,31 @@
+import pytest
+
+from pyvrp.search import NeighbourhoodParams, compute_neighbours
+
+
+@pytest.mark.parametrize(
+    "instance", ["vrptw", "mdvrp", "vrpb", "mtvrptwr", "gtsp", "pdptw"]
+)
+def test_compute_neighbours(instance, benchmark, request):
+    """
+    Tests performance of computing the granular neighbourhood on a few
+    instances.
+    """
+    data = request.getfixturevalue(instance)
+    benchmark(compute_neighbours, data)
+
+
+def test_compute_neighbours_synthetic(synthetic, benchmark):
+    """
+    Tests how computing the granular neighbourhood scales with instance size.
+    """
+    benchmark(compute_neighbours, synthetic)
+
+
+def test_compute_neighbours_spatial_synthetic(synthetic, benchmark):
+    """
+    Tests how computing the granular neighbourhood from a spatial index scales
+    with instance size.
+    """
+    params = NeighbourhoodParams(spatial_oversampling=2)
+    benchmark(compute_neighbours, synthetic, params)
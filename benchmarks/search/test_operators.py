@@ -0,0 +1,39 @@
+import pytest
+
+from pyvrp import CostEvaluator
+from pyvrp.search import OPERATORS, BinaryOperator, compute_neighbours
+from pyvrp.search._search import Solution
+
+
+def _evaluate_all(op, nodes, pairs, cost_evaluator):
+    if isinstance(op, BinaryOperator):
+        for U, V in pairs:
+            op.evaluate(U, V, cost_evaluator)
+    else:
+        for U in nodes:
+            op.evaluate(U, cost_evaluator)
+
+
+@pytest.mark.parametrize("op", OPERATORS)
+def test_evaluate_throughput(op, benchmark, vrptw, vrptw_bks):
+    """
+    Tests the throughput of each operator's ``evaluate()`` on the VRPTW
+    instance, by evaluating all neighbourhood moves around the best-known
+    solution. Unlike the local search benchmarks, this does not apply any
+    moves, so it isolates the cost of move evaluation.
+    """
+    if not op.supports(vrptw):
+        pytest.skip(f"{op.__name__} does not support this instance.")
+
+    sol = Solution(vrptw)
+    sol.load(vrptw_bks)
+
+    operator = op(vrptw)
+    operator.init(sol)
+
+    neighbours = compute_neighbours(vrptw)
+    nodes = [sol[activity] for activity in neighbours]
+    pairs = [(sol[u], sol[v]) for u, vs in neighbours.items() for v in vs]
+
+    cost_evaluator = CostEvaluator([20], 6, 6)
+    benchmark(_evaluate_all, operator, nodes, pairs, cost_evaluator)
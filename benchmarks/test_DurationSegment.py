@@ -0,0 +1,35 @@
+import pytest
+
+from pyvrp import DurationSegment, Route
+
+
+def _merge_all(segments, edge_duration):
+    merged = segments[0]
+    for segment in segments[1:]:
+        merged = DurationSegment.merge(edge_duration, merged, segment)
+
+    return merged
+
+
+def test_merge(benchmark):
+    """
+    Tests performance of repeatedly merging duration segments.
+    """
+    segments = [
+        DurationSegment(duration=5, start_early=10 * idx, start_late=20 * idx)
+        for idx in range(1_000)
+    ]
+
+    benchmark(_merge_all, segments, 3)
+
+
+@pytest.mark.parametrize("num_clients", [10, 100, 1_000])
+def test_route_construction(num_clients, benchmark, synthetic):
+    """
+    Tests how constructing a route, which merges the duration segments of all
+    visits, scales with the length of the route.
+    """
+    if num_clients > synthetic.num_clients:
+        pytest.skip("Instance does not have enough clients.")
+
+    benchmark(Route, synthetic, list(range(num_clients)), 0)
@@ -0,0 +1,167 @@
+from __future__ import annotations
+
+import time
+from typing import TYPE_CHECKING
+
+from pyvrp.ProgressPrinter import ProgressPrinter
+from pyvrp.Result import Result
+from pyvrp.Statistics import Statistics
+from pyvrp.search._search import GeneticAlgorithm as _GeneticAlgorithm
+from pyvrp.search._search import GeneticAlgorithmParams
+
+if TYPE_CHECKING:
+    from pyvrp.PenaltyManager import PenaltyManager
+    from pyvrp._pyvrp import (
+        ProblemData,
+        RandomNumberGenerator,
+        Solution,
+    )
+    from pyvrp.search.LocalSearch import LocalSearch
+    from pyvrp.stop.StoppingCriterion import StoppingCriterion
+
+
+class GeneticAlgorithm:
+    """
+    Creates a GeneticAlgorithm instance. The population management, crossover,
+    and parallel education of offspring all happen in native code; see
+    :class:`~pyvrp.search._search.GeneticAlgorithmParams` for details. This
+    class drives the generations, and handles penalty management, stopping
+    criteria, and statistics.
+
+    Parameters
+    ----------
+    data
+        The problem data instance.
+    penalty_manager
+        Penalty manager to use.
+    rng
+        Random number generator.
+    searches
+        Local searches used to educate offspring, one for each thread. Each
+        local search must be a separate object, with its own operators.
+    initial_solutions
+        Initial solutions to seed the population with. Must not be empty.
+    params
+        Genetic algorithm parameters to use. If not provided, a default will
+        be used.
+
+    Raises
+    ------
+    ValueError
+        When the number of local searches does not match the number of
+        threads, or when no initial solutions are given.
+    """
+
+    def __init__(
+        self,
+        data: ProblemData,
+        penalty_manager: PenaltyManager,
+        rng: RandomNumberGenerator,
+        searches: list[LocalSearch],
+        initial_solutions: list[Solution],
+        params: GeneticAlgorithmParams = GeneticAlgorithmParams(),
+    ):
+        if len(searches) != params.num_threads:
+            raise ValueError("Expected num_threads local searches.")
+
+        if len(initial_solutions) == 0:
+            raise ValueError("Expected at least one initial solution.")
+
+        self._data = data
+        self._pm = penalty_manager
+        self._rng = rng
+        self._searches = searches
+        self._init = initial_solutions
+        self._params = params
+
+    @property
+    def penalty_manager(self) -> PenaltyManager:
+        """
+        Returns the penalty manager.
+        """
+        return self._pm
+
+    @property
+    def params(self) -> GeneticAlgorithmParams:
+        """
+        Returns the algorithm's parameter configuration.
+        """
+        return self._params
+
+    def run(
+        self,
+        stop: StoppingCriterion,
+        collect_stats: bool | Statistics = True,
+        display: bool = False,
+        display_interval: float = 5.0,
+    ) -> Result:
+        """
+        Runs the genetic algorithm with the provided stopping criterion. Each
+        iteration performs one generation, which creates ``num_threads``
+        offspring.
+
+        Parameters
+        ----------
+        stop
+            Stopping criterion to use. The algorithm runs until the first time
+            the stopping criterion returns ``True``.
+        collect_stats
+            Whether to collect statistics about the solver's progress. Default
+            ``True``. A :class:`~pyvrp.Statistics.Statistics` object may also
+            be passed, in which case statistics are collected into that
+            object. The statistics track the best offspring of each
+            generation as both the current and candidate solution.
+        display
+            Whether to display information about the solver progress. Default
+            ``False``. Progress information is only available when
+            ``collect_stats`` is also set.
+        display_interval
+            Time (in seconds) between iteration logs. Defaults to 5s.
+
+        Returns
+        -------
+        Result
+            A Result object, containing statistics (if collected) and the best
+            found solution.
+        """
+        print_progress = ProgressPrinter(display, display_interval)
+        print_progress.start(self._data)
+
+        if isinstance(collect_stats, Statistics):
+            stats = collect_stats
+        else:
+            stats = Statistics(collect_stats=collect_stats)
+
+        # The native genetic algorithm works with the native local searches
+        # wrapped by each LocalSearch object.
+        searches = [search._ls for search in self._searches]
+        algo = _GeneticAlgorithm(self._data, searches, self._params)
+
+        start = time.perf_counter()
+        iters = 0
+
+        cost_eval = self._pm.cost_evaluator()
+        for sol in self._init:
+            algo.add(sol, cost_eval)
+
+        best = min(self._init, key=cost_eval.cost)
+        while not stop(cost_eval.cost(best)):
+            iters += 1
+
+            cost_eval = self._pm.cost_evaluator()
+            offspring = algo.step(cost_eval, self._rng)
+
+            for cand in offspring:
+                self._pm.register(cand)
+                if cost_eval.cost(cand) < cost_eval.cost(best):
+                    best = cand
+
+            cand = min(offspring, key=cost_eval.penalised_cost)
+            stats.collect(cand, cand, best, cost_eval)
+            print_progress.iteration(stats)
+
+        runtime = time.perf_counter() - start
+        res = Result(best, stats, iters, runtime)
+
+        print_progress.end(res)
+        return res
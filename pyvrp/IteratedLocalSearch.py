@@ -168,7 +168,7 @@ class IteratedLocalSearch:
     def run(
         self,
         stop: StoppingCriterion,
-        collect_stats: bool = True,
+        collect_stats: bool | Statistics = True,
         display: bool = False,
         display_interval: float = 5.0,
     ) -> Result:
@@ -184,7 +184,9 @@ class IteratedLocalSearch:
             the stopping criterion returns ``True``.
         collect_stats
             Whether to collect statistics about the solver's progress. Default
-            ``True``.
+            ``True``. A :class:`~pyvrp.Statistics.Statistics` object may also
+            be passed, in which case statistics are collected into that
+            object. This allows configuring which iterations are recorded.
         display
             Whether to display information about the solver progress. Default
             ``False``. Progress information is only available when
@@ -211,7 +213,10 @@ class IteratedLocalSearch:
         print_progress.start(self._data)
 
         history: RingBuffer[Solution] = RingBuffer(self._params.history_length)
-        stats = Statistics(collect_stats=collect_stats)
+        if isinstance(collect_stats, Statistics):
+            stats = collect_stats
+        else:
+            stats = Statistics(collect_stats=collect_stats)
 
         start = time.perf_counter()
         iters = iters_no_improvement = 0
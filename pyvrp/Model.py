@@ -20,7 +20,9 @@ from pyvrp.exceptions import ScalingWarning
 from pyvrp.solve import SolveParams, solve
 
 if TYPE_CHECKING:
+    from pyvrp._pyvrp import PiecewiseLinearFunction
     from pyvrp.Result import Result
+    from pyvrp.Statistics import Statistics
     from pyvrp.stop import StoppingCriterion
 
 
@@ -190,6 +192,8 @@ class Model:
 
         profiles = [Profile() for _ in range(data.num_profiles)]
         for idx, profile in enumerate(profiles):
+            # The model needs every edge, so we retrieve each full matrix only
+            # once. For symmetric profiles, that involves a full copy.
             distances = data.distance_matrix(profile=idx)
             durations = data.duration_matrix(profile=idx)
             profile.edges = [
@@ -246,6 +250,7 @@ class Model:
         prize: int = 0,
         required: bool = True,
         group: ClientGroup | None = None,
+        lateness_cost: PiecewiseLinearFunction | None = None,
         *,
         name: str = "",
     ) -> Client:
@@ -287,6 +292,7 @@ class Model:
             prize=prize,
             required=required,
             group=group_idx,
+            lateness_cost=lateness_cost,
             name=name,
         )
 
@@ -310,6 +316,8 @@ class Model:
         amount: int | list[int] = [],
         prize: int = 0,
         required: bool = True,
+        pickup_lateness_cost: PiecewiseLinearFunction | None = None,
+        delivery_lateness_cost: PiecewiseLinearFunction | None = None,
         *,
         name: str = "",
     ) -> Shipment:
@@ -338,6 +346,8 @@ class Model:
             amount=[amount] if isinstance(amount, int) else amount,
             prize=prize,
             required=required,
+            pickup_lateness_cost=pickup_lateness_cost,
+            delivery_lateness_cost=delivery_lateness_cost,
             name=name,
         )
 
@@ -537,50 +547,36 @@ class Model:
         locs = self._locations
         loc2idx = {id(loc): idx for idx, loc in enumerate(locs)}
 
-        # First we create the base distance and duration matrices. These are
-        # shared by all routing profiles.
-        fill_value = min(missing_value, MAX_VALUE)
-        base_distance = np.full((len(locs), len(locs)), fill_value, np.int64)
-        base_duration = np.full((len(locs), len(locs)), fill_value, np.int64)
-        np.fill_diagonal(base_distance, 0)
-        np.fill_diagonal(base_duration, 0)
-
-        for edge in self._edges:
-            frm = loc2idx[id(edge.frm)]
-            to = loc2idx[id(edge.to)]
-            base_distance[frm, to] = edge.distance
-            base_duration[frm, to] = edge.duration
-
-        # Now we create the profile-specific distance and duration matrices.
-        # These are based on the base matrices.
-        distances = []
-        durations = []
-        for profile in self._profiles:
-            prof_distance = base_distance.copy()
-            prof_duration = base_duration.copy()
-
-            for edge in profile.edges:
-                frm = loc2idx[id(edge.frm)]
-                to = loc2idx[id(edge.to)]
-                prof_distance[frm, to] = edge.distance
-                prof_duration[frm, to] = edge.duration
-
-            distances.append(prof_distance)
-            durations.append(prof_duration)
+        def to_arrays(edges: list[Edge]) -> np.ndarray:
+            arr = np.empty((4, len(edges)), dtype=np.int64)
+            arr[0] = [loc2idx[id(edge.frm)] for edge in edges]
+            arr[1] = [loc2idx[id(edge.to)] for edge in edges]
+            arr[2] = [edge.distance for edge in edges]
+            arr[3] = [edge.duration for edge in edges]
+            return arr
+
+        # The base edges are shared by all routing profiles. Profile-specific
+        # edges come after the base edges, so they take precedence. The
+        # matrices are then filled from these edges in native code, which
+        # avoids constructing dense matrices here.
+        base = to_arrays(self._edges)
+        edges = [
+            np.concatenate((base, to_arrays(profile.edges)), axis=1)
+            for profile in self._profiles
+        ]
 
         # When the user has not provided any profiles, we create an implicit
-        # first profile from the base matrices.
+        # first profile from the base edges.
         if not self._profiles:
-            distances = [base_distance]
-            durations = [base_duration]
+            edges = [base]
 
-        return ProblemData(
+        return ProblemData.from_edges(
             self._locations,
             self._clients,
             self._depots,
             self.vehicle_types,
-            distances,
-            durations,
+            [tuple(arr) for arr in edges],
+            min(missing_value, MAX_VALUE),
             self._groups,
             self._shipments,
         )
@@ -589,7 +585,7 @@ class Model:
         self,
         stop: StoppingCriterion,
         seed: int = 0,
-        collect_stats: bool = True,
+        collect_stats: bool | Statistics = True,
         display: bool = True,
         params: SolveParams = SolveParams(),
         missing_value: int = MAX_VALUE,
@@ -606,7 +602,9 @@ class Model:
             Seed value to use for the random number stream. Default 0.
         collect_stats
             Whether to collect statistics about the solver's progress. Default
-            ``True``.
+            ``True``. A :class:`~pyvrp.Statistics.Statistics` object may also
+            be passed, in which case statistics are collected into that
+            object. This allows configuring which iterations are recorded.
         display
             Whether to display information about the solver progress. Default
             ``True``. Progress information is only available when
@@ -70,18 +70,19 @@ class ProgressPrinter:
         should_print = (
             self._print
             and stats.is_collecting()
+            and len(stats) > 0
             and interval >= self._display_interval
         )
 
         if not should_print:
             return
 
-        datum = stats.data[-1]
+        datum = stats[-1]
         new_best = datum.best_feas and datum.best_cost < self._best_cost
         msg = _ITERATION.format(
             special="H" if new_best else " ",
             iters=stats.num_iterations,
-            elapsed=round(sum(stats.runtimes)),
+            elapsed=round(stats.total_runtime),
             curr=datum.current_cost,
             curr_feas="Y" if datum.current_feas else "N",
             cand=datum.candidate_cost,
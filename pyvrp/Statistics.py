@@ -1,9 +1,11 @@
 import csv
-from dataclasses import asdict, dataclass, fields
+from dataclasses import dataclass, fields
 from pathlib import Path
 from time import perf_counter
 from typing import Iterator, Literal
 
+import numpy as np
+
 from pyvrp._pyvrp import CostEvaluator, Solution
 
 
@@ -21,47 +23,172 @@ class _Datum:
     best_feas: bool
 
 
+# Column names and types of the recorded statistics. The data point columns
+# are in the same order as the fields of _Datum.
+_COLUMNS: dict[str, type] = {
+    "iteration": np.int64,
+    "runtime": np.float64,
+    **{
+        field.name: np.bool_ if field.type is bool else np.int64
+        for field in fields(_Datum)
+    },
+}
+
+_MIN_CAPACITY = 1_024
+
+
 class Statistics:
     """
-    Statistics about the search progress.
+    Statistics about the search progress. Statistics are stored in columnar
+    numpy arrays, and can optionally be collected for only a subset of the
+    iterations to limit memory use on long runs.
 
     Parameters
     ----------
     collect_stats
         Whether to collect statistics at all. This can be turned off to avoid
         excessive memory use on long runs.
+    sampling
+        Which iterations to record. ``"every"`` records every ``interval``-th
+        iteration, starting with the first. ``"improving"`` records only those
+        iterations where the best solution's cost improved. ``"log"`` records
+        log-spaced iterations: 1, 2, ..., 9, 10, 20, ..., 90, 100, 200, and so
+        on. Default ``"every"``.
+    interval
+        Recording interval used when ``sampling`` is ``"every"``. Default 1,
+        which records every iteration.
+
+    Raises
+    ------
+    ValueError
+        When ``sampling`` is not understood, or when ``interval`` is not
+        strictly positive.
     """
 
-    runtimes: list[float]
     num_iterations: int
-    data: list[_Datum]
 
-    def __init__(self, collect_stats: bool = True):
-        self.runtimes = []
+    def __init__(
+        self,
+        collect_stats: bool = True,
+        sampling: Literal["every", "improving", "log"] = "every",
+        interval: int = 1,
+    ):
+        if sampling not in ("every", "improving", "log"):
+            raise ValueError(f"Sampling '{sampling}' not understood.")
+
+        if interval <= 0:
+            raise ValueError("interval must be strictly positive.")
+
         self.num_iterations = 0
-        self.data = []
 
+        self._size = 0
+        self._columns = {
+            name: np.empty(0, dtype=dtype) for name, dtype in _COLUMNS.items()
+        }
+
+        self._total_runtime = 0.0
         self._clock = perf_counter()
         self._collect_stats = collect_stats
+        self._sampling = sampling
+        self._interval = interval
 
     def __eq__(self, other: object) -> bool:
         return (
             isinstance(other, Statistics)
             and self._collect_stats == other._collect_stats
-            and self.runtimes == other.runtimes
+            and self._sampling == other._sampling
+            and self._interval == other._interval
             and self.num_iterations == other.num_iterations
-            and self.data == other.data
+            and self._size == other._size
+            and all(
+                np.array_equal(self._column(name), other._column(name))
+                for name in _COLUMNS
+            )
+        )
+
+    def __len__(self) -> int:
+        """
+        Returns the number of recorded data points.
+        """
+        return self._size
+
+    def __getitem__(self, idx: int) -> _Datum:
+        """
+        Returns the recorded data point at the given index.
+        """
+        if not -self._size <= idx < self._size:
+            raise IndexError("Statistics index out of range.")
+
+        idx %= self._size
+        return _Datum(
+            *(
+                self._columns[field.name][idx].item()
+                for field in fields(_Datum)
+            )
         )
 
     def __iter__(self) -> Iterator[_Datum]:
         """
-        Iterates over the collected data points.
+        Iterates over the recorded data points.
+        """
+        names = [field.name for field in fields(_Datum)]
+        columns = [self._column(name).tolist() for name in names]
+        for values in zip(*columns):
+            yield _Datum(*values)
+
+    @property
+    def data(self) -> list[_Datum]:
+        """
+        Returns a list of the recorded data points. This copies all recorded
+        data; prefer :meth:`~to_numpy` for large amounts of data.
         """
-        yield from self.data
+        return list(self)
+
+    @property
+    def iterations(self) -> np.ndarray:
+        """
+        Returns the (one-based) iteration numbers of the recorded data points.
+        """
+        return self._column("iteration")
+
+    @property
+    def runtimes(self) -> np.ndarray:
+        """
+        Returns the runtimes (in seconds) of the recorded iterations.
+        """
+        return self._column("runtime")
+
+    @runtimes.setter
+    def runtimes(self, runtimes):
+        self._columns["runtime"][: self._size] = runtimes
+
+    @property
+    def total_runtime(self) -> float:
+        """
+        Returns the total runtime (in seconds) of all iterations, including
+        those that were not recorded.
+        """
+        return self._total_runtime
 
     def is_collecting(self) -> bool:
         return self._collect_stats
 
+    def to_numpy(self) -> dict[str, np.ndarray]:
+        """
+        Returns the recorded statistics as a dictionary mapping column names
+        to numpy arrays. The arrays are read-only views of the underlying
+        storage, so no data is copied. The views are not updated by further
+        calls to :meth:`~collect`.
+
+        Returns
+        -------
+        dict
+            Dictionary with the ``iteration``, ``runtime``, ``current_cost``,
+            ``current_feas``, ``candidate_cost``, ``candidate_feas``,
+            ``best_cost``, and ``best_feas`` columns.
+        """
+        return {name: self._column(name) for name in _COLUMNS}
+
     def collect(
         self,
         current: Solution,
@@ -89,18 +216,60 @@ class Statistics:
         start = self._clock
         self._clock = perf_counter()
 
-        self.runtimes.append(self._clock - start)
+        runtime = self._clock - start
+        self._total_runtime += runtime
         self.num_iterations += 1
 
-        datum = _Datum(
+        best_cost = cost_evaluator.penalised_cost(best)
+        if not self._should_record(best_cost):
+            return
+
+        self._append(
+            self.num_iterations,
+            runtime,
             cost_evaluator.penalised_cost(current),
             current.is_feasible(),
             cost_evaluator.penalised_cost(candidate),
             candidate.is_feasible(),
-            cost_evaluator.penalised_cost(best),
+            best_cost,
             best.is_feasible(),
         )
-        self.data.append(datum)
+
+    def _should_record(self, best_cost: int) -> bool:
+        iteration = self.num_iterations
+
+        if self._sampling == "every":
+            return (iteration - 1) % self._interval == 0
+
+        if self._sampling == "log":
+            return iteration % 10 ** (len(str(iteration)) - 1) == 0
+
+        # Improving: record the first iteration, and any iteration that
+        # improves over the last recorded best cost.
+        if self._size == 0:
+            return True
+
+        return best_cost < self._columns["best_cost"][self._size - 1]
+
+    def _append(self, *values):
+        if self._size == len(self._columns["iteration"]):
+            # Out of space, so we grow each column geometrically. This keeps
+            # the amortised cost of appending constant.
+            capacity = max(2 * self._size, _MIN_CAPACITY)
+            for name, column in self._columns.items():
+                grown = np.empty(capacity, dtype=column.dtype)
+                grown[: self._size] = column[: self._size]
+                self._columns[name] = grown
+
+        for column, value in zip(self._columns.values(), values):
+            column[self._size] = value
+
+        self._size += 1
+
+    def _column(self, name: str) -> np.ndarray:
+        view = self._columns[name][: self._size]
+        view.flags.writeable = False
+        return view
 
     @classmethod
     def from_csv(cls, where: Path | str, delimiter: str = ",", **kwargs):
@@ -124,29 +293,31 @@ class Statistics:
             Statistics object populated with the data read from the given
             filesystem location.
         """
-        field2type = {field.name: field.type for field in fields(_Datum)}
-
-        def make_datum(row) -> _Datum:
-            datum = {}
-
-            for name, value in row.items():
-                if name in field2type:
-                    if field2type[name] is bool:
-                        datum[name] = bool(int(value))
-                    else:
-                        datum[name] = field2type[name](value)  # type: ignore
-
-            return _Datum(**datum)
-
         with open(where) as fh:
             lines = fh.readlines()
 
+        rows = list(csv.DictReader(lines, delimiter=delimiter, **kwargs))
+
         stats = cls()
+        for idx, row in enumerate(rows, 1):
+            # Older files do not have an iteration column. Those files have a
+            # row for every iteration.
+            iteration = int(row.get("iteration", idx))
+
+            values = []
+            for name, dtype in _COLUMNS.items():
+                if name == "iteration":
+                    values.append(iteration)
+                elif dtype is np.bool_:
+                    values.append(bool(int(row[name])))
+                elif dtype is np.float64:
+                    values.append(float(row[name]))
+                else:
+                    values.append(int(row[name]))
 
-        for row in csv.DictReader(lines, delimiter=delimiter, **kwargs):
-            stats.runtimes.append(float(row["runtime"]))
-            stats.num_iterations += 1
-            stats.data.append(make_datum(row))
+            stats._append(*values)
+            stats.num_iterations = iteration
+            stats._total_runtime += float(row["runtime"])
 
         return stats
 
@@ -172,17 +343,18 @@ class Statistics:
             Additional keyword arguments. These are passed to
             :class:`csv.DictWriter`.
         """
+        columns = []
+        for name, dtype in _COLUMNS.items():
+            column = self._column(name)
+            if dtype is np.bool_:  # bool as 0/1
+                column = column.astype(np.int64)
+
+            columns.append(column.tolist())
+
         with open(where, "w") as fh:
-            header = ["runtime", *(f.name for f in fields(_Datum))]
+            header = list(_COLUMNS)
             writer = csv.DictWriter(
                 fh, header, delimiter=delimiter, quoting=quoting, **kwargs
             )
             writer.writeheader()
-
-            for datum, runtime in zip(self.data, self.runtimes):
-                row = {
-                    f: int(v) if isinstance(v, bool) else v  # bool as 0/1
-                    for f, v in asdict(datum).items()
-                }
-                row["runtime"] = runtime
-                writer.writerow(row)
+            writer.writerows(dict(zip(header, row)) for row in zip(*columns))
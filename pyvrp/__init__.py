@@ -1,6 +1,7 @@
 import logging
 import sys
 
+from .GeneticAlgorithm import GeneticAlgorithm as GeneticAlgorithm
 from .IteratedLocalSearch import IteratedLocalSearch as IteratedLocalSearch
 from .IteratedLocalSearch import (
     IteratedLocalSearchCallbacks as IteratedLocalSearchCallbacks,
@@ -32,12 +33,15 @@ from ._pyvrp import Shipment as Shipment
 from ._pyvrp import ShipmentStep as ShipmentStep
 from ._pyvrp import Solution as Solution
 from ._pyvrp import VehicleType as VehicleType
+from .decomposition import DecompositionParams as DecompositionParams
+from .decomposition import solve_decomposed as solve_decomposed
 from .minimise_fleet import minimise_fleet as minimise_fleet
 from .read import read as read
 from .read import read_solution as read_solution
 from .show_versions import show_versions as show_versions
 from .solve import SolveParams as SolveParams
 from .solve import solve as solve
+from .solve import solve_many as solve_many
 
 # Sets up basic logging to stdout for PyVRP, of INFO and up. This replaces
 # previous print() statements, and allows easier integration into calling
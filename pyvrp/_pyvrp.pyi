@@ -1,3 +1,4 @@
+import os
 from enum import Enum
 from typing import Iterator, overload
 
@@ -77,6 +78,13 @@ class PiecewiseLinearFunction:
         segments: list[tuple[np.int64, np.int64]],
     ) -> None: ...
     def __call__(self, x: np.int64) -> np.int64: ...
+    def evaluate(self, x: np.ndarray[int]) -> np.ndarray[int]: ...
+    def compose(
+        self, inner: PiecewiseLinearFunction
+    ) -> PiecewiseLinearFunction: ...
+    def minimum(
+        self, other: PiecewiseLinearFunction
+    ) -> PiecewiseLinearFunction: ...
     @property
     def breakpoints(self) -> list[np.int64]: ...
     @property
@@ -106,6 +114,7 @@ class Client:
     prize: int
     required: bool
     group: int | None
+    lateness_cost: PiecewiseLinearFunction | None
     name: str
     def __init__(
         self,
@@ -119,6 +128,7 @@ class Client:
         prize: int = 0,
         required: bool = True,
         group: int | None = None,
+        lateness_cost: PiecewiseLinearFunction | None = None,
         *,
         name: str = "",
     ) -> None: ...
@@ -170,12 +180,14 @@ class ShipmentStep:
     tw_early: int
     tw_late: int
     service_duration: int
+    lateness_cost: PiecewiseLinearFunction | None
     def __init__(
         self,
         location: int,
         tw_early: int = 0,
         tw_late: int = ...,
         service_duration: int = 0,
+        lateness_cost: PiecewiseLinearFunction | None = None,
     ) -> None: ...
     def __eq__(self, other: object) -> bool: ...
     def __getstate__(self) -> tuple: ...
@@ -201,6 +213,8 @@ class Shipment:
         amount: list[int] = [],
         prize: int = 0,
         required: bool = True,
+        pickup_lateness_cost: PiecewiseLinearFunction | None = None,
+        delivery_lateness_cost: PiecewiseLinearFunction | None = None,
         *,
         name: str = "",
     ) -> None: ...
@@ -312,6 +326,27 @@ class ProblemData:
         groups: list[ClientGroup] | None = None,
         shipments: list[Shipment] | None = None,
     ) -> ProblemData: ...
+    @staticmethod
+    def from_edges(
+        locations: list[Location],
+        clients: list[Client],
+        depots: list[Depot],
+        vehicle_types: list[VehicleType],
+        edges: list[
+            tuple[
+                np.ndarray[int],
+                np.ndarray[int],
+                np.ndarray[int],
+                np.ndarray[int],
+            ]
+        ],
+        missing_value: int,
+        groups: list[ClientGroup] = [],
+        shipments: list[Shipment] = [],
+    ) -> ProblemData: ...
+    def save(self, path: str | os.PathLike) -> None: ...
+    @staticmethod
+    def load(path: str | os.PathLike, mmap: bool = True) -> ProblemData: ...
     def location(self, location: int) -> Location: ...
     def client(self, client: int) -> Client: ...
     def depot(self, depot: int) -> Depot: ...
@@ -320,7 +355,19 @@ class ProblemData:
     def vehicle_type(self, vehicle_type: int) -> VehicleType: ...
     def distance_matrix(self, profile: int) -> np.ndarray[int]: ...
     def duration_matrix(self, profile: int) -> np.ndarray[int]: ...
+    def distance_submatrix(
+        self,
+        profile: int,
+        locations: list[int],
+    ) -> np.ndarray[int]: ...
+    def duration_submatrix(
+        self,
+        profile: int,
+        locations: list[int],
+    ) -> np.ndarray[int]: ...
     def has_time_windows(self) -> bool: ...
+    def has_lateness_costs(self) -> bool: ...
+    def is_symmetric(self, profile: int) -> bool: ...
     @property
     def num_clients(self) -> int: ...
     @property
@@ -392,6 +439,7 @@ class Route:
     def duration(self) -> int: ...
     def overtime(self) -> int: ...
     def duration_cost(self) -> int: ...
+    def lateness_cost(self) -> int: ...
     def num_clients(self) -> int: ...
     def num_shipments(self) -> int: ...
     def num_depots(self) -> int: ...
@@ -409,6 +457,7 @@ class Route:
     def start_depot(self) -> int: ...
     def end_depot(self) -> int: ...
     def schedule(self) -> list[ScheduledActivity]: ...
+    def activities(self) -> list[Activity]: ...
     def __getstate__(self) -> tuple: ...
     def __setstate__(self, state: tuple, /) -> None: ...
 
@@ -422,6 +471,9 @@ class Solution:
     def make_random(
         cls, data: ProblemData, rng: RandomNumberGenerator
     ) -> Solution: ...
+    def save(self, path: str | os.PathLike) -> None: ...
+    @staticmethod
+    def load(path: str | os.PathLike, data: ProblemData) -> Solution: ...
     def routes(self) -> list[Route]: ...
     def unplanned(self) -> list[Activity]: ...
     def has_excess_load(self) -> bool: ...
@@ -432,6 +484,7 @@ class Solution:
     def duration(self) -> int: ...
     def overtime(self) -> int: ...
     def duration_cost(self) -> int: ...
+    def lateness_cost(self) -> int: ...
     def excess_load(self) -> list[int]: ...
     def excess_distance(self) -> int: ...
     def fixed_vehicle_cost(self) -> int: ...
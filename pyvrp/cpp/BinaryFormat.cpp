@@ -0,0 +1,237 @@
+#include "BinaryFormat.h"
+
+#include <bit>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using pyvrp::binary::Kind;
+using pyvrp::binary::MappedFile;
+using pyvrp::binary::Reader;
+using pyvrp::binary::Writer;
+
+namespace
+{
+void ensureLittleEndian()
+{
+    if constexpr (std::endian::native != std::endian::little)
+        throw std::runtime_error("Binary format requires little-endian data.");
+}
+
+// Returns the number of padding bytes needed to align the given position.
+size_t padding(size_t pos)
+{
+    auto const rem = pos % pyvrp::binary::ALIGNMENT;
+    return rem == 0 ? 0 : pyvrp::binary::ALIGNMENT - rem;
+}
+}  // namespace
+
+Writer::Writer(std::filesystem::path const &path, Kind kind)
+    : out_(path, std::ios::binary | std::ios::trunc)
+{
+    ensureLittleEndian();
+
+    if (!out_)
+        throw std::runtime_error("Could not open file for writing.");
+
+    writeBytes(MAGIC, sizeof(MAGIC));
+
+    auto const version = VERSION;
+    writeBytes(&version, sizeof(version));
+
+    auto const rawKind = static_cast<uint32_t>(kind);
+    writeBytes(&rawKind, sizeof(rawKind));
+}
+
+void Writer::writeBytes(void const *data, size_t size)
+{
+    out_.write(static_cast<char const *>(data), size);
+    pos_ += size;
+
+    if (!out_)
+        throw std::runtime_error("Could not write to file.");
+}
+
+void Writer::align()
+{
+    char const zeros[ALIGNMENT] = {};
+    writeBytes(zeros, padding(pos_));
+}
+
+void Writer::write(std::string const &value)
+{
+    write(value.size());
+    writeBytes(value.data(), value.size());
+}
+
+Reader::Reader(char const *data, size_t size, Kind kind)
+    : data_(data), size_(size)
+{
+    ensureLittleEndian();
+
+    char magic[sizeof(MAGIC)];
+    if (size_ < sizeof(MAGIC))
+        throw std::invalid_argument("Not a PyVRP binary file.");
+
+    readBytes(magic, sizeof(magic));
+    if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+        throw std::invalid_argument("Not a PyVRP binary file.");
+
+    uint32_t version;
+    readBytes(&version, sizeof(version));
+    if (version != VERSION)
+        throw std::invalid_argument("Unsupported binary format version.");
+
+    uint32_t rawKind;
+    readBytes(&rawKind, sizeof(rawKind));
+    if (rawKind != static_cast<uint32_t>(kind))
+        throw std::invalid_argument("Binary file contains another object.");
+}
+
+void Reader::readBytes(void *data, size_t size)
+{
+    std::memcpy(data, data_ + skip(size), size);
+}
+
+size_t Reader::skip(size_t size)
+{
+    if (size > size_ - pos_)
+        throw std::invalid_argument("Unexpected end of file.");
+
+    auto const start = pos_;
+    pos_ += size;
+    return start;
+}
+
+void Reader::align() { skip(padding(pos_)); }
+
+void Reader::read(std::string &value)
+{
+    auto const size = read<size_t>();
+    value.assign(data_ + skip(size), size);
+}
+
+#ifdef _WIN32
+MappedFile::MappedFile(std::filesystem::path const &path)
+{
+    file_ = CreateFileW(path.c_str(),
+                        GENERIC_READ,
+                        FILE_SHARE_READ,
+                        nullptr,
+                        OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL,
+                        nullptr);
+
+    if (file_ == INVALID_HANDLE_VALUE)
+    {
+        file_ = nullptr;
+        throw std::runtime_error("Could not open file for reading.");
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file_, &size))
+    {
+        CloseHandle(file_);
+        throw std::runtime_error("Could not determine file size.");
+    }
+
+    size_ = static_cast<size_t>(size.QuadPart);
+    if (size_ == 0)  // cannot map empty files, but there's nothing to map
+        return;      // anyway.
+
+    mapping_ = CreateFileMappingW(
+        file_, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (!mapping_)
+    {
+        CloseHandle(file_);
+        throw std::runtime_error("Could not map file.");
+    }
+
+    data_ = static_cast<char *>(
+        MapViewOfFile(mapping_, FILE_MAP_COPY, 0, 0, 0));
+    if (!data_)
+    {
+        CloseHandle(mapping_);
+        CloseHandle(file_);
+        throw std::runtime_error("Could not map file.");
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_)
+        UnmapViewOfFile(data_);
+
+    if (mapping_)
+        CloseHandle(mapping_);
+
+    if (file_)
+        CloseHandle(file_);
+}
+#else
+MappedFile::MappedFile(std::filesystem::path const &path)
+{
+    auto const fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        throw std::runtime_error("Could not open file for reading.");
+
+    struct stat info;
+    if (fstat(fd, &info) == -1)
+    {
+        close(fd);
+        throw std::runtime_error("Could not determine file size.");
+    }
+
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ == 0)  // cannot map empty files, but there's nothing to map
+    {                // anyway.
+        close(fd);
+        return;
+    }
+
+    // A private mapping is copy-on-write: writes (which should not happen)
+    // are never visible to other processes, or written back to the file.
+    auto *addr = mmap(
+        nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);  // the mapping remains valid after closing
+
+    if (addr == MAP_FAILED)
+        throw std::runtime_error("Could not map file.");
+
+    data_ = static_cast<char *>(addr);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_)
+        munmap(data_, size_);
+}
+#endif
+
+char *MappedFile::data() const { return data_; }
+
+size_t MappedFile::size() const { return size_; }
+
+std::vector<char> pyvrp::binary::readFile(std::filesystem::path const &path)
+{
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in)
+        throw std::runtime_error("Could not open file for reading.");
+
+    std::vector<char> contents(static_cast<size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(contents.data(), contents.size());
+
+    if (!in)
+        throw std::runtime_error("Could not read from file.");
+
+    return contents;
+}
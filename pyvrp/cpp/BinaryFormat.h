@@ -0,0 +1,286 @@
+#ifndef PYVRP_BINARYFORMAT_H
+#define PYVRP_BINARYFORMAT_H
+
+#include "Measure.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Helpers for PyVRP's binary file format. A binary file starts with a short
+// header: an eight byte magic string, followed by the format version and the
+// kind of object stored in the file, both as 32-bit unsigned integers. The
+// object's fields follow after the header. All values are stored in
+// little-endian byte order. Integers are stored as 64-bit values, floating
+// point numbers as doubles, booleans as single bytes, and strings and vectors
+// as their 64-bit size followed by their elements. Large blocks of data, like
+// distance and duration matrices, are aligned, so they can be memory-mapped
+// directly.
+namespace pyvrp::binary
+{
+inline constexpr char MAGIC[8] = {'P', 'Y', 'V', 'R', 'P', 'B', 'I', 'N'};
+inline constexpr uint32_t VERSION = 2;
+inline constexpr size_t ALIGNMENT = 64;
+
+enum class Kind : uint32_t
+{
+    PROBLEM_DATA = 1,
+    SOLUTION = 2,
+};
+
+/**
+ * Writes objects to a binary file.
+ */
+class Writer
+{
+    std::ofstream out_;
+    size_t pos_ = 0;
+
+public:
+    /**
+     * Opens the file at the given path for writing, and writes the header.
+     */
+    Writer(std::filesystem::path const &path, Kind kind);
+
+    /**
+     * Writes the given number of raw bytes.
+     */
+    void writeBytes(void const *data, size_t size);
+
+    /**
+     * Pads the file with zero bytes until the current position is aligned.
+     */
+    void align();
+
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    void write(T value);
+
+    template <MeasureType Type, NumberType Value>
+    void write(Measure<Type, Value> value);
+
+    void write(std::string const &value);
+
+    template <typename T> void write(std::optional<T> const &value);
+
+    template <typename T, typename U>
+    void write(std::pair<T, U> const &value);
+
+    template <typename T> void write(std::vector<T> const &values);
+};
+
+/**
+ * Reads objects from a buffer containing the contents of a binary file.
+ */
+class Reader
+{
+    char const *data_;
+    size_t size_;
+    size_t pos_ = 0;
+
+public:
+    /**
+     * Reads and validates the header from the given buffer.
+     *
+     * @throws std::invalid_argument When the buffer does not contain a binary
+     *                               file of the expected kind and version.
+     */
+    Reader(char const *data, size_t size, Kind kind);
+
+    /**
+     * Reads the given number of raw bytes.
+     */
+    void readBytes(void *data, size_t size);
+
+    /**
+     * Skips the given number of bytes, and returns the position at which the
+     * skipped bytes start.
+     */
+    size_t skip(size_t size);
+
+    /**
+     * Skips bytes until the current position is aligned.
+     */
+    void align();
+
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    void read(T &value);
+
+    template <MeasureType Type, NumberType Value>
+    void read(Measure<Type, Value> &value);
+
+    void read(std::string &value);
+
+    template <typename T> void read(std::optional<T> &value);
+
+    template <typename T, typename U> void read(std::pair<T, U> &value);
+
+    template <typename T> void read(std::vector<T> &values);
+
+    template <typename T> T read();
+};
+
+/**
+ * Read-only, copy-on-write memory mapping of a file. Pages that are not
+ * written to are shared with all other processes mapping the same file.
+ */
+class MappedFile
+{
+    char *data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    void *file_ = nullptr;
+    void *mapping_ = nullptr;
+#endif
+
+public:
+    explicit MappedFile(std::filesystem::path const &path);
+    ~MappedFile();
+
+    MappedFile(MappedFile const &) = delete;
+    MappedFile &operator=(MappedFile const &) = delete;
+
+    [[nodiscard]] char *data() const;
+    [[nodiscard]] size_t size() const;
+};
+
+/**
+ * Reads the entire file at the given path into memory.
+ */
+std::vector<char> readFile(std::filesystem::path const &path);
+}  // namespace pyvrp::binary
+
+template <typename T>
+    requires std::is_arithmetic_v<T>
+void pyvrp::binary::Writer::write(T value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        uint8_t const byte = value;
+        writeBytes(&byte, sizeof(byte));
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        double const raw = value;
+        writeBytes(&raw, sizeof(raw));
+    }
+    else if constexpr (std::is_unsigned_v<T>)
+    {
+        uint64_t const raw = value;
+        writeBytes(&raw, sizeof(raw));
+    }
+    else
+    {
+        int64_t const raw = value;
+        writeBytes(&raw, sizeof(raw));
+    }
+}
+
+template <pyvrp::MeasureType Type, pyvrp::NumberType Value>
+void pyvrp::binary::Writer::write(Measure<Type, Value> value)
+{
+    write(value.get());
+}
+
+template <typename T>
+void pyvrp::binary::Writer::write(std::optional<T> const &value)
+{
+    write(value.has_value());
+    if (value)
+        write(*value);
+}
+
+template <typename T, typename U>
+void pyvrp::binary::Writer::write(std::pair<T, U> const &value)
+{
+    write(value.first);
+    write(value.second);
+}
+
+template <typename T>
+void pyvrp::binary::Writer::write(std::vector<T> const &values)
+{
+    write(values.size());
+    for (auto const &value : values)
+        write(value);
+}
+
+template <typename T>
+    requires std::is_arithmetic_v<T>
+void pyvrp::binary::Reader::read(T &value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        uint8_t byte;
+        readBytes(&byte, sizeof(byte));
+        value = byte != 0;
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        double raw;
+        readBytes(&raw, sizeof(raw));
+        value = static_cast<T>(raw);
+    }
+    else if constexpr (std::is_unsigned_v<T>)
+    {
+        uint64_t raw;
+        readBytes(&raw, sizeof(raw));
+        value = static_cast<T>(raw);
+    }
+    else
+    {
+        int64_t raw;
+        readBytes(&raw, sizeof(raw));
+        value = static_cast<T>(raw);
+    }
+}
+
+template <pyvrp::MeasureType Type, pyvrp::NumberType Value>
+void pyvrp::binary::Reader::read(Measure<Type, Value> &value)
+{
+    value = read<Value>();
+}
+
+template <typename T>
+void pyvrp::binary::Reader::read(std::optional<T> &value)
+{
+    value.reset();
+    if (read<bool>())
+        value = read<T>();
+}
+
+template <typename T, typename U>
+void pyvrp::binary::Reader::read(std::pair<T, U> &value)
+{
+    read(value.first);
+    read(value.second);
+}
+
+template <typename T> void pyvrp::binary::Reader::read(std::vector<T> &values)
+{
+    auto const size = read<size_t>();
+    if (size > size_ - pos_)  // each element takes at least one byte, so this
+        throw std::invalid_argument("Unexpected end of file.");  // is invalid
+
+    values.clear();
+    values.reserve(size);
+    for (size_t idx = 0; idx != size; ++idx)
+        values.push_back(read<T>());
+}
+
+template <typename T> T pyvrp::binary::Reader::read()
+{
+    T value;
+    read(value);
+    return value;
+}
+
+#endif  // PYVRP_BINARYFORMAT_H
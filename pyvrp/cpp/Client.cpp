@@ -4,6 +4,7 @@
 #include <cstring>
 
 using pyvrp::Client;
+using pyvrp::PiecewiseLinearFunction;
 
 namespace
 {
@@ -39,6 +40,8 @@ Client::Client(size_t location,
                Cost prize,
                bool required,
                std::optional<size_t> group,
+               std::optional<PiecewiseLinearFunction<int64_t, int64_t>>
+                   latenessCost,
                std::string name)
     : location(location),
       serviceDuration(serviceDuration),
@@ -50,6 +53,7 @@ Client::Client(size_t location,
       prize(prize),
       required(required),
       group(group),
+      latenessCost(std::move(latenessCost)),
       name(duplicate(name.data()))
 {
     assert(delivery.size() == pickup.size());
@@ -77,6 +81,16 @@ Client::Client(size_t location,
 
     if (prize < 0)
         throw std::invalid_argument("prize must be >= 0.");
+
+    auto const &cost = this->latenessCost;  // argument has been moved from
+    if (cost && !cost->isMonotonicallyIncreasing())
+        throw std::invalid_argument(
+            "lateness_cost must be monotonically increasing.");
+
+    // Service never starts before the time window opens, so this ensures that
+    // lateness costs are never negative.
+    if (cost && (*cost)(twEarly.get()) < 0)
+        throw std::invalid_argument("lateness_cost must be >= 0 at tw_early.");
 }
 
 Client::Client(Client const &client)
@@ -90,6 +104,7 @@ Client::Client(Client const &client)
       prize(client.prize),
       required(client.required),
       group(client.group),
+      latenessCost(client.latenessCost),
       name(duplicate(client.name))
 {
 }
@@ -105,6 +120,7 @@ Client::Client(Client &&client)
       prize(client.prize),
       required(client.required),
       group(client.group),
+      latenessCost(std::move(client.latenessCost)),
       name(client.name)  // we can steal
 {
     client.name = nullptr;  // stolen
@@ -125,6 +141,7 @@ bool Client::operator==(Client const &other) const
         && prize == other.prize
         && required == other.required
         && group == other.group
+        && latenessCost == other.latenessCost
         && std::strcmp(name, other.name) == 0;
     // clang-format on
 }
@@ -2,8 +2,11 @@
 #define PYVRP_CLIENT_H
 
 #include "Measure.h"
+#include "PiecewiseLinearFunction.h"
 
+#include <cstdint>
 #include <limits>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -21,6 +24,7 @@ namespace pyvrp
  *    prize: int = 0,
  *    required: bool = True,
  *    group: int | None = None,
+ *    lateness_cost: PiecewiseLinearFunction | None = None,
  *    *,
  *    name: str = "",
  * )
@@ -62,6 +66,22 @@ namespace pyvrp
  * group
  *     Indicates membership of the given client group, if any. By default
  *     clients are not part of any groups.
+ * lateness_cost
+ *     Cost of starting service at this client at a given time, as a
+ *     non-decreasing piecewise linear function of the service start time that
+ *     is non-negative from ``tw_early`` onwards. This can be used to model
+ *     soft time windows: for example, a function that is zero until some
+ *     time, and increases by :math:`c` per unit of time afterwards, charges a
+ *     cost of :math:`c` for each unit of time that service starts late. By
+ *     default there is no lateness cost.
+ *
+ *     .. note::
+ *
+ *        Lateness costs are part of the objective, and are evaluated at the
+ *        service start times of each route's schedule. The local search takes
+ *        them into account exactly, but evaluating moves on instances with
+ *        lateness costs takes time linear in the length of the routes
+ *        involved.
  * name
  *     Free-form name field for this client. Default empty.
  *
@@ -89,8 +109,16 @@ namespace pyvrp
  *     Whether visiting this client is required.
  * group
  *     Indicates membership of the given client group, if any.
+ * lateness_cost
+ *     Cost of starting service at this client at a given time, if any.
  * name
  *     Free-form name field for this client.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When the lateness cost function is not monotonically increasing, or is
+ *     negative at ``tw_early``.
  */
 struct Client
 {
@@ -104,7 +132,9 @@ struct Client
     Cost const prize;                   // Prize for visiting this client
     bool const required;                // Must client be in solution?
     std::optional<size_t> const group;  // Optional client group membership
-    char const *name;                   // Client name (for reference)
+    std::optional<PiecewiseLinearFunction<int64_t, int64_t>> const
+        latenessCost;  // Optional cost of service start time
+    char const *name;  // Client name (for reference)
 
     Client(size_t location,
            std::vector<Load> delivery = {},
@@ -116,6 +146,8 @@ struct Client
            Cost prize = 0,
            bool required = true,
            std::optional<size_t> group = std::nullopt,
+           std::optional<PiecewiseLinearFunction<int64_t, int64_t>> latenessCost
+           = std::nullopt,
            std::string name = "");
 
     bool operator==(Client const &other) const;
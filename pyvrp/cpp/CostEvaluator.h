@@ -57,6 +57,16 @@ class CostEvaluator
     double twPenalty_;
     double distPenalty_;
 
+#ifdef PYVRP_OPERATOR_TIMING
+    mutable size_t numShortcuts_ = 0;
+#endif
+
+    /**
+     * Called when a delta cost evaluation returns early. Counts the shortcut
+     * when operator instrumentation is enabled, and always returns false.
+     */
+    inline bool shortcut() const;
+
     /**
      * Computes the cost penalty incurred from the given excess loads. This is
      * a convenient shorthand for calling ``loadPenalty`` for each dimension.
@@ -92,6 +102,13 @@ public:
      */
     [[nodiscard]] inline Cost excessDistPenalty(Distance excessDistance) const;
 
+    /**
+     * Returns the number of delta cost evaluations that returned early. This
+     * is only tracked when PyVRP is compiled with operator instrumentation
+     * enabled; it is always zero otherwise.
+     */
+    [[nodiscard]] inline size_t numShortcuts() const;
+
     /**
      * Computes a smoothed objective (penalised cost) for a given solution.
      */
@@ -108,8 +125,9 @@ public:
      * :math:`c^\text{overtime}_R`, respectively. Let :math:`V` be the set of
      * clients and shipments, and :math:`V_R \subseteq V` those serviced by
      * route :math:`R`. Finally, let :math:`d_R`, :math:`t_R`, and :math:`o_R`
-     * be the total route distance, duration, and overtime, respectively. The
-     * objective value is then given by
+     * be the total route distance, duration, and overtime, respectively, and
+     * :math:`\ell_R` the route's lateness cost. The objective value is then
+     * given by
      *
      * .. math::
      *
@@ -118,12 +136,13 @@ public:
      *          f_R + c^\text{distance}_R d_R
      *              + c^\text{duration}_R t_R
      *              + c^\text{overtime}_R o_R
+     *              + \ell_R
      *      \right]
      *    + \sum_{i \in V} p_i - \sum_{R \in \mathcal{R}} \sum_{i \in V_R} p_i,
      *
-     * where the first part lists each route's fixed, distance, duration and
-     * overtime costs, respectively, and the second part the uncollected prizes
-     * of unplanned clients and shipments.
+     * where the first part lists each route's fixed, distance, duration,
+     * overtime, and lateness costs, respectively, and the second part the
+     * uncollected prizes of unplanned clients and shipments.
      *
      * .. note::
      *
@@ -172,6 +191,23 @@ public:
                    T<vArgs...> const &vProposal) const;
 };
 
+bool CostEvaluator::shortcut() const
+{
+#ifdef PYVRP_OPERATOR_TIMING
+    numShortcuts_++;
+#endif
+    return false;
+}
+
+size_t CostEvaluator::numShortcuts() const
+{
+#ifdef PYVRP_OPERATOR_TIMING
+    return numShortcuts_;
+#else
+    return 0;
+#endif
+}
+
 Cost CostEvaluator::excessLoadPenalties(
     std::vector<Load> const &excessLoads) const
 {
@@ -238,7 +274,7 @@ bool CostEvaluator::deltaCost(Cost &out, T<Args...> const &proposal) const
     {
         if constexpr (!exact)
             if (out >= 0)
-                return false;
+                return shortcut();
 
         out += loadPenalty(proposal.excessLoad(dim), 0, dim);
     }
@@ -292,7 +328,7 @@ bool CostEvaluator::deltaCost(Cost &out,
     {
         if constexpr (!exact)
             if (out >= 0)
-                return false;
+                return shortcut();
 
         out += loadPenalty(uProposal.excessLoad(dim), 0, dim);
     }
@@ -302,14 +338,14 @@ bool CostEvaluator::deltaCost(Cost &out,
     {
         if constexpr (!exact)
             if (out >= 0)
-                return false;
+                return shortcut();
 
         out += loadPenalty(vProposal.excessLoad(dim), 0, dim);
     }
 
     if constexpr (!exact)
         if (out >= 0)
-            return false;
+            return shortcut();
 
     if (uRoute->hasDurationCost())
     {
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
@@ -11,9 +12,14 @@ namespace pyvrp
 {
 template <typename T> class Matrix
 {
-    size_t cols_ = 0;           // The number of columns of the matrix
-    size_t rows_ = 0;           // The number of rows of the matrix
-    std::vector<T> data_ = {};  // Data vector
+    size_t cols_ = 0;                 // The number of columns of the matrix
+    size_t rows_ = 0;                 // The number of rows of the matrix
+    std::vector<T> data_ = {};        // Data vector, if data is owned
+    std::shared_ptr<T> shared_ = {};  // Shared data, if data is not owned
+    T *elems_ = nullptr;              // Points into data_ or shared_
+
+    // Points elems_ to the storage that's in use.
+    void setElems();
 
 public:
     Matrix() = default;  // default is an empty matrix
@@ -30,16 +36,34 @@ public:
 
     explicit Matrix(std::vector<T> &&data, size_t nRows, size_t nCols);
 
-    bool operator==(Matrix const &other) const = default;
+    /**
+     * Creates a matrix of size nRows * nCols that shares the given data,
+     * rather than owning a copy of it. The data must contain nRows * nCols
+     * elements, and is kept alive for as long as this matrix or any of its
+     * copies exist. Copies share the same data.
+     *
+     * @param data  Shared data, for example memory-mapped from a file.
+     * @param nRows Number of rows.
+     * @param nCols Number of columns.
+     */
+    explicit Matrix(std::shared_ptr<T> data, size_t nRows, size_t nCols);
+
+    Matrix(Matrix const &other);
+    Matrix(Matrix &&other) noexcept;
+
+    Matrix &operator=(Matrix const &other);
+    Matrix &operator=(Matrix &&other) noexcept;
+
+    bool operator==(Matrix const &other) const;
 
     [[nodiscard]] decltype(auto) operator()(size_t row, size_t col);
     [[nodiscard]] decltype(auto) operator()(size_t row, size_t col) const;
 
-    typename std::vector<T>::const_iterator begin() const;
-    typename std::vector<T>::const_iterator end() const;
+    T const *begin() const;
+    T const *end() const;
 
-    typename std::vector<T>::iterator begin();
-    typename std::vector<T>::iterator end();
+    T *begin();
+    T *end();
 
     [[nodiscard]] T *data();
     [[nodiscard]] T const *data() const;
@@ -48,6 +72,26 @@ public:
 
     [[nodiscard]] size_t numRows() const;
 
+    /**
+     * @return True if this matrix shares its data, false if it owns the data.
+     */
+    [[nodiscard]] bool isShared() const;
+
+    /**
+     * @return True if this matrix is square and equal to its transpose.
+     */
+    [[nodiscard]] bool isSymmetric() const;
+
+    /**
+     * Returns the square submatrix of the given rows and columns, in the given
+     * order. Entry (i, j) of the submatrix is entry (indices[i], indices[j])
+     * of this matrix.
+     *
+     * @param indices Indices of the rows and columns to select.
+     * @return A new matrix of size indices.size() * indices.size().
+     */
+    [[nodiscard]] Matrix submatrix(std::vector<size_t> const &indices) const;
+
     /**
      * @return Maximum element in the matrix.
      */
@@ -59,10 +103,16 @@ public:
     [[nodiscard]] size_t size() const;
 };
 
+template <typename T> void Matrix<T>::setElems()
+{
+    elems_ = shared_ ? shared_.get() : data_.data();
+}
+
 template <typename T>
 Matrix<T>::Matrix(size_t nRows, size_t nCols, T value)
     : cols_(nCols), rows_(nRows), data_(nRows * nCols, value)
 {
+    setElems();
 }
 
 template <typename T>
@@ -70,55 +120,146 @@ Matrix<T>::Matrix(std::vector<T> &&data, size_t nRows, size_t nCols)
     : cols_(nCols), rows_(nRows), data_(std::forward<std::vector<T>>(data))
 {
     assert(cols_ * rows_ == data_.size());
+    setElems();
 }
 
 template <typename T>
-decltype(auto) Matrix<T>::operator()(size_t row, size_t col)
+Matrix<T>::Matrix(std::shared_ptr<T> data, size_t nRows, size_t nCols)
+    : cols_(nCols), rows_(nRows), shared_(std::move(data))
 {
-    return data_[cols_ * row + col];
+    assert(shared_ || cols_ * rows_ == 0);
+    setElems();
 }
 
 template <typename T>
-decltype(auto) Matrix<T>::operator()(size_t row, size_t col) const
+Matrix<T>::Matrix(Matrix const &other)
+    : cols_(other.cols_),
+      rows_(other.rows_),
+      data_(other.data_),
+      shared_(other.shared_)
 {
-    return data_[cols_ * row + col];
+    setElems();
 }
 
 template <typename T>
-typename std::vector<T>::const_iterator Matrix<T>::begin() const
+Matrix<T>::Matrix(Matrix &&other) noexcept
+    : cols_(other.cols_),
+      rows_(other.rows_),
+      data_(std::move(other.data_)),
+      shared_(std::move(other.shared_))
+{
+    setElems();
+
+    other.cols_ = 0;
+    other.rows_ = 0;
+    other.data_.clear();
+    other.setElems();
+}
+
+template <typename T> Matrix<T> &Matrix<T>::operator=(Matrix const &other)
 {
-    return data_.begin();
+    if (this != &other)
+    {
+        cols_ = other.cols_;
+        rows_ = other.rows_;
+        data_ = other.data_;
+        shared_ = other.shared_;
+        setElems();
+    }
+
+    return *this;
+}
+
+template <typename T> Matrix<T> &Matrix<T>::operator=(Matrix &&other) noexcept
+{
+    if (this != &other)
+    {
+        cols_ = other.cols_;
+        rows_ = other.rows_;
+        data_ = std::move(other.data_);
+        shared_ = std::move(other.shared_);
+        setElems();
+
+        other.cols_ = 0;
+        other.rows_ = 0;
+        other.data_.clear();
+        other.setElems();
+    }
+
+    return *this;
+}
+
+template <typename T> bool Matrix<T>::operator==(Matrix const &other) const
+{
+    return cols_ == other.cols_ && rows_ == other.rows_
+           && std::equal(begin(), end(), other.begin());
 }
 
 template <typename T>
-typename std::vector<T>::const_iterator Matrix<T>::end() const
+decltype(auto) Matrix<T>::operator()(size_t row, size_t col)
 {
-    return data_.end();
+    return elems_[cols_ * row + col];
 }
 
-template <typename T> typename std::vector<T>::iterator Matrix<T>::begin()
+template <typename T>
+decltype(auto) Matrix<T>::operator()(size_t row, size_t col) const
 {
-    return data_.begin();
+    return elems_[cols_ * row + col];
 }
 
-template <typename T> typename std::vector<T>::iterator Matrix<T>::end()
+template <typename T> T const *Matrix<T>::begin() const { return elems_; }
+
+template <typename T> T const *Matrix<T>::end() const
 {
-    return data_.end();
+    return elems_ + size();
 }
 
-template <typename T> T *Matrix<T>::data() { return data_.data(); }
-template <typename T> T const *Matrix<T>::data() const { return data_.data(); }
+template <typename T> T *Matrix<T>::begin() { return elems_; }
+
+template <typename T> T *Matrix<T>::end() { return elems_ + size(); }
+
+template <typename T> T *Matrix<T>::data() { return elems_; }
+template <typename T> T const *Matrix<T>::data() const { return elems_; }
 
 template <typename T> size_t Matrix<T>::numCols() const { return cols_; }
 
 template <typename T> size_t Matrix<T>::numRows() const { return rows_; }
 
+template <typename T> bool Matrix<T>::isShared() const
+{
+    return static_cast<bool>(shared_);
+}
+
+template <typename T> bool Matrix<T>::isSymmetric() const
+{
+    if (rows_ != cols_)
+        return false;
+
+    for (size_t row = 0; row != rows_; ++row)
+        for (size_t col = row + 1; col != cols_; ++col)
+            if ((*this)(row, col) != (*this)(col, row))
+                return false;
+
+    return true;
+}
+
+template <typename T>
+Matrix<T> Matrix<T>::submatrix(std::vector<size_t> const &indices) const
+{
+    Matrix<T> sub(indices.size(), indices.size());
+    for (size_t row = 0; row != indices.size(); ++row)
+        for (size_t col = 0; col != indices.size(); ++col)
+            sub(row, col) = (*this)(indices[row], indices[col]);
+
+    return sub;
+}
+
 template <typename T> T Matrix<T>::max() const
 {
-    return *std::max_element(data_.begin(), data_.end());
+    return *std::max_element(begin(), end());
 }
 
-template <typename T> size_t Matrix<T>::size() const { return data_.size(); }
+template <typename T> size_t Matrix<T>::size() const { return rows_ * cols_; }
 }  // namespace pyvrp
 
 #endif  // PYVRP_MATRIX_H
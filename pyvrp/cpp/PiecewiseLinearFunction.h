@@ -2,7 +2,11 @@
 #define PYVRP_PIECEWISELINEARFUNCTION_H
 
 #include <algorithm>
+#include <bit>
 #include <cassert>
+#include <concepts>
+#include <limits>
+#include <span>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -55,8 +59,46 @@ public:
     using Point = std::pair<Dom, Co>;
 
 private:
-    std::vector<Dom> breakpoints_;
-    std::vector<Segment> segments_;
+    // Functions with at most this many breakpoints are evaluated using a
+    // linear scan over the pieces, rather than a binary search. Such scans are
+    // branch-free, and faster than a search for small numbers of breakpoints.
+    static constexpr size_t LINEAR_SCAN_SIZE = 16;
+
+    // Breakpoint and segment coefficients, interleaved so that evaluating the
+    // function touches a single cache line for small functions. The first
+    // piece's lower bound is not a breakpoint, and is never used.
+    struct Piece
+    {
+        Dom lower;
+        Dom intercept;
+        Dom slope;
+
+        bool operator==(Piece const &other) const = default;
+    };
+
+    std::vector<Piece> pieces_;
+
+    // Breakpoints in Eytzinger (breadth-first) order, with their index in the
+    // sorted breakpoints. Position zero is unused. This is only populated for
+    // functions with more than LINEAR_SCAN_SIZE breakpoints.
+    std::vector<std::pair<Dom, size_t>> eytzinger_;
+
+    // Sets up the pieces and search structure. Assumes valid arguments.
+    void build(std::vector<Dom> const &breakpoints,
+               std::vector<Segment> const &segments);
+
+    // Returns the index of the piece that contains the given point.
+    [[nodiscard]] inline size_t index(Dom x) const;
+
+    // Rounds a / b towards negative infinity.
+    [[nodiscard]] static Dom floorDiv(Dom a, Dom b);
+
+    // Builds a function from candidate breakpoints that include at least all
+    // breakpoints of the function, and a callable that returns the segment at
+    // a given point. Redundant candidates are removed.
+    template <typename SegmentAt>
+    [[nodiscard]] static PiecewiseLinearFunction
+    fromCandidates(std::vector<Dom> candidates, SegmentAt const &segmentAt);
 
 public:
     // Construct from points.
@@ -71,24 +113,179 @@ public:
      */
     [[nodiscard]] inline Co operator()(Dom x) const;
 
+    /**
+     * Evaluates :math:`f(x)` for each of the given points. This is faster than
+     * evaluating each point separately.
+     *
+     * Parameters
+     * ----------
+     * x
+     *     Array of points to evaluate.
+     *
+     * Returns
+     * -------
+     * numpy.ndarray[int]
+     *     Array of function values, one for each point.
+     */
+    void evaluate(std::span<Dom const> x, std::span<Co> out) const;
+
+    /**
+     * Returns the composition :math:`f \circ g` of this function :math:`f`
+     * and the given inner function :math:`g`. The composed function is exact
+     * for integral arguments, but its breakpoints may not coincide with those
+     * of :math:`f` and :math:`g`.
+     *
+     * Parameters
+     * ----------
+     * inner
+     *     Inner function :math:`g`.
+     *
+     * Returns
+     * -------
+     * PiecewiseLinearFunction
+     *     The function :math:`x \mapsto f(g(x))`.
+     */
+    [[nodiscard]] PiecewiseLinearFunction
+    compose(PiecewiseLinearFunction const &inner) const
+        requires std::integral<Dom> && std::same_as<Dom, Co>;
+
+    /**
+     * Returns the pointwise minimum of this function :math:`f` and the given
+     * other function :math:`g`. The minimum is exact for integral arguments.
+     *
+     * Parameters
+     * ----------
+     * other
+     *     Other function :math:`g`.
+     *
+     * Returns
+     * -------
+     * PiecewiseLinearFunction
+     *     The function :math:`x \mapsto \min\{ f(x), g(x) \}`.
+     */
+    [[nodiscard]] PiecewiseLinearFunction
+    minimum(PiecewiseLinearFunction const &other) const
+        requires std::integral<Dom>;
+
     /**
      * Breakpoints.
      */
-    [[nodiscard]] std::vector<Dom> const &breakpoints() const;
+    [[nodiscard]] std::vector<Dom> breakpoints() const;
 
     /**
      * Segment (intercept, slope) coefficients.
      */
-    [[nodiscard]] std::vector<Segment> const &segments() const;
+    [[nodiscard]] std::vector<Segment> segments() const;
 
     /**
      * Returns whether this function is monotonically increasing.
      */
     [[nodiscard]] bool isMonotonicallyIncreasing() const;
 
-    bool operator==(PiecewiseLinearFunction const &other) const = default;
+    bool operator==(PiecewiseLinearFunction const &other) const;
 };
 
+template <typename Dom, typename Co>
+void PiecewiseLinearFunction<Dom, Co>::build(
+    std::vector<Dom> const &breakpoints, std::vector<Segment> const &segments)
+{
+    assert(!segments.empty());
+    assert(breakpoints.size() + 1 == segments.size());
+
+    pieces_.clear();
+    pieces_.reserve(segments.size());
+    for (size_t idx = 0; idx != segments.size(); ++idx)
+    {
+        auto const lower = idx == 0 ? std::numeric_limits<Dom>::lowest()
+                                    : breakpoints[idx - 1];
+        auto const [intercept, slope] = segments[idx];
+        pieces_.push_back({lower, intercept, slope});
+    }
+
+    eytzinger_.clear();
+    if (breakpoints.size() <= LINEAR_SCAN_SIZE)
+        return;
+
+    // In-order traversal of the implicit binary tree, where the children of
+    // node k are nodes 2k and 2k + 1, assigns the sorted breakpoints to nodes.
+    eytzinger_.resize(breakpoints.size() + 1);
+    size_t sortedIdx = 0;
+    auto const fill = [&](auto const &self, size_t node) -> void
+    {
+        if (node >= eytzinger_.size())
+            return;
+
+        self(self, 2 * node);
+        eytzinger_[node] = {breakpoints[sortedIdx], sortedIdx};
+        sortedIdx++;
+        self(self, 2 * node + 1);
+    };
+
+    fill(fill, 1);
+}
+
+template <typename Dom, typename Co>
+size_t PiecewiseLinearFunction<Dom, Co>::index(Dom x) const
+{
+    if (eytzinger_.empty())  // linear scan: count breakpoints not exceeding x
+    {
+        size_t idx = 0;
+        for (size_t piece = 1; piece < pieces_.size(); ++piece)
+            idx += pieces_[piece].lower <= x;
+
+        return idx;
+    }
+
+    // Descend the tree towards the first breakpoint that exceeds x. The final
+    // right turns are then undone to recover that breakpoint's node, which is
+    // zero if no breakpoint exceeds x.
+    size_t node = 1;
+    while (node < eytzinger_.size())
+        node = 2 * node + (eytzinger_[node].first <= x);
+
+    node >>= std::countr_one(node) + 1;
+    return node == 0 ? pieces_.size() - 1 : eytzinger_[node].second;
+}
+
+template <typename Dom, typename Co>
+Dom PiecewiseLinearFunction<Dom, Co>::floorDiv(Dom a, Dom b)
+{
+    auto const quotient = a / b;
+    auto const roundedUp = (a % b != 0) && ((a < 0) != (b < 0));
+    return roundedUp ? quotient - 1 : quotient;
+}
+
+template <typename Dom, typename Co>
+template <typename SegmentAt>
+PiecewiseLinearFunction<Dom, Co>
+PiecewiseLinearFunction<Dom, Co>::fromCandidates(std::vector<Dom> candidates,
+                                                 SegmentAt const &segmentAt)
+{
+    std::sort(candidates.begin(), candidates.end());
+    auto const last = std::unique(candidates.begin(), candidates.end());
+    candidates.erase(last, candidates.end());
+
+    // The function is linear between consecutive candidates, so it can be
+    // evaluated at a single point in each interval. For the interval before
+    // the first candidate, that point is just before the candidate.
+    auto const first = candidates.empty() ? Dom{0} : candidates[0] - 1;
+
+    std::vector<Dom> breakpoints;
+    std::vector<Segment> segments = {segmentAt(first, true)};
+
+    for (auto const candidate : candidates)
+    {
+        auto const segment = segmentAt(candidate, false);
+        if (segment != segments.back())
+        {
+            breakpoints.push_back(candidate);
+            segments.push_back(segment);
+        }
+    }
+
+    return {std::move(breakpoints), std::move(segments)};
+}
+
 template <typename Dom, typename Co>
 PiecewiseLinearFunction<Dom, Co>::PiecewiseLinearFunction(
     std::vector<Point> points)
@@ -104,6 +301,9 @@ PiecewiseLinearFunction<Dom, Co>::PiecewiseLinearFunction(
         throw std::invalid_argument(
             "Last two points must have distinct x-coordinates.");
 
+    std::vector<Dom> breakpoints;
+    std::vector<Segment> segments;
+
     for (size_t idx = 0; idx + 1 != points.size(); ++idx)
     {
         auto const curr = points[idx];
@@ -122,73 +322,198 @@ PiecewiseLinearFunction<Dom, Co>::PiecewiseLinearFunction(
             throw std::invalid_argument("Slope is not integral.");
 
         if (idx != 0)  // breakpoints separate segments
-            breakpoints_.push_back(curr.first);
+            breakpoints.push_back(curr.first);
 
         auto const slope = dy / dx;
         auto const intercept = curr.second - slope * curr.first;
-        segments_.emplace_back(intercept, slope);
+        segments.emplace_back(intercept, slope);
     }
 
-    assert(!segments_.empty());
-    assert(breakpoints_.size() + 1 == segments_.size());
+    build(breakpoints, segments);
 }
 
 template <typename Dom, typename Co>
 PiecewiseLinearFunction<Dom, Co>::PiecewiseLinearFunction(
     std::vector<Dom> breakpoints, std::vector<Segment> segments)
-    : breakpoints_(std::move(breakpoints)), segments_(std::move(segments))
 {
-    if (segments_.empty())
+    if (segments.empty())
         throw std::invalid_argument("Need at least one segment.");
 
-    if (breakpoints_.size() + 1 != segments_.size())
+    if (breakpoints.size() + 1 != segments.size())
         throw std::invalid_argument("Need one more segment than breakpoints.");
 
-    for (size_t idx = 0; idx + 1 < breakpoints_.size(); ++idx)
-        if (breakpoints_[idx] >= breakpoints_[idx + 1])
+    for (size_t idx = 0; idx + 1 < breakpoints.size(); ++idx)
+        if (breakpoints[idx] >= breakpoints[idx + 1])
             throw std::invalid_argument(
                 "Breakpoints must be strictly increasing.");
+
+    build(breakpoints, segments);
 }
 
 template <typename Dom, typename Co>
 Co PiecewiseLinearFunction<Dom, Co>::operator()(Dom x) const
 {
-    auto const idx = std::distance(
-        breakpoints_.begin(),
-        std::upper_bound(breakpoints_.begin(), breakpoints_.end(), x));
+    auto const &piece = pieces_[index(x)];
+    return static_cast<Co>(piece.intercept + piece.slope * x);
+}
+
+template <typename Dom, typename Co>
+void PiecewiseLinearFunction<Dom, Co>::evaluate(std::span<Dom const> x,
+                                                std::span<Co> out) const
+{
+    if (x.size() != out.size())
+        throw std::invalid_argument("Argument and output sizes differ.");
 
-    auto const [intercept, slope] = segments_[idx];
-    return static_cast<Co>(intercept + slope * x);
+    if (!eytzinger_.empty())
+    {
+        for (size_t idx = 0; idx != x.size(); ++idx)
+            out[idx] = (*this)(x[idx]);
+
+        return;
+    }
+
+    // Few pieces, so we sweep each piece over all points. The loops below
+    // contain no branches or data-dependent loads, so compilers can vectorise
+    // them on targets that support 64-bit integer SIMD.
+    auto const &first = pieces_[0];
+    for (size_t idx = 0; idx != x.size(); ++idx)
+        out[idx] = static_cast<Co>(first.intercept + first.slope * x[idx]);
+
+    for (size_t piece = 1; piece < pieces_.size(); ++piece)
+    {
+        auto const [lower, intercept, slope] = pieces_[piece];
+        for (size_t idx = 0; idx != x.size(); ++idx)
+        {
+            auto const value = static_cast<Co>(intercept + slope * x[idx]);
+            out[idx] = x[idx] >= lower ? value : out[idx];
+        }
+    }
 }
 
 template <typename Dom, typename Co>
-std::vector<Dom> const &PiecewiseLinearFunction<Dom, Co>::breakpoints() const
+PiecewiseLinearFunction<Dom, Co> PiecewiseLinearFunction<Dom, Co>::compose(
+    PiecewiseLinearFunction const &inner) const
+    requires std::integral<Dom> && std::same_as<Dom, Co>
 {
-    return breakpoints_;
+    // The composition changes segments at the inner function's breakpoints,
+    // and where the inner function crosses one of our breakpoints. For a
+    // linear piece a + s x of the inner function, that happens between
+    // floor((b - a) / s) and the next integer.
+    auto candidates = inner.breakpoints();
+    for (auto const &innerPiece : inner.pieces_)
+    {
+        if (innerPiece.slope == 0)
+            continue;
+
+        for (size_t piece = 1; piece < pieces_.size(); ++piece)
+        {
+            auto const diff = pieces_[piece].lower - innerPiece.intercept;
+            auto const crossing = floorDiv(diff, innerPiece.slope);
+            candidates.push_back(crossing);
+            candidates.push_back(crossing + 1);
+        }
+    }
+
+    auto const segmentAt = [&](Dom x, bool)
+    {
+        auto const &innerPiece = inner.pieces_[inner.index(x)];
+        auto const &outerPiece = pieces_[index(inner(x))];
+
+        auto const intercept = outerPiece.intercept
+                               + outerPiece.slope * innerPiece.intercept;
+        auto const slope = outerPiece.slope * innerPiece.slope;
+        return Segment{intercept, slope};
+    };
+
+    return fromCandidates(std::move(candidates), segmentAt);
+}
+
+template <typename Dom, typename Co>
+PiecewiseLinearFunction<Dom, Co> PiecewiseLinearFunction<Dom, Co>::minimum(
+    PiecewiseLinearFunction const &other) const
+    requires std::integral<Dom>
+{
+    // The minimum changes segments at the breakpoints of either function, and
+    // where two segments with different slopes intersect.
+    auto candidates = breakpoints();
+    auto const otherBreakpoints = other.breakpoints();
+    candidates.insert(
+        candidates.end(), otherBreakpoints.begin(), otherBreakpoints.end());
+
+    for (auto const &ours : pieces_)
+        for (auto const &theirs : other.pieces_)
+        {
+            if (ours.slope == theirs.slope)
+                continue;
+
+            auto const crossing = floorDiv(theirs.intercept - ours.intercept,
+                                           ours.slope - theirs.slope);
+            candidates.push_back(crossing);
+            candidates.push_back(crossing + 1);
+        }
+
+    auto const segmentAt = [&](Dom x, bool beforeFirst)
+    {
+        auto const &ours = pieces_[index(x)];
+        auto const &theirs = other.pieces_[other.index(x)];
+
+        auto const ourValue = ours.intercept + ours.slope * x;
+        auto const theirValue = theirs.intercept + theirs.slope * x;
+
+        // If both values are equal at x, then the minimum on the rest of the
+        // interval has the smaller slope, or the larger slope if the interval
+        // extends to the left of x.
+        auto const oursIsMin
+            = ourValue != theirValue
+                  ? ourValue < theirValue
+                  : (ours.slope < theirs.slope) != beforeFirst;
+
+        auto const &min = oursIsMin ? ours : theirs;
+        return Segment{min.intercept, min.slope};
+    };
+
+    return fromCandidates(std::move(candidates), segmentAt);
 }
 
 template <typename Dom, typename Co>
-std::vector<typename PiecewiseLinearFunction<Dom, Co>::Segment> const &
+std::vector<Dom> PiecewiseLinearFunction<Dom, Co>::breakpoints() const
+{
+    std::vector<Dom> breakpoints;
+    breakpoints.reserve(pieces_.size() - 1);
+
+    for (size_t idx = 1; idx < pieces_.size(); ++idx)
+        breakpoints.push_back(pieces_[idx].lower);
+
+    return breakpoints;
+}
+
+template <typename Dom, typename Co>
+std::vector<typename PiecewiseLinearFunction<Dom, Co>::Segment>
 PiecewiseLinearFunction<Dom, Co>::segments() const
 {
-    return segments_;
+    std::vector<Segment> segments;
+    segments.reserve(pieces_.size());
+
+    for (auto const &piece : pieces_)
+        segments.emplace_back(piece.intercept, piece.slope);
+
+    return segments;
 }
 
 template <typename Dom, typename Co>
 bool PiecewiseLinearFunction<Dom, Co>::isMonotonicallyIncreasing() const
 {
-    for (auto const &[_, slope] : segments_)
-        if (slope < 0)
+    for (auto const &piece : pieces_)
+        if (piece.slope < 0)
             return false;
 
-    for (size_t idx = 0; idx != breakpoints_.size(); ++idx)
+    for (size_t idx = 1; idx < pieces_.size(); ++idx)
     {
-        auto const breakpoint = breakpoints_[idx];
-        auto const [prevIntercept, prevSlope] = segments_[idx];
-        auto const [nextIntercept, nextSlope] = segments_[idx + 1];
+        auto const &prev = pieces_[idx - 1];
+        auto const &next = pieces_[idx];
 
-        auto const left = prevIntercept + prevSlope * breakpoint;
-        auto const right = nextIntercept + nextSlope * breakpoint;
+        auto const left = prev.intercept + prev.slope * next.lower;
+        auto const right = next.intercept + next.slope * next.lower;
 
         if (right < left)
             return false;
@@ -196,6 +521,13 @@ bool PiecewiseLinearFunction<Dom, Co>::isMonotonicallyIncreasing() const
 
     return true;
 }
+
+template <typename Dom, typename Co>
+bool PiecewiseLinearFunction<Dom, Co>::operator==(
+    PiecewiseLinearFunction const &other) const
+{
+    return pieces_ == other.pieces_;  // the search structure follows from the
+}                                     // pieces, so need not be compared.
 }  // namespace pyvrp
 
 #endif  // PYVRP_PIECEWISELINEARFUNCTION_H
@@ -1,12 +1,17 @@
 #include "ProblemData.h"
+#include "BinaryFormat.h"
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <numeric>
 #include <stdexcept>
+#include <variant>
 
 using pyvrp::Client;
 using pyvrp::ClientGroup;
+using pyvrp::Coordinate;
+using pyvrp::Cost;
 using pyvrp::Depot;
 using pyvrp::Distance;
 using pyvrp::Duration;
@@ -14,9 +19,13 @@ using pyvrp::Load;
 using pyvrp::Location;
 using pyvrp::Matrix;
 using pyvrp::ProblemData;
+using pyvrp::ProfileMatrix;
 using pyvrp::Shipment;
+using pyvrp::SymmetricMatrix;
 using pyvrp::VehicleType;
 
+using LatenessCost = pyvrp::PiecewiseLinearFunction<int64_t, int64_t>;
+
 namespace
 {
 // Small helper that determines if the time windows of a and b overlap.
@@ -36,6 +45,143 @@ bool hasTimeWindow(auto const &arg)
 
     return hasTw;
 }
+
+bool hasLatenessCost(auto const &arg) { return arg.latenessCost.has_value(); }
+
+// Writes an optional lateness cost function via its breakpoints and segments.
+void writeLatenessCost(pyvrp::binary::Writer &writer,
+                       std::optional<LatenessCost> const &cost)
+{
+    writer.write(cost.has_value());
+    if (cost)
+    {
+        writer.write(cost->breakpoints());
+        writer.write(cost->segments());
+    }
+}
+
+std::optional<LatenessCost> readLatenessCost(pyvrp::binary::Reader &reader)
+{
+    if (!reader.read<bool>())
+        return std::nullopt;
+
+    auto breakpoints = reader.read<std::vector<int64_t>>();
+    auto segments = reader.read<std::vector<LatenessCost::Segment>>();
+    return LatenessCost(std::move(breakpoints), std::move(segments));
+}
+
+template <typename T>
+void writeMatrix(pyvrp::binary::Writer &writer, Matrix<T> const &matrix)
+{
+    static_assert(sizeof(T) == sizeof(int64_t));
+
+    writer.write(matrix.numRows());
+    writer.write(matrix.numCols());
+    writer.align();
+    writer.writeBytes(matrix.data(), matrix.size() * sizeof(T));
+}
+
+// Symmetric matrices are written in full, one row at a time, so the format
+// does not depend on how the matrix is stored.
+template <typename T>
+void writeMatrix(pyvrp::binary::Writer &writer,
+                 SymmetricMatrix<T> const &matrix)
+{
+    static_assert(sizeof(T) == sizeof(int64_t));
+
+    writer.write(matrix.numRows());
+    writer.write(matrix.numCols());
+    writer.align();
+
+    std::vector<T> row(matrix.numCols());
+    for (size_t frm = 0; frm != matrix.numRows(); ++frm)
+    {
+        for (size_t to = 0; to != matrix.numCols(); ++to)
+            row[to] = matrix(frm, to);
+
+        writer.writeBytes(row.data(), row.size() * sizeof(T));
+    }
+}
+
+// Reads a matrix from the given buffer. If a file is given, the buffer is a
+// mapping of that file, and the returned matrix shares the mapped data rather
+// than copying it.
+template <typename T>
+Matrix<T> readMatrix(pyvrp::binary::Reader &reader,
+                     char *buffer,
+                     std::shared_ptr<pyvrp::binary::MappedFile> const &file)
+{
+    auto const nRows = reader.read<size_t>();
+    auto const nCols = reader.read<size_t>();
+    reader.align();
+
+    auto constexpr maxSize = std::numeric_limits<size_t>::max() / sizeof(T);
+    if (nCols != 0 && nRows > maxSize / nCols)
+        throw std::invalid_argument("Unexpected end of file.");
+
+    auto const size = nRows * nCols;
+    auto *elems = buffer + reader.skip(size * sizeof(T));
+
+    if (file)  // aliases the mapped data, and keeps the mapping alive
+        return Matrix<T>(std::shared_ptr<T>(file, reinterpret_cast<T *>(elems)),
+                         nRows,
+                         nCols);
+
+    std::vector<T> data(size);
+    std::memcpy(data.data(), elems, size * sizeof(T));
+    return Matrix<T>(std::move(data), nRows, nCols);
+}
+
+// Returns the given matrices, storing only the upper triangle of symmetric
+// matrices. Shared matrices are returned as-is, since packing them would copy
+// data that is, for example, memory-mapped from a file.
+template <typename T>
+std::vector<ProfileMatrix<T>> pack(std::vector<ProfileMatrix<T>> mats)
+{
+    for (auto &mat : mats)
+    {
+        auto const *full = std::get_if<Matrix<T>>(&mat);
+        if (full && !full->isShared() && full->isSymmetric())
+            mat = SymmetricMatrix<T>(*full);
+    }
+
+    return mats;
+}
+
+// Returns whether the given matrices have the same shape and entries,
+// regardless of how they are stored.
+template <typename T>
+bool equal(ProfileMatrix<T> const &lhs, ProfileMatrix<T> const &rhs)
+{
+    if (lhs.index() == rhs.index())  // then the storage is directly comparable
+        return lhs == rhs;
+
+    auto const entriesEqual = [](auto const &lhs, auto const &rhs)
+    {
+        if (lhs.numRows() != rhs.numRows() || lhs.numCols() != rhs.numCols())
+            return false;
+
+        for (size_t row = 0; row != lhs.numRows(); ++row)
+            for (size_t col = 0; col != lhs.numCols(); ++col)
+                if (lhs(row, col) != rhs(row, col))
+                    return false;
+
+        return true;
+    };
+
+    return std::visit(entriesEqual, lhs, rhs);
+}
+
+template <typename T>
+bool equal(std::vector<ProfileMatrix<T>> const &lhs,
+           std::vector<ProfileMatrix<T>> const &rhs)
+{
+    auto const pred = [](auto const &lhs, auto const &rhs)
+    { return equal(lhs, rhs); };
+
+    return lhs.size() == rhs.size()
+           && std::equal(lhs.begin(), lhs.end(), rhs.begin(), pred);
+}
 }  // namespace
 
 std::vector<Location> const &ProblemData::locations() const
@@ -59,12 +205,14 @@ std::vector<VehicleType> const &ProblemData::vehicleTypes() const
     return vehicleTypes_;
 }
 
-std::vector<Matrix<Distance>> const &ProblemData::distanceMatrices() const
+std::vector<ProfileMatrix<Distance>> const &
+ProblemData::distanceMatrices() const
 {
     return dists_;
 }
 
-std::vector<Matrix<Duration>> const &ProblemData::durationMatrices() const
+std::vector<ProfileMatrix<Duration>> const &
+ProblemData::durationMatrices() const
 {
     return durs_;
 }
@@ -87,6 +235,40 @@ VehicleType const &ProblemData::vehicleType(size_t vehicleType) const
     return vehicleTypes_[vehicleType];
 }
 
+Matrix<Distance>
+ProblemData::distanceSubmatrix(size_t profile,
+                               std::vector<size_t> const &locations) const
+{
+    if (profile >= numProfiles())
+        throw std::out_of_range("Profile out of range.");
+
+    for (auto const location : locations)
+        if (location >= numLocations())
+            throw std::out_of_range("Location out of range.");
+
+    auto const submatrix = [&](auto const &mat)
+    { return mat.submatrix(locations); };
+
+    return std::visit(submatrix, dists_[profile]);
+}
+
+Matrix<Duration>
+ProblemData::durationSubmatrix(size_t profile,
+                               std::vector<size_t> const &locations) const
+{
+    if (profile >= numProfiles())
+        throw std::out_of_range("Profile out of range.");
+
+    for (auto const location : locations)
+        if (location >= numLocations())
+            throw std::out_of_range("Location out of range.");
+
+    auto const submatrix = [&](auto const &mat)
+    { return mat.submatrix(locations); };
+
+    return std::visit(submatrix, durs_[profile]);
+}
+
 size_t ProblemData::numClients() const { return clients_.size(); }
 
 size_t ProblemData::numDepots() const { return depots_.size(); }
@@ -243,27 +425,34 @@ void ProblemData::validate() const
     for (size_t idx = 0; idx != dists_.size(); ++idx)
     {
         auto const numLocs = numLocations();
-        auto const &dist = dists_[idx];
-        auto const &dur = durs_[idx];
+        auto const checkShape = [&](auto const &mat) {
+            return mat.numRows() == numLocs && mat.numCols() == numLocs;
+        };
 
-        if (dist.numRows() != numLocs || dist.numCols() != numLocs)
+        if (!std::visit(checkShape, dists_[idx]))
             throw std::invalid_argument("Distance matrix shape does not match "
                                         "the problem size.");
 
-        if (dur.numRows() != numLocs || dur.numCols() != numLocs)
+        if (!std::visit(checkShape, durs_[idx]))
             throw std::invalid_argument("Duration matrix shape does not match "
                                         "the problem size.");
 
-        for (size_t loc = 0; loc != numLocs; ++loc)
+        auto const checkDiagonal = [&](auto const &mat)
         {
-            if (dist(loc, loc) != 0)
-                throw std::invalid_argument("Distance matrix diagonals must be "
-                                            "all zero.");
+            for (size_t loc = 0; loc != numLocs; ++loc)
+                if (mat(loc, loc) != 0)
+                    return false;
 
-            if (dur(loc, loc) != 0)
-                throw std::invalid_argument("Duration matrix diagonals must be "
-                                            "all zero.");
-        }
+            return true;
+        };
+
+        if (!std::visit(checkDiagonal, dists_[idx]))
+            throw std::invalid_argument("Distance matrix diagonals must be "
+                                        "all zero.");
+
+        if (!std::visit(checkDiagonal, durs_[idx]))
+            throw std::invalid_argument("Duration matrix diagonals must be "
+                                        "all zero.");
     }
 }
 
@@ -272,8 +461,8 @@ ProblemData::replace(std::optional<std::vector<Location>> &locations,
                      std::optional<std::vector<Client>> &clients,
                      std::optional<std::vector<Depot>> &depots,
                      std::optional<std::vector<VehicleType>> &vehicleTypes,
-                     std::optional<std::vector<Matrix<Distance>>> &distMats,
-                     std::optional<std::vector<Matrix<Duration>>> &durMats,
+                     std::optional<std::vector<ProfileMatrix<Distance>>> &dists,
+                     std::optional<std::vector<ProfileMatrix<Duration>>> &durs,
                      std::optional<std::vector<ClientGroup>> &groups,
                      std::optional<std::vector<Shipment>> &shipments) const
 {
@@ -281,22 +470,368 @@ ProblemData::replace(std::optional<std::vector<Location>> &locations,
             clients.value_or(clients_),
             depots.value_or(depots_),
             vehicleTypes.value_or(vehicleTypes_),
-            distMats.value_or(dists_),
-            durMats.value_or(durs_),
+            dists.value_or(dists_),
+            durs.value_or(durs_),
             groups.value_or(groups_),
             shipments.value_or(shipments_)};
 }
 
+bool ProblemData::operator==(ProblemData const &other) const
+{
+    // clang-format off
+    return equal(dists_, other.dists_)
+        && equal(durs_, other.durs_)
+        && locations_ == other.locations_
+        && clients_ == other.clients_
+        && depots_ == other.depots_
+        && vehicleTypes_ == other.vehicleTypes_
+        && groups_ == other.groups_
+        && shipments_ == other.shipments_;
+    // clang-format on
+}
+
+ProblemData ProblemData::fromEdges(std::vector<Location> locations,
+                                   std::vector<Client> clients,
+                                   std::vector<Depot> depots,
+                                   std::vector<VehicleType> vehicleTypes,
+                                   std::vector<Edges> const &edges,
+                                   Distance missingDist,
+                                   Duration missingDur,
+                                   std::vector<ClientGroup> groups,
+                                   std::vector<Shipment> shipments)
+{
+    auto const numLocs = locations.size();
+
+    std::vector<ProfileMatrix<Distance>> distMats;
+    std::vector<ProfileMatrix<Duration>> durMats;
+    distMats.reserve(edges.size());
+    durMats.reserve(edges.size());
+
+    for (auto const &profile : edges)
+    {
+        auto const numEdges = profile.origins.size();
+        if (profile.destinations.size() != numEdges
+            || profile.distances.size() != numEdges
+            || profile.durations.size() != numEdges)
+            throw std::invalid_argument("Edge arrays must have equal length.");
+
+        Matrix<Distance> distMat(numLocs, numLocs, missingDist);
+        Matrix<Duration> durMat(numLocs, numLocs, missingDur);
+
+        for (size_t loc = 0; loc != numLocs; ++loc)
+        {
+            distMat(loc, loc) = 0;
+            durMat(loc, loc) = 0;
+        }
+
+        for (size_t idx = 0; idx != numEdges; ++idx)
+        {
+            auto const frm = profile.origins[idx];
+            auto const to = profile.destinations[idx];
+
+            if (frm >= numLocs || to >= numLocs)
+                throw std::out_of_range("Edge location out of range.");
+
+            distMat(frm, to) = profile.distances[idx];
+            durMat(frm, to) = profile.durations[idx];
+        }
+
+        distMats.emplace_back(std::move(distMat));
+        durMats.emplace_back(std::move(durMat));
+    }
+
+    return {std::move(locations),
+            std::move(clients),
+            std::move(depots),
+            std::move(vehicleTypes),
+            std::move(distMats),
+            std::move(durMats),
+            std::move(groups),
+            std::move(shipments)};
+}
+
+void ProblemData::save(std::filesystem::path const &path) const
+{
+    pyvrp::binary::Writer writer(path, pyvrp::binary::Kind::PROBLEM_DATA);
+
+    writer.write(locations_.size());
+    for (auto const &location : locations_)
+    {
+        writer.write(location.x);
+        writer.write(location.y);
+        writer.write(std::string(location.name));
+    }
+
+    writer.write(clients_.size());
+    for (auto const &client : clients_)
+    {
+        writer.write(client.location);
+        writer.write(client.delivery);
+        writer.write(client.pickup);
+        writer.write(client.serviceDuration);
+        writer.write(client.twEarly);
+        writer.write(client.twLate);
+        writer.write(client.releaseTime);
+        writer.write(client.prize);
+        writer.write(client.required);
+        writer.write(client.group);
+        writeLatenessCost(writer, client.latenessCost);
+        writer.write(std::string(client.name));
+    }
+
+    writer.write(depots_.size());
+    for (auto const &depot : depots_)
+    {
+        writer.write(depot.location);
+        writer.write(depot.twEarly);
+        writer.write(depot.twLate);
+        writer.write(depot.serviceDuration);
+        writer.write(std::string(depot.name));
+    }
+
+    writer.write(vehicleTypes_.size());
+    for (auto const &vehType : vehicleTypes_)
+    {
+        writer.write(vehType.numAvailable);
+        writer.write(vehType.capacity);
+        writer.write(vehType.startDepot);
+        writer.write(vehType.endDepot);
+        writer.write(vehType.fixedCost);
+        writer.write(vehType.twEarly);
+        writer.write(vehType.twLate);
+        writer.write(vehType.shiftDuration);
+        writer.write(vehType.maxDistance);
+        writer.write(vehType.unitDistanceCost);
+        writer.write(vehType.unitDurationCost);
+        writer.write(vehType.profile);
+        writer.write(vehType.startLate);
+        writer.write(vehType.initialLoad);
+        writer.write(vehType.reloadDepots);
+        writer.write(vehType.maxReloads);
+        writer.write(vehType.maxOvertime);
+        writer.write(vehType.unitOvertimeCost);
+        writer.write(std::string(vehType.name));
+    }
+
+    writer.write(groups_.size());
+    for (auto const &group : groups_)
+    {
+        writer.write(group.clients());
+        writer.write(group.required);
+        writer.write(std::string(group.name));
+    }
+
+    writer.write(shipments_.size());
+    for (auto const &shipment : shipments_)
+    {
+        for (auto const *step : {&shipment.pickup, &shipment.delivery})
+        {
+            writer.write(step->location);
+            writer.write(step->twEarly);
+            writer.write(step->twLate);
+            writer.write(step->serviceDuration);
+            writeLatenessCost(writer, step->latenessCost);
+        }
+
+        writer.write(shipment.amount);
+        writer.write(shipment.prize);
+        writer.write(shipment.required);
+        writer.write(std::string(shipment.name));
+    }
+
+    writer.write(dists_.size());
+    for (size_t profile = 0; profile != dists_.size(); ++profile)
+    {
+        auto const write = [&](auto const &mat) { writeMatrix(writer, mat); };
+        std::visit(write, dists_[profile]);
+        std::visit(write, durs_[profile]);
+    }
+}
+
+ProblemData ProblemData::load(std::filesystem::path const &path, bool mmap)
+{
+    std::shared_ptr<pyvrp::binary::MappedFile> file = nullptr;
+    std::vector<char> contents;
+    char *buffer = nullptr;
+    size_t size = 0;
+
+    if (mmap)
+    {
+        file = std::make_shared<pyvrp::binary::MappedFile>(path);
+        buffer = file->data();
+        size = file->size();
+    }
+    else
+    {
+        contents = pyvrp::binary::readFile(path);
+        buffer = contents.data();
+        size = contents.size();
+    }
+
+    pyvrp::binary::Reader reader(
+        buffer, size, pyvrp::binary::Kind::PROBLEM_DATA);
+
+    // The objects below have const members, and must thus be constructed from
+    // values that are read in order first.
+    std::vector<Location> locations;
+    auto const numLocations = reader.read<size_t>();
+    for (size_t idx = 0; idx != numLocations; ++idx)
+    {
+        auto const x = reader.read<Coordinate>();
+        auto const y = reader.read<Coordinate>();
+        auto const name = reader.read<std::string>();
+        locations.emplace_back(x, y, name);
+    }
+
+    std::vector<Client> clients;
+    auto const numClients = reader.read<size_t>();
+    for (size_t idx = 0; idx != numClients; ++idx)
+    {
+        auto const location = reader.read<size_t>();
+        auto const delivery = reader.read<std::vector<Load>>();
+        auto const pickup = reader.read<std::vector<Load>>();
+        auto const serviceDuration = reader.read<Duration>();
+        auto const twEarly = reader.read<Duration>();
+        auto const twLate = reader.read<Duration>();
+        auto const releaseTime = reader.read<Duration>();
+        auto const prize = reader.read<Cost>();
+        auto const required = reader.read<bool>();
+        auto const group = reader.read<std::optional<size_t>>();
+        auto const latenessCost = readLatenessCost(reader);
+        auto const name = reader.read<std::string>();
+        clients.emplace_back(location,
+                             delivery,
+                             pickup,
+                             serviceDuration,
+                             twEarly,
+                             twLate,
+                             releaseTime,
+                             prize,
+                             required,
+                             group,
+                             latenessCost,
+                             name);
+    }
+
+    std::vector<Depot> depots;
+    auto const numDepots = reader.read<size_t>();
+    for (size_t idx = 0; idx != numDepots; ++idx)
+    {
+        auto const location = reader.read<size_t>();
+        auto const twEarly = reader.read<Duration>();
+        auto const twLate = reader.read<Duration>();
+        auto const serviceDuration = reader.read<Duration>();
+        auto const name = reader.read<std::string>();
+        depots.emplace_back(location, twEarly, twLate, serviceDuration, name);
+    }
+
+    std::vector<VehicleType> vehicleTypes;
+    auto const numVehicleTypes = reader.read<size_t>();
+    for (size_t idx = 0; idx != numVehicleTypes; ++idx)
+    {
+        auto const numAvailable = reader.read<size_t>();
+        auto const capacity = reader.read<std::vector<Load>>();
+        auto const startDepot = reader.read<size_t>();
+        auto const endDepot = reader.read<size_t>();
+        auto const fixedCost = reader.read<Cost>();
+        auto const twEarly = reader.read<Duration>();
+        auto const twLate = reader.read<Duration>();
+        auto const shiftDuration = reader.read<Duration>();
+        auto const maxDistance = reader.read<Distance>();
+        auto const unitDistanceCost = reader.read<Cost>();
+        auto const unitDurationCost = reader.read<Cost>();
+        auto const profile = reader.read<size_t>();
+        auto const startLate = reader.read<Duration>();
+        auto const initialLoad = reader.read<std::vector<Load>>();
+        auto const reloadDepots = reader.read<std::vector<size_t>>();
+        auto const maxReloads = reader.read<size_t>();
+        auto const maxOvertime = reader.read<Duration>();
+        auto const unitOvertimeCost = reader.read<Cost>();
+        auto const name = reader.read<std::string>();
+        vehicleTypes.emplace_back(numAvailable,
+                                  capacity,
+                                  startDepot,
+                                  endDepot,
+                                  fixedCost,
+                                  twEarly,
+                                  twLate,
+                                  shiftDuration,
+                                  maxDistance,
+                                  unitDistanceCost,
+                                  unitDurationCost,
+                                  profile,
+                                  startLate,
+                                  initialLoad,
+                                  reloadDepots,
+                                  maxReloads,
+                                  maxOvertime,
+                                  unitOvertimeCost,
+                                  name);
+    }
+
+    std::vector<ClientGroup> groups;
+    auto const numGroups = reader.read<size_t>();
+    for (size_t idx = 0; idx != numGroups; ++idx)
+    {
+        auto const groupClients = reader.read<std::vector<size_t>>();
+        auto const required = reader.read<bool>();
+        auto const name = reader.read<std::string>();
+        groups.emplace_back(groupClients, required, name);
+    }
+
+    auto const readStep = [&]()
+    {
+        auto const location = reader.read<size_t>();
+        auto const twEarly = reader.read<Duration>();
+        auto const twLate = reader.read<Duration>();
+        auto const serviceDuration = reader.read<Duration>();
+        auto const latenessCost = readLatenessCost(reader);
+        return Shipment::Step(
+            location, twEarly, twLate, serviceDuration, latenessCost);
+    };
+
+    std::vector<Shipment> shipments;
+    auto const numShipments = reader.read<size_t>();
+    for (size_t idx = 0; idx != numShipments; ++idx)
+    {
+        auto const pickup = readStep();
+        auto const delivery = readStep();
+        auto const amount = reader.read<std::vector<Load>>();
+        auto const prize = reader.read<Cost>();
+        auto const required = reader.read<bool>();
+        auto const name = reader.read<std::string>();
+        shipments.emplace_back(pickup, delivery, amount, prize, required, name);
+    }
+
+    auto const numProfiles = reader.read<size_t>();
+    std::vector<ProfileMatrix<Distance>> distMats;
+    std::vector<ProfileMatrix<Duration>> durMats;
+    for (size_t profile = 0; profile != numProfiles; ++profile)
+    {
+        distMats.push_back(readMatrix<Distance>(reader, buffer, file));
+        durMats.push_back(readMatrix<Duration>(reader, buffer, file));
+    }
+
+    return {std::move(locations),
+            std::move(clients),
+            std::move(depots),
+            std::move(vehicleTypes),
+            std::move(distMats),
+            std::move(durMats),
+            std::move(groups),
+            std::move(shipments)};
+}
+
 ProblemData::ProblemData(std::vector<Location> locations,
                          std::vector<Client> clients,
                          std::vector<Depot> depots,
                          std::vector<VehicleType> vehicleTypes,
-                         std::vector<Matrix<Distance>> distMats,
-                         std::vector<Matrix<Duration>> durMats,
+                         std::vector<ProfileMatrix<Distance>> distMats,
+                         std::vector<ProfileMatrix<Duration>> durMats,
                          std::vector<ClientGroup> groups,
                          std::vector<Shipment> shipments)
-    : dists_(std::move(distMats)),
-      durs_(std::move(durMats)),
+    : dists_(pack(std::move(distMats))),
+      durs_(pack(std::move(durMats))),
       locations_(std::move(locations)),
       clients_(std::move(clients)),
       depots_(std::move(depots)),
@@ -328,6 +863,14 @@ ProblemData::ProblemData(std::vector<Location> locations,
                          [](Shipment const &shipment) {
                              return hasTimeWindow(shipment.pickup)
                                     || hasTimeWindow(shipment.delivery);
+                         })),
+      hasLatenessCosts_(
+          std::any_of(clients_.begin(), clients_.end(), hasLatenessCost<Client>)
+          || std::any_of(shipments_.begin(),
+                         shipments_.end(),
+                         [](Shipment const &shipment) {
+                             return hasLatenessCost(shipment.pickup)
+                                    || hasLatenessCost(shipment.delivery);
                          }))
 {
     validate();
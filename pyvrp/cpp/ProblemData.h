@@ -8,13 +8,24 @@
 #include "Matrix.h"
 #include "Measure.h"
 #include "Shipment.h"
+#include "SymmetricMatrix.h"
 #include "VehicleType.h"
 
 #include <cassert>
+#include <filesystem>
+#include <memory>
+#include <variant>
 #include <vector>
 
 namespace pyvrp
 {
+// Distance or duration matrix of a routing profile. Symmetric matrices only
+// store their upper triangle, other matrices are stored in full. The storage
+// layout is fixed when the data is constructed. Users should dispatch on it
+// once, using std::visit, and not for every matrix lookup.
+template <typename T>
+using ProfileMatrix = std::variant<Matrix<T>, SymmetricMatrix<T>>;
+
 /**
  * ProblemData(
  *     locations: list[Location],
@@ -66,10 +77,10 @@ namespace pyvrp
  *     When the data references locations, clients, depots, etc. that do not
  *     exist because the referenced index is out of range.
  */
-class ProblemData
+class ProblemData : public std::enable_shared_from_this<ProblemData>
 {
-    std::vector<Matrix<Distance>> const dists_;    // Distance matrices
-    std::vector<Matrix<Duration>> const durs_;     // Duration matrices
+    std::vector<ProfileMatrix<Distance>> const dists_;  // Distance matrices
+    std::vector<ProfileMatrix<Duration>> const durs_;   // Duration matrices
     std::vector<Location> const locations_;        // Location information
     std::vector<Client> const clients_;            // Client information
     std::vector<Depot> const depots_;              // Depot information
@@ -80,12 +91,26 @@ class ProblemData
     size_t const numVehicles_;
     size_t const numLoadDimensions_;
     bool const hasTimeWindows_;
+    bool const hasLatenessCosts_;
 
     // Validates the consistency of the constructed instance.
     void validate() const;
 
 public:
-    bool operator==(ProblemData const &other) const = default;
+    /**
+     * Sparse collection of directed edges between locations, stored as
+     * parallel arrays of origin and destination location indices, and the
+     * corresponding travel distances and durations.
+     */
+    struct Edges
+    {
+        std::vector<size_t> origins;
+        std::vector<size_t> destinations;
+        std::vector<Distance> distances;
+        std::vector<Duration> durations;
+    };
+
+    bool operator==(ProblemData const &other) const;
 
     /**
      * Returns a list of all locations in the problem instance.
@@ -124,9 +149,14 @@ public:
      *
      *    This method returns a read-only view of the underlying data. No
      *    matrices are copied, but the resulting data cannot be modified in any
-     *    way!
+     *    way! Symmetric matrices are an exception: only their upper triangle
+     *    is stored, so these are returned as read-only copies. Every call
+     *    makes a new full copy, so retrieve such a matrix once and reuse it,
+     *    or use :meth:`~distance_submatrix` when only some entries are needed. See
+     *    :meth:`~is_symmetric`.
      */
-    [[nodiscard]] std::vector<Matrix<Distance>> const &distanceMatrices() const;
+    [[nodiscard]] std::vector<ProfileMatrix<Distance>> const &
+    distanceMatrices() const;
 
     /**
      * Returns a list of all duration matrices in the problem instance.
@@ -135,9 +165,14 @@ public:
      *
      *    This method returns a read-only view of the underlying data. No
      *    matrices are copied, but the resulting data cannot be modified in any
-     *    way!
+     *    way! Symmetric matrices are an exception: only their upper triangle
+     *    is stored, so these are returned as read-only copies. Every call
+     *    makes a new full copy, so retrieve such a matrix once and reuse it,
+     *    or use :meth:`~duration_submatrix` when only some entries are needed. See
+     *    :meth:`~is_symmetric`.
      */
-    [[nodiscard]] std::vector<Matrix<Duration>> const &durationMatrices() const;
+    [[nodiscard]] std::vector<ProfileMatrix<Duration>> const &
+    durationMatrices() const;
 
     /**
      * Returns the location at the given index.
@@ -207,16 +242,47 @@ public:
      *
      *    This method returns a read-only view of the underlying data. No
      *    matrix is copied, but the resulting data cannot be modified in any
-     *    way!
+     *    way! Symmetric matrices are an exception: only their upper triangle
+     *    is stored, so these are returned as read-only copies. Every call
+     *    makes a new full copy, so retrieve such a matrix once and reuse it,
+     *    or use :meth:`~distance_submatrix` when only some entries are needed. See
+     *    :meth:`~is_symmetric`.
      *
      * Parameters
      * ----------
      * profile
      *     Routing profile whose associated distance matrix to retrieve.
      */
-    [[nodiscard]] inline Matrix<Distance> const &
+    [[nodiscard]] inline ProfileMatrix<Distance> const &
     distanceMatrix(size_t profile) const;
 
+    /**
+     * The travel distance matrix associated with the given routing profile,
+     * restricted to the given locations. Entry (i, j) of the returned matrix
+     * is the travel distance from ``locations[i]`` to ``locations[j]``.
+     *
+     * .. note::
+     *
+     *    Unlike :meth:`~distance_matrix`, this method only copies the requested
+     *    entries. That is much cheaper than selecting these from the full
+     *    matrix when that matrix is symmetric, and has to be copied in full.
+     *
+     * Parameters
+     * ----------
+     * profile
+     *     Routing profile whose associated distance matrix to use.
+     * locations
+     *     Locations to restrict the matrix to.
+     *
+     * Raises
+     * ------
+     * IndexError
+     *     When the profile or any of the locations is out of range.
+     */
+    [[nodiscard]] Matrix<Distance>
+    distanceSubmatrix(size_t profile,
+                      std::vector<size_t> const &locations) const;
+
     /**
      * The full travel duration matrix associated with the given routing
      * profile.
@@ -225,16 +291,47 @@ public:
      *
      *    This method returns a read-only view of the underlying data. No
      *    matrix is copied, but the resulting data cannot be modified in any
-     *    way!
+     *    way! Symmetric matrices are an exception: only their upper triangle
+     *    is stored, so these are returned as read-only copies. Every call
+     *    makes a new full copy, so retrieve such a matrix once and reuse it,
+     *    or use :meth:`~duration_submatrix` when only some entries are needed. See
+     *    :meth:`~is_symmetric`.
      *
      * Parameters
      * ----------
      * profile
      *     Routing profile whose associated duration matrix to retrieve.
      */
-    [[nodiscard]] inline Matrix<Duration> const &
+    [[nodiscard]] inline ProfileMatrix<Duration> const &
     durationMatrix(size_t profile) const;
 
+    /**
+     * The travel duration matrix associated with the given routing profile,
+     * restricted to the given locations. Entry (i, j) of the returned matrix
+     * is the travel duration from ``locations[i]`` to ``locations[j]``.
+     *
+     * .. note::
+     *
+     *    Unlike :meth:`~duration_matrix`, this method only copies the requested
+     *    entries. That is much cheaper than selecting these from the full
+     *    matrix when that matrix is symmetric, and has to be copied in full.
+     *
+     * Parameters
+     * ----------
+     * profile
+     *     Routing profile whose associated duration matrix to use.
+     * locations
+     *     Locations to restrict the matrix to.
+     *
+     * Raises
+     * ------
+     * IndexError
+     *     When the profile or any of the locations is out of range.
+     */
+    [[nodiscard]] Matrix<Duration>
+    durationSubmatrix(size_t profile,
+                      std::vector<size_t> const &locations) const;
+
     /**
      * Determines whether any of the :meth:`~clients`, :meth:`~depots`, or
      * :meth:`~shipments` in this instance have nonstandard time windows, or
@@ -243,6 +340,26 @@ public:
      */
     [[nodiscard]] inline bool hasTimeWindows() const;
 
+    /**
+     * Determines whether any of the :meth:`~clients` or :meth:`~shipments` in
+     * this instance have a lateness cost function.
+     */
+    [[nodiscard]] inline bool hasLatenessCosts() const;
+
+    /**
+     * Determines whether the distance and duration matrices of the given
+     * routing profile are both symmetric. Only the upper triangle of symmetric
+     * matrices is stored, which roughly halves their memory use. Matrices that
+     * share their data, for example because they were memory-mapped from a
+     * file, are stored as given, and are never considered symmetric.
+     *
+     * Parameters
+     * ----------
+     * profile
+     *     Routing profile to check.
+     */
+    [[nodiscard]] inline bool isSymmetric(size_t profile) const;
+
     /**
      * Number of clients in this problem instance.
      */
@@ -316,21 +433,132 @@ public:
      * ProblemData
      *    A new ProblemData instance with possibly replaced data.
      */
-    ProblemData replace(std::optional<std::vector<Location>> &locations,
-                        std::optional<std::vector<Client>> &clients,
-                        std::optional<std::vector<Depot>> &depots,
-                        std::optional<std::vector<VehicleType>> &vehicleTypes,
-                        std::optional<std::vector<Matrix<Distance>>> &distMats,
-                        std::optional<std::vector<Matrix<Duration>>> &durMats,
-                        std::optional<std::vector<ClientGroup>> &groups,
-                        std::optional<std::vector<Shipment>> &shipments) const;
+    ProblemData
+    replace(std::optional<std::vector<Location>> &locations,
+            std::optional<std::vector<Client>> &clients,
+            std::optional<std::vector<Depot>> &depots,
+            std::optional<std::vector<VehicleType>> &vehicleTypes,
+            std::optional<std::vector<ProfileMatrix<Distance>>> &dists,
+            std::optional<std::vector<ProfileMatrix<Duration>>> &durs,
+            std::optional<std::vector<ClientGroup>> &groups,
+            std::optional<std::vector<Shipment>> &shipments) const;
+
+    /**
+     * ProblemData.from_edges(
+     *     locations: list[Location],
+     *     clients: list[Client],
+     *     depots: list[Depot],
+     *     vehicle_types: list[VehicleType],
+     *     edges: list[tuple[ndarray, ndarray, ndarray, ndarray]],
+     *     missing_value: int,
+     *     groups: list[ClientGroup] = [],
+     *     shipments: list[Shipment] = [],
+     * ) -> ProblemData
+     *
+     * Creates a problem data instance from sparse edge data, rather than from
+     * full distance and duration matrices. This avoids constructing dense
+     * matrices in Python when only a few edges per location are known.
+     *
+     * Parameters
+     * ----------
+     * locations
+     *     List of physical locations.
+     * clients
+     *     List of clients to visit.
+     * depots
+     *     List of depots. At least one depot must be passed.
+     * vehicle_types
+     *     List of vehicle types in the problem instance.
+     * edges
+     *     Edges of each routing profile, given as a tuple of arrays of origin
+     *     and destination location indices, and edge distances and durations.
+     *     When an edge is given multiple times, the last one is used.
+     * missing_value
+     *     Distance and duration value to use for edges that are not given.
+     *     Travelling from a location to itself takes zero distance and
+     *     duration, unless that edge is explicitly given.
+     * groups
+     *     List of client groups. Default empty.
+     * shipments
+     *     List of shipments. Default empty.
+     *
+     * Raises
+     * ------
+     * ValueError
+     *     When the edge arrays of a profile are not of equal length, or when
+     *     the data is otherwise inconsistent.
+     * IndexError
+     *     When an edge references a location that does not exist.
+     */
+    static ProblemData fromEdges(std::vector<Location> locations,
+                                 std::vector<Client> clients,
+                                 std::vector<Depot> depots,
+                                 std::vector<VehicleType> vehicleTypes,
+                                 std::vector<Edges> const &edges,
+                                 Distance missingDist,
+                                 Duration missingDur,
+                                 std::vector<ClientGroup> groups = {},
+                                 std::vector<Shipment> shipments = {});
+
+    /**
+     * save(path: str | os.PathLike)
+     *
+     * Writes this problem data instance to the given path, in PyVRP's
+     * versioned, little-endian binary format. The distance and duration
+     * matrices are stored such that they can be memory-mapped when the
+     * instance is loaded again, using :meth:`~load`.
+     *
+     * Parameters
+     * ----------
+     * path
+     *     Filesystem location to write to.
+     */
+    void save(std::filesystem::path const &path) const;
+
+    /**
+     * ProblemData.load(path: str | os.PathLike, mmap: bool = True)
+     *
+     * Loads a problem data instance from the given path. The file must have
+     * been written by :meth:`~save`.
+     *
+     * .. note::
+     *
+     *    When ``mmap`` is set, the distance and duration matrices are not
+     *    copied into memory, but are memory-mapped from the file instead. The
+     *    operating system then shares these matrices between all processes
+     *    that load the same file, and only reads the parts that are actually
+     *    used. This makes loading large instances fast, and avoids duplicate
+     *    copies of the matrices when the instance is used by many processes.
+     *    The file must not be modified while the instance is in use.
+     *
+     * Parameters
+     * ----------
+     * path
+     *     Filesystem location to read from.
+     * mmap
+     *     Whether to memory-map the distance and duration matrices, rather
+     *     than copying them into memory. Default True.
+     *
+     * Returns
+     * -------
+     * ProblemData
+     *     The problem data instance stored in the given file.
+     *
+     * Raises
+     * ------
+     * ValueError
+     *     When the file is not a valid binary problem data file, or was
+     *     written using an unsupported format version.
+     */
+    static ProblemData load(std::filesystem::path const &path,
+                            bool mmap = true);
 
     ProblemData(std::vector<Location> locations,
                 std::vector<Client> clients,
                 std::vector<Depot> depots,
                 std::vector<VehicleType> vehicleTypes,
-                std::vector<Matrix<Distance>> distMats,
-                std::vector<Matrix<Duration>> durMats,
+                std::vector<ProfileMatrix<Distance>> distMats,
+                std::vector<ProfileMatrix<Duration>> durMats,
                 std::vector<ClientGroup> groups = {},
                 std::vector<Shipment> shipments = {});
 
@@ -355,19 +583,30 @@ Shipment const &ProblemData::shipment(size_t shipment) const
     return shipments_[shipment];
 }
 
-Matrix<Distance> const &ProblemData::distanceMatrix(size_t profile) const
+ProfileMatrix<Distance> const &ProblemData::distanceMatrix(size_t profile) const
 {
     assert(profile < dists_.size());
     return dists_[profile];
 }
 
-Matrix<Duration> const &ProblemData::durationMatrix(size_t profile) const
+ProfileMatrix<Duration> const &ProblemData::durationMatrix(size_t profile) const
 {
     assert(profile < durs_.size());
     return durs_[profile];
 }
 
 bool ProblemData::hasTimeWindows() const { return hasTimeWindows_; }
+
+bool ProblemData::hasLatenessCosts() const { return hasLatenessCosts_; }
+
+bool ProblemData::isSymmetric(size_t profile) const
+{
+    assert(profile < dists_.size() && profile < durs_.size());
+    using SymmetricDistances = SymmetricMatrix<Distance>;
+    using SymmetricDurations = SymmetricMatrix<Duration>;
+    return std::holds_alternative<SymmetricDistances>(dists_[profile])
+           && std::holds_alternative<SymmetricDurations>(durs_[profile]);
+}
 }  // namespace pyvrp
 
 #endif  // PYVRP_PROBLEMDATA_H
@@ -7,14 +7,48 @@
 #include <algorithm>
 #include <cassert>
 #include <fstream>
+#include <variant>
 
 using pyvrp::Activity;
 using pyvrp::Cost;
 using pyvrp::Distance;
 using pyvrp::Duration;
 using pyvrp::Load;
+using pyvrp::ProblemData;
 using pyvrp::Route;
 
+namespace
+{
+using LatenessCost = pyvrp::PiecewiseLinearFunction<int64_t, int64_t>;
+
+// Returns the lateness cost function of the given activity, or nullptr if the
+// activity has no lateness cost.
+LatenessCost const *latenessCostOf(ProblemData const &data,
+                                   Activity const &activity)
+{
+    std::optional<LatenessCost> const *cost = nullptr;
+    switch (activity.type())
+    {
+    case Activity::ActivityType::DEPOT:
+        return nullptr;
+
+    case Activity::ActivityType::CLIENT:
+        cost = &data.client(activity.idx()).latenessCost;
+        break;
+
+    case Activity::ActivityType::PICKUP:
+        cost = &data.shipment(activity.idx()).pickup.latenessCost;
+        break;
+
+    case Activity::ActivityType::DELIVERY:
+        cost = &data.shipment(activity.idx()).delivery.latenessCost;
+        break;
+    }
+
+    return cost->has_value() ? &cost->value() : nullptr;
+}
+}  // namespace
+
 Route::ScheduledActivity::ScheduledActivity(Activity activity,
                                             size_t trip,
                                             Duration startTime,
@@ -136,87 +170,96 @@ void Route::validate(ProblemData const &data,
         throw std::invalid_argument("Vehicle cannot perform this many trips.");
 }
 
-void Route::setSchedule(ProblemData const &data, Activities const &activities)
+void Route::setDurations(ProblemData const &data, Activities const &activities)
 {
-    schedule_.reserve(activities.size() + 2);  // incl. start and end depots
-
     auto const &vehData = data.vehicleType(vehicleType_);
-    auto const &durations = data.durationMatrix(vehData.profile);
+    auto &releaseTimes = schedule_->releaseTimes;
 
-    std::vector<Duration> releaseTimes;  // per trip, for the schedule
+    activities_.reserve(activities.size() + 2);  // incl. start and end depots
+    activities_.emplace_back(Activity::ActivityType::DEPOT, vehData.startDepot);
+    activities_.insert(activities_.end(), activities.begin(), activities.end());
+    activities_.emplace_back(Activity::ActivityType::DEPOT, vehData.endDepot);
 
-    auto const &end = data.depot(vehData.endDepot);
-    auto ds = DurationSegment::merge({end, 0}, {vehData, vehData.twLate});
-    size_t nextLoc = end.location;
-    for (auto it = activities.rbegin(); it != activities.rend(); ++it)
-        switch (it->type())
-        {
-        case Activity::ActivityType::DEPOT:
-        {
-            auto const &depot = data.depot(it->idx());
+    auto const merge = [&](auto const &durations)
+    {
+        auto const &end = data.depot(vehData.endDepot);
+        auto ds = DurationSegment::merge({end, 0}, {vehData, vehData.twLate});
+        size_t nextLoc = end.location;
+        for (auto it = activities.rbegin(); it != activities.rend(); ++it)
+            switch (it->type())
+            {
+            case Activity::ActivityType::DEPOT:
+            {
+                auto const &depot = data.depot(it->idx());
 
-            auto const depotService = depot.serviceDuration;
-            service_ += depotService;
+                auto const depotService = depot.serviceDuration;
+                service_ += depotService;
 
-            auto const edgeDur = durations(depot.location, nextLoc);
-            travel_ += edgeDur;
+                auto const edgeDur = durations(depot.location, nextLoc);
+                travel_ += edgeDur;
 
-            ds = DurationSegment::merge(edgeDur, {depot, depotService}, ds);
-            releaseTimes.insert(releaseTimes.begin(), ds.releaseTime());
+                ds = DurationSegment::merge(edgeDur, {depot, depotService}, ds);
+                releaseTimes.insert(releaseTimes.begin(), ds.releaseTime());
 
-            ds = ds.finaliseFront();
-            nextLoc = depot.location;
-            break;
-        }
+                ds = ds.finaliseFront();
+                nextLoc = depot.location;
+                break;
+            }
 
-        case Activity::ActivityType::CLIENT:
-        {
-            auto const &client = data.client(it->idx());
-            service_ += client.serviceDuration;
+            case Activity::ActivityType::CLIENT:
+            {
+                auto const &client = data.client(it->idx());
+                service_ += client.serviceDuration;
 
-            auto const edgeDur = durations(client.location, nextLoc);
-            travel_ += edgeDur;
+                auto const edgeDur = durations(client.location, nextLoc);
+                travel_ += edgeDur;
 
-            ds = DurationSegment::merge(edgeDur, {client}, ds);
-            nextLoc = client.location;
-            break;
-        }
+                ds = DurationSegment::merge(edgeDur, {client}, ds);
+                nextLoc = client.location;
+                break;
+            }
 
-        case Activity::ActivityType::PICKUP:
-        {
-            auto const &pickup = data.shipment(it->idx()).pickup;
-            service_ += pickup.serviceDuration;
+            case Activity::ActivityType::PICKUP:
+            {
+                auto const &pickup = data.shipment(it->idx()).pickup;
+                service_ += pickup.serviceDuration;
 
-            auto const edgeDur = durations(pickup.location, nextLoc);
-            travel_ += edgeDur;
+                auto const edgeDur = durations(pickup.location, nextLoc);
+                travel_ += edgeDur;
 
-            ds = DurationSegment::merge(edgeDur, {pickup}, ds);
-            nextLoc = pickup.location;
-            break;
-        }
+                ds = DurationSegment::merge(edgeDur, {pickup}, ds);
+                nextLoc = pickup.location;
+                break;
+            }
 
-        case Activity::ActivityType::DELIVERY:
-        {
-            auto const &delivery = data.shipment(it->idx()).delivery;
-            service_ += delivery.serviceDuration;
+            case Activity::ActivityType::DELIVERY:
+            {
+                auto const &delivery = data.shipment(it->idx()).delivery;
+                service_ += delivery.serviceDuration;
 
-            auto const edgeDur = durations(delivery.location, nextLoc);
-            travel_ += edgeDur;
+                auto const edgeDur = durations(delivery.location, nextLoc);
+                travel_ += edgeDur;
 
-            ds = DurationSegment::merge(edgeDur, {delivery}, ds);
-            nextLoc = delivery.location;
-            break;
-        }
-        }
+                ds = DurationSegment::merge(edgeDur, {delivery}, ds);
+                nextLoc = delivery.location;
+                break;
+            }
+            }
 
-    auto const &start = data.depot(vehData.startDepot);
-    auto const edgeDur = durations(start.location, nextLoc);
+        auto const &start = data.depot(vehData.startDepot);
+        auto const edgeDur = durations(start.location, nextLoc);
+
+        service_ += start.serviceDuration;
+        travel_ += edgeDur;
 
-    service_ += start.serviceDuration;
-    travel_ += edgeDur;
+        DurationSegment const depotStart(start, start.serviceDuration);
+        ds = DurationSegment::merge(edgeDur, depotStart, ds);
+        ds = DurationSegment::merge({vehData, vehData.startLate}, ds);
 
-    ds = DurationSegment::merge(edgeDur, {start, start.serviceDuration}, ds);
-    ds = DurationSegment::merge({vehData, vehData.startLate}, ds);
+        return ds;
+    };
+
+    auto const ds = std::visit(merge, data.durationMatrix(vehData.profile));
 
     releaseTimes.insert(releaseTimes.begin(), ds.releaseTime());
 
@@ -228,6 +271,17 @@ void Route::setSchedule(ProblemData const &data, Activities const &activities)
     releaseTime_ = ds.releaseTime();
     slack_ = ds.slack();
     timeWarp_ = ds.timeWarp(vehData.maxDuration);
+    numTrips_ = releaseTimes.size();
+}
+
+void Route::setSchedule(ProblemData const &data) const
+{
+    auto &schedule = schedule_->schedule;
+    schedule.reserve(activities_.size());
+
+    auto const &vehData = data.vehicleType(vehicleType_);
+    auto const &start = data.depot(vehData.startDepot);
+    auto const &end = data.depot(vehData.endDepot);
 
     auto now = startTime_;
     auto const handle = [&](Activity activity,
@@ -242,125 +296,138 @@ void Route::setSchedule(ProblemData const &data, Activities const &activities)
         now += wait;
         now -= tw;
 
-        schedule_.emplace_back(activity, trip, now, now + service, wait, tw);
+        schedule.emplace_back(activity, trip, now, now + service, wait, tw);
 
         now += service;
     };
 
-    handle({Activity::ActivityType::DEPOT, vehData.startDepot},
-           0,
-           std::max(start.twEarly, std::min(releaseTime_, start.twLate)),
-           std::min(start.twLate, vehData.startLate),
-           start.serviceDuration);
-
-    size_t prevLoc = start.location;
-    for (size_t tripIdx = 0; auto const &activity : activities)
-        switch (activity.type())
-        {
-        case Activity::ActivityType::DEPOT:
+    auto const simulate = [&](auto const &durations)
+    {
+        handle({Activity::ActivityType::DEPOT, vehData.startDepot},
+               0,
+               std::max(start.twEarly, std::min(releaseTime_, start.twLate)),
+               std::min(start.twLate, vehData.startLate),
+               start.serviceDuration);
+
+        size_t prevLoc = start.location;
+        for (size_t idx = 1, tripIdx = 0; idx != activities_.size() - 1; ++idx)
         {
-            auto const releaseTime = releaseTimes[++tripIdx];
+            auto const &activity = activities_[idx];
+            switch (activity.type())
+            {
+            case Activity::ActivityType::DEPOT:
+            {
+                auto const releaseTime = schedule_->releaseTimes[++tripIdx];
 
-            auto const &depot = data.depot(activity.idx());
-            now += durations(prevLoc, depot.location);
+                auto const &depot = data.depot(activity.idx());
+                now += durations(prevLoc, depot.location);
 
-            handle(activity,
-                   tripIdx,
-                   std::max(depot.twEarly, std::min(releaseTime, depot.twLate)),
-                   depot.twLate,
-                   depot.serviceDuration);
+                auto const release = std::min(releaseTime, depot.twLate);
+                handle(activity,
+                       tripIdx,
+                       std::max(depot.twEarly, release),
+                       depot.twLate,
+                       depot.serviceDuration);
 
-            prevLoc = depot.location;
-            break;
-        }
+                prevLoc = depot.location;
+                break;
+            }
 
-        case Activity::ActivityType::CLIENT:
-        {
-            auto const &client = data.client(activity.idx());
-            now += durations(prevLoc, client.location);
+            case Activity::ActivityType::CLIENT:
+            {
+                auto const &client = data.client(activity.idx());
+                now += durations(prevLoc, client.location);
 
-            handle(activity,
-                   tripIdx,
-                   client.twEarly,
-                   client.twLate,
-                   client.serviceDuration);
+                handle(activity,
+                       tripIdx,
+                       client.twEarly,
+                       client.twLate,
+                       client.serviceDuration);
 
-            prevLoc = client.location;
-            break;
-        }
+                prevLoc = client.location;
+                break;
+            }
 
-        case Activity::ActivityType::PICKUP:
-        {
-            auto const &pickup = data.shipment(activity.idx()).pickup;
-            now += durations(prevLoc, pickup.location);
+            case Activity::ActivityType::PICKUP:
+            {
+                auto const &pickup = data.shipment(activity.idx()).pickup;
+                now += durations(prevLoc, pickup.location);
 
-            handle(activity,
-                   tripIdx,
-                   pickup.twEarly,
-                   pickup.twLate,
-                   pickup.serviceDuration);
+                handle(activity,
+                       tripIdx,
+                       pickup.twEarly,
+                       pickup.twLate,
+                       pickup.serviceDuration);
 
-            prevLoc = pickup.location;
-            break;
-        }
+                prevLoc = pickup.location;
+                break;
+            }
 
-        case Activity::ActivityType::DELIVERY:
-        {
-            auto const &delivery = data.shipment(activity.idx()).delivery;
-            now += durations(prevLoc, delivery.location);
+            case Activity::ActivityType::DELIVERY:
+            {
+                auto const &delivery = data.shipment(activity.idx()).delivery;
+                now += durations(prevLoc, delivery.location);
 
-            handle(activity,
-                   tripIdx,
-                   delivery.twEarly,
-                   delivery.twLate,
-                   delivery.serviceDuration);
+                handle(activity,
+                       tripIdx,
+                       delivery.twEarly,
+                       delivery.twLate,
+                       delivery.serviceDuration);
 
-            prevLoc = delivery.location;
-            break;
-        }
+                prevLoc = delivery.location;
+                break;
+            }
+            }
         }
 
-    now += durations(prevLoc, end.location);
-    handle({Activity::ActivityType::DEPOT, vehData.endDepot},
-           releaseTimes.size(),
-           end.twEarly,
-           end.twLate,
-           0);
+        now += durations(prevLoc, end.location);
+        handle({Activity::ActivityType::DEPOT, vehData.endDepot},
+               numTrips_,
+               end.twEarly,
+               end.twLate,
+               0);
+    };
+
+    std::visit(simulate, data.durationMatrix(vehData.profile));
 }
 
 void Route::setDistance(ProblemData const &data)
 {
     auto const &vehData = data.vehicleType(vehicleType_);
-    auto const &distances = data.distanceMatrix(vehData.profile);
 
-    size_t frmLoc = data.depot(startDepot()).location;
-    for (size_t idx = 1; idx != schedule_.size(); ++idx)
+    auto const accumulate = [&](auto const &distances)
     {
-        auto const &activity = schedule_[idx];
-
-        auto toLoc = frmLoc;
-        switch (activity.type())
+        size_t frmLoc = data.depot(startDepot()).location;
+        for (size_t idx = 1; idx != activities_.size(); ++idx)
         {
-        case Activity::ActivityType::DEPOT:
-            toLoc = data.depot(activity.idx()).location;
-            break;
+            auto const &activity = activities_[idx];
 
-        case Activity::ActivityType::CLIENT:
-            toLoc = data.client(activity.idx()).location;
-            break;
+            auto toLoc = frmLoc;
+            switch (activity.type())
+            {
+            case Activity::ActivityType::DEPOT:
+                toLoc = data.depot(activity.idx()).location;
+                break;
 
-        case Activity::ActivityType::PICKUP:
-            toLoc = data.shipment(activity.idx()).pickup.location;
-            break;
+            case Activity::ActivityType::CLIENT:
+                toLoc = data.client(activity.idx()).location;
+                break;
 
-        case Activity::ActivityType::DELIVERY:
-            toLoc = data.shipment(activity.idx()).delivery.location;
-            break;
-        };
+            case Activity::ActivityType::PICKUP:
+                toLoc = data.shipment(activity.idx()).pickup.location;
+                break;
 
-        distance_ += distances(frmLoc, toLoc);
-        frmLoc = toLoc;
-    }
+            case Activity::ActivityType::DELIVERY:
+                toLoc = data.shipment(activity.idx()).delivery.location;
+                break;
+            };
+
+            distance_ += distances(frmLoc, toLoc);
+            frmLoc = toLoc;
+        }
+    };
+
+    std::visit(accumulate, data.distanceMatrix(vehData.profile));
 
     distanceCost_ = vehData.unitDistanceCost * static_cast<Cost>(distance_);
     excessDistance_ = std::max<Distance>(distance_ - vehData.maxDistance, 0);
@@ -380,9 +447,9 @@ void Route::setLoad(ProblemData const &data)
             pickup_[dim] += vehData.initialLoad[dim];
         }
 
-        for (size_t idx = 1; idx != schedule_.size(); ++idx)
+        for (size_t idx = 1; idx != activities_.size(); ++idx)
         {
-            auto const &activity = schedule_[idx];
+            auto const &activity = activities_[idx];
 
             switch (activity.type())
             {
@@ -418,7 +485,7 @@ void Route::setOtherStatistics(ProblemData const &data)
     auto const &vehData = data.vehicleType(vehicleType_);
     fixedVehicleCost_ = vehData.fixedCost;
 
-    for (auto const &activity : schedule_)
+    for (auto const &activity : activities_)
     {
         if (activity.isClient())
             prizes_ += data.client(activity.idx()).prize;
@@ -431,6 +498,21 @@ void Route::setOtherStatistics(ProblemData const &data)
     }
 }
 
+void Route::setLatenessCost(ProblemData const &data)
+{
+    // Lateness costs depend on the service start times, so we need to compute
+    // the schedule. We avoid that when there are no lateness costs at all.
+    auto const hasCost = [&](Activity const &activity)
+    { return latenessCostOf(data, activity) != nullptr; };
+
+    if (std::none_of(activities_.begin(), activities_.end(), hasCost))
+        return;
+
+    for (auto const &activity : schedule())
+        if (auto const *cost = latenessCostOf(data, activity))
+            latenessCost_ += (*cost)(activity.startTime().get());
+}
+
 Route::Route(ProblemData const &data,
              std::vector<size_t> const &visits,
              size_t vehicleType)
@@ -453,10 +535,19 @@ Route::Route(ProblemData const &data,
       vehicleType_(vehicleType)
 {
     validate(data, activities);
-    setSchedule(data, activities);  // duration statistics and route schedule
-    setDistance(data);              // distance statistics
-    setLoad(data);                  // load statistics
-    setOtherStatistics(data);       // e.g. prizes, fixed cost
+    setDurations(data, activities);  // duration statistics
+    setDistance(data);               // distance statistics
+    setLoad(data);                   // load statistics
+    setOtherStatistics(data);        // e.g. prizes, fixed cost
+
+    // We compute the schedule lazily, which requires the data to stay alive.
+    // If the data is not shared, we cannot ensure that, and we compute the
+    // schedule right away.
+    schedule_->data = data.weak_from_this().lock();
+    if (!schedule_->data)
+        std::call_once(schedule_->computed, [&] { setSchedule(data); });
+
+    setLatenessCost(data);  // may need the schedule
 }
 
 Route::Route(Schedule schedule,
@@ -469,6 +560,7 @@ Route::Route(Schedule schedule,
              Duration duration,
              Duration overtime,
              Cost durationCost,
+             Cost latenessCost,
              Duration timeWarp,
              Duration travel,
              Duration service,
@@ -478,7 +570,7 @@ Route::Route(Schedule schedule,
              Cost prizes,
              size_t vehicleType,
              size_t numShipments)
-    : schedule_(std::move(schedule)),
+    : schedule_(std::make_shared<LazySchedule>()),
       distance_(distance),
       distanceCost_(distanceCost),
       excessDistance_(excessDistance),
@@ -488,6 +580,7 @@ Route::Route(Schedule schedule,
       duration_(duration),
       overtime_(overtime),
       durationCost_(durationCost),
+      latenessCost_(latenessCost),
       timeWarp_(timeWarp),
       travel_(travel),
       service_(service),
@@ -496,13 +589,57 @@ Route::Route(Schedule schedule,
       slack_(slack),
       prizes_(prizes),
       vehicleType_(vehicleType),
-      numShipments_(numShipments)
+      numShipments_(numShipments),
+      numTrips_(schedule.empty() ? 0 : schedule.back().trip())
+{
+    activities_.reserve(schedule.size());
+    for (auto const &activity : schedule)
+        activities_.emplace_back(activity.type(), activity.idx());
+
+    schedule_->schedule = std::move(schedule);
+}
+
+Route::Route(Route const &other)
+    : activities_(other.activities_),
+      schedule_(other.schedule_),
+      distance_(other.distance_),
+      distanceCost_(other.distanceCost_),
+      excessDistance_(other.excessDistance_),
+      delivery_(other.delivery_),
+      pickup_(other.pickup_),
+      excessLoad_(other.excessLoad_),
+      duration_(other.duration_),
+      overtime_(other.overtime_),
+      durationCost_(other.durationCost_),
+      latenessCost_(other.latenessCost_),
+      timeWarp_(other.timeWarp_),
+      travel_(other.travel_),
+      service_(other.service_),
+      startTime_(other.startTime_),
+      releaseTime_(other.releaseTime_),
+      slack_(other.slack_),
+      fixedVehicleCost_(other.fixedVehicleCost_),
+      prizes_(other.prizes_),
+      vehicleType_(other.vehicleType_),
+      numShipments_(other.numShipments_),
+      numTrips_(other.numTrips_)
+{
+    // The copy shares the lazy schedule, so this computes it for both routes,
+    // and releases their reference to the problem data.
+    [[maybe_unused]] auto const &schedule = this->schedule();
+}
+
+Route &Route::operator=(Route const &other)
 {
+    if (this != &other)
+        *this = Route(other);
+
+    return *this;
 }
 
 bool Route::empty() const { return numClients() == 0 && numShipments() == 0; }
 
-size_t Route::size() const { return schedule_.size(); }
+size_t Route::size() const { return activities_.size(); }
 
 size_t Route::numClients() const
 {
@@ -515,24 +652,44 @@ size_t Route::numShipments() const { return numShipments_; }
 
 size_t Route::numDepots() const { return numTrips() + 1; }
 
-size_t Route::numTrips() const { return schedule_.back().trip(); }
+size_t Route::numTrips() const { return numTrips_; }
 
 Route::ScheduledActivity const &Route::operator[](size_t idx) const
 {
     if (idx >= size())
         throw std::out_of_range("Index out of range.");
 
-    return schedule_[idx];
+    return schedule()[idx];
 }
 
+Route::Activities const &Route::activities() const { return activities_; }
+
 Route::Schedule::const_iterator Route::begin() const
 {
-    return schedule_.begin();
+    return schedule().begin();
 }
 
-Route::Schedule::const_iterator Route::end() const { return schedule_.end(); }
+Route::Schedule::const_iterator Route::end() const { return schedule().end(); }
 
-Route::Schedule const &Route::schedule() const { return schedule_; }
+Route::Schedule const &Route::schedule() const
+{
+    std::call_once(schedule_->computed,
+                   [&]
+                   {
+                       if (!schedule_->data)  // schedule was given explicitly
+                           return;
+
+                       setSchedule(*schedule_->data);
+
+                       // The data and release times are not needed anymore
+                       // once we have the schedule, so there is no reason to
+                       // hold on to them.
+                       schedule_->data.reset();
+                       schedule_->releaseTimes.clear();
+                   });
+
+    return schedule_->schedule;
+}
 
 Cost Route::fixedVehicleCost() const { return fixedVehicleCost_; }
 
@@ -554,6 +711,8 @@ Duration Route::overtime() const { return overtime_; }
 
 Cost Route::durationCost() const { return durationCost_; }
 
+Cost Route::latenessCost() const { return latenessCost_; }
+
 Duration Route::serviceDuration() const { return service_; }
 
 Duration Route::timeWarp() const { return timeWarp_; }
@@ -576,7 +735,7 @@ size_t Route::vehicleType() const { return vehicleType_; }
 
 size_t Route::startDepot() const
 {
-    auto const &activity = schedule_.front();
+    auto const &activity = activities_.front();
 
     assert(activity.isDepot());
     return activity.idx();
@@ -584,7 +743,7 @@ size_t Route::startDepot() const
 
 size_t Route::endDepot() const
 {
-    auto const &activity = schedule_.back();
+    auto const &activity = activities_.back();
 
     assert(activity.isDepot());
     return activity.idx();
@@ -615,7 +774,7 @@ bool Route::operator==(Route const &other) const
         && duration_ == other.duration_
         && timeWarp_ == other.timeWarp_
         && vehicleType_ == other.vehicleType_
-        && schedule_ == other.schedule_;
+        && activities_ == other.activities_;
     // clang-format on
 }
 
@@ -627,6 +786,7 @@ template <> Cost pyvrp::CostEvaluator::penalisedCost(Route const &route) const
     // clang-format off
     return route.distanceCost()
          + route.durationCost()
+         + route.latenessCost()
          + route.fixedVehicleCost()
          + excessLoadPenalties(route.excessLoad())
          + twPenalty(route.timeWarp())
@@ -636,15 +796,16 @@ template <> Cost pyvrp::CostEvaluator::penalisedCost(Route const &route) const
 
 std::ostream &operator<<(std::ostream &out, Route const &route)
 {
-    for (size_t idx = 1; idx != route.size() - 1; ++idx)
+    auto const &activities = route.activities();
+    for (size_t idx = 1; idx != activities.size() - 1; ++idx)
     {
-        auto const &activity = route[idx];
+        auto const &activity = activities[idx];
         if (activity.isDepot())
             out << '|';
         else
             out << activity;
 
-        if (idx < route.size() - 2)  // then we'll insert more after this
+        if (idx < activities.size() - 2)  // then we'll insert more after this
             out << ' ';
     }
 
@@ -8,6 +8,8 @@
 #include "RandomNumberGenerator.h"
 
 #include <iosfwd>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace pyvrp
@@ -22,10 +24,12 @@ class Route
     using Activities = std::vector<Activity>;
 
     void validate(ProblemData const &data, Activities const &activities) const;
-    void setSchedule(ProblemData const &data, Activities const &activities);
+    void setDurations(ProblemData const &data, Activities const &activities);
+    void setSchedule(ProblemData const &data) const;
     void setDistance(ProblemData const &data);
     void setLoad(ProblemData const &data);
     void setOtherStatistics(ProblemData const &data);
+    void setLatenessCost(ProblemData const &data);
 
 public:
     /**
@@ -82,7 +86,27 @@ public:
 private:
     using Schedule = std::vector<ScheduledActivity>;
 
-    Schedule schedule_ = {};       // Activity schedule
+    // Route activities, including the start and end depots.
+    Activities activities_ = {};
+
+    // The activity schedule is only computed when it is first needed, from the
+    // problem data and the release time of each trip. Many routes are never
+    // inspected in detail, so this saves work. Routes may be shared between
+    // threads, so the computation is guarded by a once flag. Until then, the
+    // route holds a reference to the problem data. Copies are typically kept
+    // around for longer, e.g. in a population or as the best solution, so
+    // copying computes the schedule and releases that reference. Copies share
+    // the same (immutable once computed) schedule.
+    struct LazySchedule
+    {
+        std::once_flag computed;
+        Schedule schedule = {};
+        std::shared_ptr<ProblemData const> data = nullptr;
+        std::vector<Duration> releaseTimes = {};
+    };
+
+    std::shared_ptr<LazySchedule> schedule_ = std::make_shared<LazySchedule>();
+
     Distance distance_ = 0;        // Total travel distance on this route
     Cost distanceCost_ = 0;        // Total cost of travel distance
     Distance excessDistance_ = 0;  // Excess travel distance
@@ -92,6 +116,7 @@ private:
     Duration duration_ = 0;         // Total duration of this route
     Duration overtime_ = 0;         // Total overtime of this route
     Cost durationCost_ = 0;         // Total cost of route duration
+    Cost latenessCost_ = 0;         // Total cost of service start times
     Duration timeWarp_ = 0;         // Total time warp on this route
     Duration travel_ = 0;           // Total *travel* duration on this route
     Duration service_ = 0;          // Total *service* duration on this route
@@ -103,6 +128,7 @@ private:
 
     size_t vehicleType_;       // Type of vehicle
     size_t numShipments_ = 0;  // Number of shipments in this route
+    size_t numTrips_ = 0;      // Number of trips in this route
 
 public:
     [[nodiscard]] bool empty() const;
@@ -134,6 +160,13 @@ public:
 
     [[nodiscard]] ScheduledActivity const &operator[](size_t idx) const;
 
+    /**
+     * Returns the activities of this route, including the start and end
+     * depots. Unlike :meth:`~schedule`, this does not include schedule
+     * information, and is cheap to obtain.
+     */
+    [[nodiscard]] Activities const &activities() const;
+
     [[nodiscard]] Schedule::const_iterator begin() const;
     [[nodiscard]] Schedule::const_iterator end() const;
 
@@ -197,6 +230,13 @@ public:
      */
     [[nodiscard]] Cost durationCost() const;
 
+    /**
+     * Total lateness cost of the activities on this route. This is the sum of
+     * the lateness cost functions of the visited clients and shipment steps,
+     * evaluated at the service start times in the route's :meth:`~schedule`.
+     */
+    [[nodiscard]] Cost latenessCost() const;
+
     /**
      * Total service duration over all activities on this route.
      */
@@ -300,12 +340,12 @@ public:
 
     bool operator==(Route const &other) const;
 
-    Route &operator=(Route const &other) = default;
+    Route &operator=(Route const &other);
     Route &operator=(Route &&other) = default;
 
     Route() = delete;
 
-    Route(Route const &other) = default;
+    Route(Route const &other);
     Route(Route &&other) = default;
 
     Route(ProblemData const &data,
@@ -327,6 +367,7 @@ public:
           Duration duration,
           Duration overtime,
           Cost durationCost,
+          Cost latenessCost,
           Duration timeWarp,
           Duration travel,
           Duration service,
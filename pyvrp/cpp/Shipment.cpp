@@ -4,6 +4,7 @@
 #include <cstring>
 #include <stdexcept>
 
+using pyvrp::PiecewiseLinearFunction;
 using pyvrp::Shipment;
 
 namespace
@@ -26,11 +27,14 @@ bool isNegative(auto value) { return value < 0; }
 Shipment::Step::Step(size_t location,
                      Duration twEarly,
                      Duration twLate,
-                     Duration serviceDuration)
+                     Duration serviceDuration,
+                     std::optional<PiecewiseLinearFunction<int64_t, int64_t>>
+                         latenessCost)
     : location(location),
       twEarly(twEarly),
       twLate(twLate),
-      serviceDuration(serviceDuration)
+      serviceDuration(serviceDuration),
+      latenessCost(std::move(latenessCost))
 {
     if (serviceDuration < 0)
         throw std::invalid_argument("service_duration must be >= 0.");
@@ -40,6 +44,16 @@ Shipment::Step::Step(size_t location,
 
     if (twEarly < 0)
         throw std::invalid_argument("tw_early must be >= 0.");
+
+    auto const &cost = this->latenessCost;  // argument has been moved from
+    if (cost && !cost->isMonotonicallyIncreasing())
+        throw std::invalid_argument(
+            "lateness_cost must be monotonically increasing.");
+
+    // Service never starts before the time window opens, so this ensures that
+    // lateness costs are never negative.
+    if (cost && (*cost)(twEarly.get()) < 0)
+        throw std::invalid_argument("lateness_cost must be >= 0 at tw_early.");
 }
 
 Shipment::Shipment(size_t pickupLocation,
@@ -53,13 +67,21 @@ Shipment::Shipment(size_t pickupLocation,
                    std::vector<Load> amount,
                    Cost prize,
                    bool required,
+                   std::optional<PiecewiseLinearFunction<int64_t, int64_t>>
+                       pickupLatenessCost,
+                   std::optional<PiecewiseLinearFunction<int64_t, int64_t>>
+                       deliveryLatenessCost,
                    std::string name)
-    : pickup(
-          pickupLocation, pickupTwEarly, pickupTwLate, pickupServiceDuration),
+    : pickup(pickupLocation,
+             pickupTwEarly,
+             pickupTwLate,
+             pickupServiceDuration,
+             std::move(pickupLatenessCost)),
       delivery(deliveryLocation,
                deliveryTwEarly,
                deliveryTwLate,
-               deliveryServiceDuration),
+               deliveryServiceDuration,
+               std::move(deliveryLatenessCost)),
       amount(amount),
       prize(prize),
       required(required),
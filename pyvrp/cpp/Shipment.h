@@ -2,8 +2,11 @@
 #define PYVRP_SHIPMENT_H
 
 #include "Measure.h"
+#include "PiecewiseLinearFunction.h"
 
+#include <cstdint>
 #include <limits>
+#include <optional>
 
 namespace pyvrp
 {
@@ -20,6 +23,8 @@ namespace pyvrp
  *     amount: list[int] = [],
  *     prize: int = 0,
  *     required: bool = True,
+ *     pickup_lateness_cost: PiecewiseLinearFunction | None = None,
+ *     delivery_lateness_cost: PiecewiseLinearFunction | None = None,
  *     *,
  *     name: str = "",
  * )
@@ -57,6 +62,15 @@ namespace pyvrp
  *     any travel cost before this shipment will be in a solution.
  * required
  *     Whether this shipment is required in a feasible solution. Default True.
+ * pickup_lateness_cost
+ *     Cost of starting the pickup at a given time, as a non-decreasing
+ *     piecewise linear function of the service start time that is
+ *     non-negative from the pickup's earliest start onwards. See
+ *     :attr:`~pyvrp._pyvrp.Client.lateness_cost`. By default there is no
+ *     lateness cost.
+ * delivery_lateness_cost
+ *     Cost of starting the delivery at a given time. By default there is no
+ *     lateness cost.
  * name
  *     Free-form name field for this shipment. Default empty.
  *
@@ -74,6 +88,12 @@ namespace pyvrp
  *     Whether serving this shipment is required.
  * name
  *     Free-form name field for this shipment.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When a lateness cost function is not monotonically increasing, or is
+ *     negative at the earliest start of its step.
  */
 struct Shipment
 {
@@ -83,6 +103,7 @@ struct Shipment
      *     tw_early: int = 0,
      *     tw_late: int = np.iinfo(np.int64).max,
      *     service_duration: int = 0,
+     *     lateness_cost: PiecewiseLinearFunction | None = None,
      * )
      *
      * Data for a pickup or delivery step.
@@ -98,6 +119,11 @@ struct Shipment
      *     if not provided.
      * service_duration
      *     Service duration at this step. Default 0.
+     * lateness_cost
+     *     Cost of starting service at this step at a given time, as a
+     *     non-decreasing piecewise linear function of the service start time
+     *     that is non-negative from ``tw_early`` onwards. By default there is
+     *     no lateness cost.
      *
      * Attributes
      * ----------
@@ -109,6 +135,8 @@ struct Shipment
      *     Latest service time.
      * service_duration
      *     Duration of the service.
+     * lateness_cost
+     *     Cost of the service start time, if any.
      */
     struct Step
     {
@@ -116,11 +144,16 @@ struct Shipment
         Duration const twEarly;
         Duration const twLate;
         Duration const serviceDuration;
+        std::optional<PiecewiseLinearFunction<int64_t, int64_t>> const
+            latenessCost;
 
         Step(size_t location,
              Duration twEarly = 0,
              Duration twLate = std::numeric_limits<Duration>::max(),
-             Duration serviceDuration = 0);
+             Duration serviceDuration = 0,
+             std::optional<PiecewiseLinearFunction<int64_t, int64_t>>
+                 latenessCost
+             = std::nullopt);
 
         bool operator==(Step const &other) const = default;
 
@@ -149,6 +182,12 @@ struct Shipment
              std::vector<Load> amount = {},
              Cost prize = 0,
              bool required = true,
+             std::optional<PiecewiseLinearFunction<int64_t, int64_t>>
+                 pickupLatenessCost
+             = std::nullopt,
+             std::optional<PiecewiseLinearFunction<int64_t, int64_t>>
+                 deliveryLatenessCost
+             = std::nullopt,
              std::string name = "");
 
     Shipment(Step pickup,  // constructor used for serialisation
@@ -1,4 +1,5 @@
 #include "Solution.h"
+#include "BinaryFormat.h"
 #include "DurationSegment.h"
 #include "DynamicBitset.h"
 
@@ -37,6 +38,7 @@ void Solution::evaluate(ProblemData const &data)
         duration_ += route.duration();
         overtime_ += route.overtime();
         durationCost_ += route.durationCost();
+        latenessCost_ += route.latenessCost();
         excessDistance_ += route.excessDistance();
         timeWarp_ += route.timeWarp();
         fixedVehicleCost_ += route.fixedVehicleCost();
@@ -119,6 +121,8 @@ Duration Solution::overtime() const { return overtime_; }
 
 Cost Solution::durationCost() const { return durationCost_; }
 
+Cost Solution::latenessCost() const { return latenessCost_; }
+
 std::vector<Load> const &Solution::excessLoad() const { return excessLoad_; }
 
 Distance Solution::excessDistance() const { return excessDistance_; }
@@ -240,7 +244,7 @@ Solution::Solution(ProblemData const &data, RandomNumberGenerator &rng)
     for (size_t idx = 0; idx != routes.size(); idx++)
         routes_.emplace_back(data, routes[idx], vehTypes[idx]);
 
-    *this = Solution(data, routes_);
+    *this = Solution(data, std::move(routes_));
 }
 
 Solution::Solution(ProblemData const &data,
@@ -251,7 +255,7 @@ Solution::Solution(ProblemData const &data,
     for (auto const &visits : routes)
         transformedRoutes.emplace_back(data, visits, 0);
 
-    *this = Solution(data, transformedRoutes);
+    *this = Solution(data, std::move(transformedRoutes));
 }
 
 Solution::Solution(ProblemData const &data, std::vector<Route> routes)
@@ -274,7 +278,7 @@ Solution::Solution(ProblemData const &data, std::vector<Route> routes)
         static_assert(std::ranges::input_range<Route>);
 
         usedVehicles[route.vehicleType()]++;
-        for (auto const &activity : route)
+        for (auto const &activity : route.activities())
         {
             switch (activity.type())
             {
@@ -375,6 +379,7 @@ Solution::Solution(size_t numClients,
                    Duration duration,
                    Duration overtime,
                    Cost durationCost,
+                   Cost latenessCost,
                    Distance excessDistance,
                    std::vector<Load> excessLoad,
                    Cost fixedVehicleCost,
@@ -392,6 +397,7 @@ Solution::Solution(size_t numClients,
       duration_(duration),
       overtime_(overtime),
       durationCost_(durationCost),
+      latenessCost_(latenessCost),
       excessDistance_(excessDistance),
       excessLoad_(std::move(excessLoad)),
       fixedVehicleCost_(fixedVehicleCost),
@@ -412,6 +418,59 @@ Cost pyvrp::CostEvaluator::penalisedCost(Solution const &solution) const
     return cost;
 }
 
+void Solution::save(std::filesystem::path const &path) const
+{
+    pyvrp::binary::Writer writer(path, pyvrp::binary::Kind::SOLUTION);
+
+    writer.write(routes_.size());
+    for (auto const &route : routes_)
+    {
+        // The start and end depots follow from the vehicle type, so we only
+        // write the activities in between.
+        auto const &activities = route.activities();
+        writer.write(route.vehicleType());
+        writer.write(activities.size() - 2);
+        for (size_t idx = 1; idx != activities.size() - 1; ++idx)
+        {
+            auto const &activity = activities[idx];
+            writer.write(static_cast<uint32_t>(activity.type()));
+            writer.write(activity.idx());
+        }
+    }
+}
+
+Solution Solution::load(std::filesystem::path const &path,
+                        ProblemData const &data)
+{
+    auto const contents = pyvrp::binary::readFile(path);
+    pyvrp::binary::Reader reader(
+        contents.data(), contents.size(), pyvrp::binary::Kind::SOLUTION);
+
+    Routes routes;
+    auto const numRoutes = reader.read<size_t>();
+    for (size_t route = 0; route != numRoutes; ++route)
+    {
+        auto const vehType = reader.read<size_t>();
+        auto const numActivities = reader.read<size_t>();
+
+        std::vector<Activity> activities;
+        for (size_t idx = 0; idx != numActivities; ++idx)
+        {
+            auto const type = reader.read<uint32_t>();
+            if (type > static_cast<uint32_t>(Activity::ActivityType::DELIVERY))
+                throw std::invalid_argument("Unknown activity type.");
+
+            auto const activityIdx = reader.read<size_t>();
+            activities.emplace_back(static_cast<Activity::ActivityType>(type),
+                                    activityIdx);
+        }
+
+        routes.emplace_back(data, activities, vehType);
+    }
+
+    return {data, routes};
+}
+
 std::ostream &operator<<(std::ostream &out, Solution const &sol)
 {
     auto const &routes = sol.routes();
@@ -8,6 +8,7 @@
 #include "RandomNumberGenerator.h"
 #include "Route.h"
 
+#include <filesystem>
 #include <functional>
 #include <iosfwd>
 #include <vector>
@@ -53,6 +54,7 @@ class Solution
     Duration duration_ = 0;           // Total duration over all routes
     Duration overtime_ = 0;           // Total overtime over all routes
     Cost durationCost_ = 0;           // Total cost of all routes' duration
+    Cost latenessCost_ = 0;           // Total lateness cost of all routes
     Distance excessDistance_ = 0;     // Total excess distance over all routes
     std::vector<Load> excessLoad_;    // Total excess load over all routes
     Cost fixedVehicleCost_ = 0;       // Fixed cost of all used vehicles
@@ -198,6 +200,11 @@ public:
      */
     [[nodiscard]] Cost durationCost() const;
 
+    /**
+     * Total lateness cost of all routes in this solution.
+     */
+    [[nodiscard]] Cost latenessCost() const;
+
     /**
      * Aggregate pickup or delivery loads in excess of the vehicle's capacity
      * of all routes.
@@ -231,6 +238,48 @@ public:
      */
     [[nodiscard]] Duration timeWarp() const;
 
+    /**
+     * save(path: str | os.PathLike)
+     *
+     * Writes this solution to the given path, in PyVRP's versioned,
+     * little-endian binary format. Only the routes are stored: all other
+     * solution statistics are recomputed when the solution is loaded again,
+     * using :meth:`~load`.
+     *
+     * Parameters
+     * ----------
+     * path
+     *     Filesystem location to write to.
+     */
+    void save(std::filesystem::path const &path) const;
+
+    /**
+     * Solution.load(path: str | os.PathLike, data: ProblemData) -> Solution
+     *
+     * Loads a solution from the given path. The file must have been written
+     * by :meth:`~save`.
+     *
+     * Parameters
+     * ----------
+     * path
+     *     Filesystem location to read from.
+     * data
+     *     Data instance the solution belongs to.
+     *
+     * Returns
+     * -------
+     * Solution
+     *     The solution stored in the given file.
+     *
+     * Raises
+     * ------
+     * ValueError
+     *     When the file is not a valid binary solution file, or was written
+     *     using an unsupported format version.
+     */
+    static Solution load(std::filesystem::path const &path,
+                         ProblemData const &data);
+
     bool operator==(Solution const &other) const;
 
     Solution(Solution const &other) = default;
@@ -274,6 +323,7 @@ public:
              Duration duration,
              Duration overtime,
              Cost durationCost,
+             Cost latenessCost,
              Distance excessDistance,
              std::vector<Load> excessLoad,
              Cost fixedVehicleCost,
@@ -0,0 +1,131 @@
+#ifndef PYVRP_SYMMETRICMATRIX_H
+#define PYVRP_SYMMETRICMATRIX_H
+
+#include "Matrix.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace pyvrp
+{
+/**
+ * Read-only symmetric square matrix, of which only the upper triangle
+ * (including the diagonal) is stored. That roughly halves memory use compared
+ * to a full Matrix. The triangle is stored column by column, so entry (i, j)
+ * is found at max(i, j) * (max(i, j) + 1) / 2 + min(i, j).
+ */
+template <typename T> class SymmetricMatrix
+{
+    size_t dim_ = 0;            // The number of rows and columns
+    std::vector<T> data_ = {};  // Upper triangle, column by column
+
+public:
+    SymmetricMatrix() = default;  // default is an empty matrix
+
+    /**
+     * Creates a symmetric matrix from the upper triangle of the given matrix.
+     * The given matrix must be symmetric.
+     *
+     * @param matrix Symmetric matrix to store.
+     */
+    explicit SymmetricMatrix(Matrix<T> const &matrix);
+
+    bool operator==(SymmetricMatrix const &other) const = default;
+
+    [[nodiscard]] T const &operator()(size_t row, size_t col) const;
+
+    [[nodiscard]] size_t numCols() const;
+
+    [[nodiscard]] size_t numRows() const;
+
+    /**
+     * @return Maximum element in the matrix.
+     */
+    [[nodiscard]] T max() const;
+
+    /**
+     * @return Number of stored elements.
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * Returns the square submatrix of the given rows and columns, in the given
+     * order. Entry (i, j) of the submatrix is entry (indices[i], indices[j])
+     * of this matrix.
+     *
+     * @param indices Indices of the rows and columns to select.
+     * @return A new (full) matrix of size indices.size() * indices.size().
+     */
+    [[nodiscard]] Matrix<T> submatrix(std::vector<size_t> const &indices) const;
+
+    /**
+     * @return A new (full) matrix with the same entries as this matrix.
+     */
+    [[nodiscard]] Matrix<T> unpack() const;
+};
+
+template <typename T>
+SymmetricMatrix<T>::SymmetricMatrix(Matrix<T> const &matrix)
+    : dim_(matrix.numRows())
+{
+    assert(matrix.isSymmetric());
+
+    data_.reserve(dim_ * (dim_ + 1) / 2);
+    for (size_t col = 0; col != dim_; ++col)
+        for (size_t row = 0; row <= col; ++row)
+            data_.push_back(matrix(row, col));
+}
+
+template <typename T>
+T const &SymmetricMatrix<T>::operator()(size_t row, size_t col) const
+{
+    auto const lo = std::min(row, col);
+    auto const hi = std::max(row, col);
+    return data_[hi * (hi + 1) / 2 + lo];
+}
+
+template <typename T> size_t SymmetricMatrix<T>::numCols() const
+{
+    return dim_;
+}
+
+template <typename T> size_t SymmetricMatrix<T>::numRows() const
+{
+    return dim_;
+}
+
+template <typename T> T SymmetricMatrix<T>::max() const
+{
+    return *std::max_element(data_.begin(), data_.end());
+}
+
+template <typename T> size_t SymmetricMatrix<T>::size() const
+{
+    return data_.size();
+}
+
+template <typename T>
+Matrix<T>
+SymmetricMatrix<T>::submatrix(std::vector<size_t> const &indices) const
+{
+    Matrix<T> sub(indices.size(), indices.size());
+    for (size_t row = 0; row != indices.size(); ++row)
+        for (size_t col = 0; col != indices.size(); ++col)
+            sub(row, col) = (*this)(indices[row], indices[col]);
+
+    return sub;
+}
+
+template <typename T> Matrix<T> SymmetricMatrix<T>::unpack() const
+{
+    Matrix<T> matrix(dim_, dim_);
+    for (size_t row = 0; row != dim_; ++row)
+        for (size_t col = 0; col != dim_; ++col)
+            matrix(row, col) = (*this)(row, col);
+
+    return matrix;
+}
+}  // namespace pyvrp
+
+#endif  // PYVRP_SYMMETRICMATRIX_H
@@ -23,6 +23,7 @@
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <pybind11/stl/filesystem.h>
 
 #include <cstdint>
 #include <memory>
@@ -168,13 +169,35 @@ PYBIND11_MODULE(_pyvrp, m)
              &PiecewiseLinearFunction::operator(),
              py::arg("x"),
              DOC(pyvrp, PiecewiseLinearFunction, __call__))
+        .def(
+            "evaluate",
+            [](PiecewiseLinearFunction const &function,
+               py::array_t<int64_t, py::array::c_style | py::array::forcecast>
+                   const &x)
+            {
+                std::vector<py::ssize_t> shape(x.shape(), x.shape() + x.ndim());
+                py::array_t<int64_t> out(shape);
+
+                auto const size = static_cast<size_t>(x.size());
+                function.evaluate({x.data(), size},
+                                  {out.mutable_data(), size});
+                return out;
+            },
+            py::arg("x"),
+            DOC(pyvrp, PiecewiseLinearFunction, evaluate))
+        .def("compose",
+             &PiecewiseLinearFunction::compose,
+             py::arg("inner"),
+             DOC(pyvrp, PiecewiseLinearFunction, compose))
+        .def("minimum",
+             &PiecewiseLinearFunction::minimum,
+             py::arg("other"),
+             DOC(pyvrp, PiecewiseLinearFunction, minimum))
         .def_property_readonly("breakpoints",
                                &PiecewiseLinearFunction::breakpoints,
-                               py::return_value_policy::reference_internal,
                                DOC(pyvrp, PiecewiseLinearFunction, breakpoints))
         .def_property_readonly("segments",
                                &PiecewiseLinearFunction::segments,
-                               py::return_value_policy::reference_internal,
                                DOC(pyvrp, PiecewiseLinearFunction, segments))
         .def("is_monotonically_increasing",
              &PiecewiseLinearFunction::isMonotonicallyIncreasing,
@@ -234,6 +257,7 @@ PYBIND11_MODULE(_pyvrp, m)
                       pyvrp::Cost,
                       bool,
                       std::optional<size_t>,
+                      std::optional<PiecewiseLinearFunction>,
                       char const *>(),
              py::arg("location"),
              py::arg("delivery") = py::list(),
@@ -245,6 +269,7 @@ PYBIND11_MODULE(_pyvrp, m)
              py::arg("prize") = 0,
              py::arg("required") = true,
              py::arg("group") = py::none(),
+             py::arg("lateness_cost") = py::none(),
              py::kw_only(),
              py::arg("name") = "")
         .def_readonly("location", &Client::location)
@@ -261,6 +286,7 @@ PYBIND11_MODULE(_pyvrp, m)
         .def_readonly("prize", &Client::prize)
         .def_readonly("required", &Client::required)
         .def_readonly("group", &Client::group)
+        .def_readonly("lateness_cost", &Client::latenessCost)
         .def_readonly("name",
                       &Client::name,
                       py::return_value_policy::reference_internal)
@@ -277,6 +303,7 @@ PYBIND11_MODULE(_pyvrp, m)
                                       client.prize,
                                       client.required,
                                       client.group,
+                                      client.latenessCost,
                                       client.name);
             },
             [](py::tuple t) {  // __setstate__
@@ -291,7 +318,8 @@ PYBIND11_MODULE(_pyvrp, m)
                     t[7].cast<pyvrp::Cost>(),               // prize
                     t[8].cast<bool>(),                      // required
                     t[9].cast<std::optional<size_t>>(),     // group
-                    t[10].cast<std::string>());             // name
+                    t[10].cast<std::optional<PiecewiseLinearFunction>>(),
+                    t[11].cast<std::string>());  // name
 
                 return client;
             }))
@@ -346,15 +374,18 @@ PYBIND11_MODULE(_pyvrp, m)
         .def(py::init<size_t,
                       pyvrp::Duration,
                       pyvrp::Duration,
-                      pyvrp::Duration>(),
+                      pyvrp::Duration,
+                      std::optional<PiecewiseLinearFunction>>(),
              py::arg("location"),
              py::arg("tw_early") = 0,
              py::arg("tw_late") = std::numeric_limits<pyvrp::Duration>::max(),
-             py::arg("service_duration") = 0)
+             py::arg("service_duration") = 0,
+             py::arg("lateness_cost") = py::none())
         .def_readonly("location", &Shipment::Step::location)
         .def_readonly("tw_early", &Shipment::Step::twEarly)
         .def_readonly("tw_late", &Shipment::Step::twLate)
         .def_readonly("service_duration", &Shipment::Step::serviceDuration)
+        .def_readonly("lateness_cost", &Shipment::Step::latenessCost)
         .def(py::self == py::self)  // this is __eq__
         .def(py::pickle(
             [](Shipment::Step const &step)  // __getstate__
@@ -362,14 +393,17 @@ PYBIND11_MODULE(_pyvrp, m)
                 return py::make_tuple(step.location,
                                       step.twEarly,
                                       step.twLate,
-                                      step.serviceDuration);
+                                      step.serviceDuration,
+                                      step.latenessCost);
             },
             [](py::tuple t)  // __setstate__
             {
-                Shipment::Step step(t[0].cast<size_t>(),            // location
-                                    t[1].cast<pyvrp::Duration>(),   // tw early
-                                    t[2].cast<pyvrp::Duration>(),   // tw late
-                                    t[3].cast<pyvrp::Duration>());  // service
+                using LatenessCost = std::optional<PiecewiseLinearFunction>;
+                Shipment::Step step(t[0].cast<size_t>(),           // location
+                                    t[1].cast<pyvrp::Duration>(),  // tw early
+                                    t[2].cast<pyvrp::Duration>(),  // tw late
+                                    t[3].cast<pyvrp::Duration>(),  // service
+                                    t[4].cast<LatenessCost>());    // lateness
 
                 return step;
             }));
@@ -386,6 +420,8 @@ PYBIND11_MODULE(_pyvrp, m)
                       std::vector<pyvrp::Load>,
                       pyvrp::Cost,
                       bool,
+                      std::optional<PiecewiseLinearFunction>,
+                      std::optional<PiecewiseLinearFunction>,
                       std::string>(),
              py::arg("pickup_location"),
              py::arg("delivery_location"),
@@ -400,6 +436,8 @@ PYBIND11_MODULE(_pyvrp, m)
              py::arg("amount") = py::list(),
              py::arg("prize") = 0,
              py::arg("required") = true,
+             py::arg("pickup_lateness_cost") = py::none(),
+             py::arg("delivery_lateness_cost") = py::none(),
              py::kw_only(),
              py::arg("name") = "")
         .def_readonly("pickup",
@@ -629,13 +667,16 @@ PYBIND11_MODULE(_pyvrp, m)
             [](VehicleType const &vehType) { return vehType.name; },
             py::return_value_policy::reference_internal);
 
-    py::class_<ProblemData>(m, "ProblemData", DOC(pyvrp, ProblemData))
+    // ProblemData is held by shared pointer, so routes can keep the data alive
+    // until they need it to compute their schedules.
+    py::class_<ProblemData, std::shared_ptr<ProblemData>>(
+        m, "ProblemData", DOC(pyvrp, ProblemData))
         .def(py::init<std::vector<Location>,
                       std::vector<Client>,
                       std::vector<Depot>,
                       std::vector<VehicleType>,
-                      std::vector<Matrix<pyvrp::Distance>>,
-                      std::vector<Matrix<pyvrp::Duration>>,
+                      std::vector<pyvrp::ProfileMatrix<pyvrp::Distance>>,
+                      std::vector<pyvrp::ProfileMatrix<pyvrp::Duration>>,
                       std::vector<ClientGroup>,
                       std::vector<Shipment>>(),
              py::arg("locations"),
@@ -657,6 +698,66 @@ PYBIND11_MODULE(_pyvrp, m)
              py::arg("groups") = py::none(),
              py::arg("shipments") = py::none(),
              DOC(pyvrp, ProblemData, replace))
+        .def_static(
+            "from_edges",
+            [](std::vector<Location> locations,
+               std::vector<Client> clients,
+               std::vector<Depot> depots,
+               std::vector<VehicleType> vehicleTypes,
+               std::vector<py::tuple> const &edges,
+               int64_t missingValue,
+               std::vector<ClientGroup> groups,
+               std::vector<Shipment> shipments)
+            {
+                using Array = py::array_t<int64_t, py::array::c_style
+                                                       | py::array::forcecast>;
+
+                auto const copy = [](py::handle src, auto &dest)
+                {
+                    auto const arr = src.cast<Array>();
+                    dest.assign(arr.data(), arr.data() + arr.size());
+                };
+
+                std::vector<ProblemData::Edges> profiles(edges.size());
+                for (size_t idx = 0; idx != edges.size(); ++idx)
+                {
+                    if (edges[idx].size() != 4)
+                        throw py::value_error("Expected four edge arrays.");
+
+                    copy(edges[idx][0], profiles[idx].origins);
+                    copy(edges[idx][1], profiles[idx].destinations);
+                    copy(edges[idx][2], profiles[idx].distances);
+                    copy(edges[idx][3], profiles[idx].durations);
+                }
+
+                return ProblemData::fromEdges(std::move(locations),
+                                              std::move(clients),
+                                              std::move(depots),
+                                              std::move(vehicleTypes),
+                                              profiles,
+                                              missingValue,
+                                              missingValue,
+                                              std::move(groups),
+                                              std::move(shipments));
+            },
+            py::arg("locations"),
+            py::arg("clients"),
+            py::arg("depots"),
+            py::arg("vehicle_types"),
+            py::arg("edges"),
+            py::arg("missing_value"),
+            py::arg("groups") = py::list(),
+            py::arg("shipments") = py::list(),
+            DOC(pyvrp, ProblemData, fromEdges))
+        .def("save",
+             &ProblemData::save,
+             py::arg("path"),
+             DOC(pyvrp, ProblemData, save))
+        .def_static("load",
+                    &ProblemData::load,
+                    py::arg("path"),
+                    py::arg("mmap") = true,
+                    DOC(pyvrp, ProblemData, load))
         .def_property_readonly("num_clients",
                                &ProblemData::numClients,
                                DOC(pyvrp, ProblemData, numClients))
@@ -784,9 +885,26 @@ PYBIND11_MODULE(_pyvrp, m)
              py::arg("profile"),
              py::return_value_policy::reference_internal,
              DOC(pyvrp, ProblemData, durationMatrix))
+        .def("distance_submatrix",
+             &ProblemData::distanceSubmatrix,
+             py::arg("profile"),
+             py::arg("locations"),
+             DOC(pyvrp, ProblemData, distanceSubmatrix))
+        .def("duration_submatrix",
+             &ProblemData::durationSubmatrix,
+             py::arg("profile"),
+             py::arg("locations"),
+             DOC(pyvrp, ProblemData, durationSubmatrix))
         .def("has_time_windows",
              &ProblemData::hasTimeWindows,
              DOC(pyvrp, ProblemData, hasTimeWindows))
+        .def("has_lateness_costs",
+             &ProblemData::hasLatenessCosts,
+             DOC(pyvrp, ProblemData, hasLatenessCosts))
+        .def("is_symmetric",
+             &ProblemData::isSymmetric,
+             py::arg("profile"),
+             DOC(pyvrp, ProblemData, isSymmetric))
         .def(py::self == py::self)  // this is __eq__
         .def(py::pickle(
             [](ProblemData const &data) {  // __getstate__
@@ -804,8 +922,9 @@ PYBIND11_MODULE(_pyvrp, m)
                 using Clients = std::vector<Client>;
                 using Depots = std::vector<Depot>;
                 using VehicleTypes = std::vector<VehicleType>;
-                using DistMats = std::vector<pyvrp::Matrix<pyvrp::Distance>>;
-                using DurMats = std::vector<pyvrp::Matrix<pyvrp::Duration>>;
+                using pyvrp::ProfileMatrix;
+                using DistMats = std::vector<ProfileMatrix<pyvrp::Distance>>;
+                using DurMats = std::vector<ProfileMatrix<pyvrp::Duration>>;
                 using Groups = std::vector<ClientGroup>;
                 using Shipments = std::vector<Shipment>;
 
@@ -905,6 +1024,9 @@ PYBIND11_MODULE(_pyvrp, m)
         .def("duration_cost",
              &Route::durationCost,
              DOC(pyvrp, Route, durationCost))
+        .def("lateness_cost",
+             &Route::latenessCost,
+             DOC(pyvrp, Route, latenessCost))
         .def("time_warp", &Route::timeWarp, DOC(pyvrp, Route, timeWarp))
         .def("start_time", &Route::startTime, DOC(pyvrp, Route, startTime))
         .def("end_time", &Route::endTime, DOC(pyvrp, Route, endTime))
@@ -939,6 +1061,10 @@ PYBIND11_MODULE(_pyvrp, m)
              &Route::schedule,
              py::return_value_policy::reference_internal,
              DOC(pyvrp, Route, schedule))
+        .def("activities",
+             &Route::activities,
+             py::return_value_policy::reference_internal,
+             DOC(pyvrp, Route, activities))
         .def("__len__", &Route::size, DOC(pyvrp, Route, size))
         .def(
             "__iter__",
@@ -968,6 +1094,7 @@ PYBIND11_MODULE(_pyvrp, m)
                                       route.duration(),
                                       route.overtime(),
                                       route.durationCost(),
+                                      route.latenessCost(),
                                       route.timeWarp(),
                                       route.travelDuration(),
                                       route.serviceDuration(),
@@ -992,15 +1119,16 @@ PYBIND11_MODULE(_pyvrp, m)
                     t[7].cast<pyvrp::Duration>(),           // duration
                     t[8].cast<pyvrp::Duration>(),           // overtime
                     t[9].cast<pyvrp::Cost>(),               // duration cost
-                    t[10].cast<pyvrp::Duration>(),          // time warp
-                    t[11].cast<pyvrp::Duration>(),          // travel
-                    t[12].cast<pyvrp::Duration>(),          // service
-                    t[13].cast<pyvrp::Duration>(),          // start time
-                    t[14].cast<pyvrp::Duration>(),          // release time
-                    t[15].cast<pyvrp::Duration>(),          // slack
-                    t[16].cast<pyvrp::Cost>(),              // prizes
-                    t[17].cast<size_t>(),                   // vehicle type
-                    t[18].cast<size_t>());                  // num shipments
+                    t[10].cast<pyvrp::Cost>(),              // lateness cost
+                    t[11].cast<pyvrp::Duration>(),          // time warp
+                    t[12].cast<pyvrp::Duration>(),          // travel
+                    t[13].cast<pyvrp::Duration>(),          // service
+                    t[14].cast<pyvrp::Duration>(),          // start time
+                    t[15].cast<pyvrp::Duration>(),          // release time
+                    t[16].cast<pyvrp::Duration>(),          // slack
+                    t[17].cast<pyvrp::Cost>(),              // prizes
+                    t[18].cast<size_t>(),                   // vehicle type
+                    t[19].cast<size_t>());                  // num shipments
 
                 return route;
             }))
@@ -1090,6 +1218,9 @@ PYBIND11_MODULE(_pyvrp, m)
         .def("duration_cost",
              &Solution::durationCost,
              DOC(pyvrp, Solution, durationCost))
+        .def("lateness_cost",
+             &Solution::latenessCost,
+             DOC(pyvrp, Solution, latenessCost))
         .def("excess_load",
              &Solution::excessLoad,
              DOC(pyvrp, Solution, excessLoad))
@@ -1104,6 +1235,15 @@ PYBIND11_MODULE(_pyvrp, m)
         .def("uncollected_prizes",
              &Solution::uncollectedPrizes,
              DOC(pyvrp, Solution, uncollectedPrizes))
+        .def("save",
+             &Solution::save,
+             py::arg("path"),
+             DOC(pyvrp, Solution, save))
+        .def_static("load",
+                    &Solution::load,
+                    py::arg("path"),
+                    py::arg("data"),
+                    DOC(pyvrp, Solution, load))
         .def("__copy__", [](Solution const &sol) { return Solution(sol); })
         .def(
             "__deepcopy__",
@@ -1125,6 +1265,7 @@ PYBIND11_MODULE(_pyvrp, m)
                                       sol.duration(),
                                       sol.overtime(),
                                       sol.durationCost(),
+                                      sol.latenessCost(),
                                       sol.excessDistance(),
                                       sol.excessLoad(),
                                       sol.fixedVehicleCost(),
@@ -1147,13 +1288,14 @@ PYBIND11_MODULE(_pyvrp, m)
                     t[7].cast<pyvrp::Duration>(),   // duration
                     t[8].cast<pyvrp::Duration>(),   // overtime
                     t[9].cast<pyvrp::Cost>(),       // duration cost
-                    t[10].cast<pyvrp::Distance>(),  // excess distance
-                    t[11].cast<std::vector<pyvrp::Load>>(),  // excess load
-                    t[12].cast<pyvrp::Cost>(),               // fixed veh cost
-                    t[13].cast<pyvrp::Cost>(),               // prizes
-                    t[14].cast<pyvrp::Cost>(),               // uncollected
-                    t[15].cast<pyvrp::Duration>(),           // time warp
-                    t[16].cast<Routes>());                   // routes
+                    t[10].cast<pyvrp::Cost>(),      // lateness cost
+                    t[11].cast<pyvrp::Distance>(),  // excess distance
+                    t[12].cast<std::vector<pyvrp::Load>>(),  // excess load
+                    t[13].cast<pyvrp::Cost>(),               // fixed veh cost
+                    t[14].cast<pyvrp::Cost>(),               // prizes
+                    t[15].cast<pyvrp::Cost>(),               // uncollected
+                    t[16].cast<pyvrp::Duration>(),           // time warp
+                    t[17].cast<Routes>());                   // routes
 
                 return sol;
             }))
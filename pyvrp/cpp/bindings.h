@@ -3,6 +3,7 @@
 
 #include "Matrix.h"
 #include "Measure.h"
+#include "SymmetricMatrix.h"
 
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
@@ -73,6 +74,41 @@ struct type_caster<pyvrp::Matrix<pyvrp::Measure<T, V>>>
     }
 };
 
+// Type caster for symmetric matrices of integral measures. Only the upper
+// triangle of such matrices is stored, so these cannot be returned as a view,
+// and are copied in full instead.
+template <pyvrp::MeasureType T, std::integral V>
+struct type_caster<pyvrp::SymmetricMatrix<pyvrp::Measure<T, V>>>
+{
+    PYBIND11_TYPE_CASTER(
+        pyvrp::SymmetricMatrix<pyvrp::Measure<T PYVRP_PARAM_SEP V>>,
+        _("numpy.ndarray[int]"));
+
+    bool load([[maybe_unused]] pybind11::handle src,  // Python -> C++
+              [[maybe_unused]] bool convert)
+    {
+        return false;  // symmetric matrices are only created on the C++ side
+    }
+
+    static pybind11::handle
+    cast(pyvrp::SymmetricMatrix<pyvrp::Measure<T, V>> const &src,  // C++ ->
+         [[maybe_unused]] pybind11::return_value_policy policy,    // Python
+         [[maybe_unused]] pybind11::handle parent)
+    {
+        pybind11::array_t<V> array({src.numRows(), src.numCols()});
+        auto out = array.template mutable_unchecked<2>();
+        for (size_t row = 0; row != src.numRows(); ++row)
+            for (size_t col = 0; col != src.numCols(); ++col)
+                out(row, col) = src(row, col).get();
+
+        // Like regular matrices, the copy is not writeable on the Python side.
+        pybind11::detail::array_proxy(array.ptr())->flags
+            &= ~pybind11::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+
+        return array.release();
+    }
+};
+
 // Caster for integral-valued measures.
 template <pyvrp::MeasureType T, std::integral V>
 struct type_caster<pyvrp::Measure<T, V>>
@@ -0,0 +1,129 @@
+#include "EliminateRoute.h"
+
+#include "ClientSegment.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+using pyvrp::search::EliminateRoute;
+
+size_t EliminateRoute::indexOf(Route const *route) const
+{
+    assert(solution_);
+    Route const *first = solution_->routes.data();
+    return std::distance(first, route);
+}
+
+std::pair<pyvrp::Cost, bool>
+EliminateRoute::evaluate(Route::Node *U, CostEvaluator const &costEvaluator)
+{
+    stats_.numEvaluations++;
+
+    auto *route = U->route();
+    if (!U->isClient() || !route || !solution_ || !searchSpace_)
+        return std::make_pair(0, false);
+
+    auto const routeIdx = indexOf(route);
+    if (isEvaluated_[routeIdx] || route->numShipments() != 0)
+        return std::make_pair(0, false);
+
+    isEvaluated_[routeIdx] = true;
+    moves_.clear();
+    targets_.clear();
+
+    // Emptying the route saves its entire cost, including fixed vehicle cost.
+    // Each client's insertion elsewhere must be paid for from this budget.
+    Cost deltaCost = -costEvaluator.penalisedCost(*route);
+    for (auto *node : *route)
+    {
+        if (!node->isClient())
+            continue;
+
+        Move best = {node, nullptr};
+        Cost bestCost = 0;
+
+        auto const eval = [&](Route::Node *after)
+        {
+            auto const *target = after->route();
+
+            // Starts from the running delta, so the cost evaluator can stop
+            // early once this insertion cannot keep the total negative.
+            Cost cost = deltaCost;
+            costEvaluator.deltaCost(
+                cost,
+                Route::Proposal(target->before(after->pos()),
+                                ClientSegment(data, node->idx()),
+                                target->after(after->pos() + 1)));
+
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                best.after = after;
+            }
+        };
+
+        Activity const activity(Activity::ActivityType::CLIENT, node->idx());
+        for (auto const &vActivity : searchSpace_->neighboursOf(activity))
+        {
+            auto *V = (*solution_)[vActivity];
+            auto const *target = V->route();
+
+            if (!target || target == route
+                || std::ranges::find(targets_, target) != targets_.end())
+                continue;
+
+            eval(V);
+            if (p(V)->isStartDepot())
+                eval(p(V));
+        }
+
+        if (!best.after)  // then this client cannot be inserted elsewhere at
+            return std::make_pair(0, false);  // low enough cost
+
+        deltaCost = bestCost;
+        moves_.push_back(best);
+        targets_.push_back(best.after->route());
+    }
+
+    return std::make_pair(deltaCost, deltaCost < 0);
+}
+
+void EliminateRoute::apply(Route::Node *U) const
+{
+    assert(U->isClient() && U->route());
+    assert(!moves_.empty() && moves_.front().node->route() == U->route());
+    stats_.numApplications++;
+
+    // Clearing unassigns all clients, and removes any reload depots.
+    U->route()->clear();
+
+    for (auto const &[node, after] : moves_)
+        after->route()->insert(after->pos() + 1, node);
+}
+
+void EliminateRoute::init(Solution &solution)
+{
+    UnaryOperator::init(solution);
+    solution_ = &solution;
+    isEvaluated_.reset();
+}
+
+std::string EliminateRoute::name() const { return "EliminateRoute"; }
+
+bool EliminateRoute::supports(ProblemData const &data)
+{
+    return data.numVehicles() > 1;
+}
+
+void EliminateRoute::update([[maybe_unused]] Route const *route)
+{
+    // Any change to the solution may open up new insertion positions, so all
+    // routes need to be evaluated again.
+    isEvaluated_.reset();
+}
+
+EliminateRoute::EliminateRoute(ProblemData const &data)
+    : UnaryOperator(data), isEvaluated_(data.numVehicles())
+{
+}
@@ -0,0 +1,62 @@
+#ifndef PYVRP_SEARCH_ELIMINATEROUTE_H
+#define PYVRP_SEARCH_ELIMINATEROUTE_H
+
+#include "DynamicBitset.h"
+#include "LocalSearchOperator.h"
+
+#include <vector>
+
+namespace pyvrp::search
+{
+/**
+ * EliminateRoute(data: ProblemData)
+ *
+ * Evaluates emptying the route of client node :math:`U`, by relocating each
+ * of its clients into another route in the client's granular neighbourhood.
+ * Clients are relocated in route order, each to its best insertion position,
+ * and each other route receives at most one client. The move is applied only
+ * when the total cost delta, including the saved fixed vehicle cost of the
+ * emptied route, is negative.
+ *
+ * Each route is evaluated at most once between changes to the solution, and
+ * only routes without shipments are considered. The evaluation stops as soon
+ * as the cost delta of the insertions evaluated so far cannot become negative
+ * anymore. This operator needs the granular neighbourhood of the local search
+ * it is added to, and does not find improving moves otherwise.
+ */
+class EliminateRoute : public UnaryOperator
+{
+    struct Move
+    {
+        Route::Node *node;
+        Route::Node *after;
+    };
+
+    Solution *solution_ = nullptr;
+
+    std::vector<Move> moves_;
+    std::vector<Route const *> targets_;
+    DynamicBitset isEvaluated_;
+
+    // Returns the index of the given route in the solution.
+    size_t indexOf(Route const *route) const;
+
+public:
+    std::pair<Cost, bool> evaluate(Route::Node *U,
+                                   CostEvaluator const &costEvaluator) override;
+
+    void apply(Route::Node *U) const override;
+
+    void init(Solution &solution) override;
+
+    std::string name() const override;
+
+    static bool supports(ProblemData const &data);
+
+    void update(Route const *route) override;
+
+    EliminateRoute(ProblemData const &data);
+};
+}  // namespace pyvrp::search
+
+#endif  // PYVRP_SEARCH_ELIMINATEROUTE_H
@@ -0,0 +1,611 @@
+#include "GeneticAlgorithm.h"
+
+#include "DynamicBitset.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <exception>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+using pyvrp::Activity;
+using pyvrp::DynamicBitset;
+using pyvrp::ProblemData;
+using pyvrp::search::GeneticAlgorithm;
+using pyvrp::search::GeneticAlgorithmParams;
+
+namespace
+{
+// Maximum number of attempts to select a second parent that differs from the
+// first parent.
+constexpr size_t MAX_PARENT_SELECTION_TRIES = 10;
+
+using Neighbours = std::vector<std::pair<size_t, size_t>>;
+
+// Encodes client and shipment activities as indices: first the clients, then
+// the pickups, and then the deliveries. All depots are encoded as the same
+// index, directly after the deliveries.
+size_t encode(ProblemData const &data, Activity const &activity)
+{
+    switch (activity.type())
+    {
+    case Activity::ActivityType::CLIENT:
+        return activity.idx();
+
+    case Activity::ActivityType::PICKUP:
+        return data.numClients() + activity.idx();
+
+    case Activity::ActivityType::DELIVERY:
+        return data.numClients() + data.numShipments() + activity.idx();
+
+    default:
+        return data.numClients() + 2 * data.numShipments();
+    }
+}
+
+// Returns the (predecessor, successor) pair of each client and shipment
+// activity in the given solution. Unplanned activities have no predecessor
+// or successor, which is encoded as the index directly after the depots.
+Neighbours neighbours(ProblemData const &data, pyvrp::Solution const &solution)
+{
+    auto const numActivities = data.numClients() + 2 * data.numShipments();
+    auto const unplanned = numActivities + 1;  // numActivities is the depot
+
+    Neighbours neighbours(numActivities, {unplanned, unplanned});
+    for (auto const &route : solution.routes())
+    {
+        auto const &activities = route.activities();
+        for (size_t idx = 1; idx + 1 < activities.size(); ++idx)
+        {
+            if (activities[idx].isDepot())
+                continue;
+
+            auto const pred = encode(data, activities[idx - 1]);
+            auto const succ = encode(data, activities[idx + 1]);
+            neighbours[encode(data, activities[idx])] = {pred, succ};
+        }
+    }
+
+    return neighbours;
+}
+
+double distance(Neighbours const &first, Neighbours const &second)
+{
+    assert(first.size() == second.size());
+    if (first.empty())
+        return 0.0;
+
+    size_t numBroken = 0;
+    for (size_t idx = 0; idx != first.size(); ++idx)
+    {
+        numBroken += first[idx].first != second[idx].first;
+        numBroken += first[idx].second != second[idx].second;
+    }
+
+    return numBroken / (2.0 * first.size());
+}
+
+// Returns the location of the given client or shipment activity.
+size_t location(ProblemData const &data, Activity const &activity)
+{
+    switch (activity.type())
+    {
+    case Activity::ActivityType::CLIENT:
+        return data.client(activity.idx()).location;
+
+    case Activity::ActivityType::PICKUP:
+        return data.shipment(activity.idx()).pickup.location;
+
+    case Activity::ActivityType::DELIVERY:
+        return data.shipment(activity.idx()).delivery.location;
+
+    default:
+        return data.depot(activity.idx()).location;
+    }
+}
+
+// Returns the indices of the given routes, sorted by the polar angle of their
+// centroid around the centre of the depots.
+std::vector<size_t> angleOrder(ProblemData const &data,
+                               std::vector<pyvrp::Route> const &routes)
+{
+    double depotX = 0;
+    double depotY = 0;
+    for (auto const &depot : data.depots())
+    {
+        auto const &loc = data.location(depot.location);
+        depotX += static_cast<double>(loc.x.get()) / data.numDepots();
+        depotY += static_cast<double>(loc.y.get()) / data.numDepots();
+    }
+
+    std::vector<double> angles;
+    angles.reserve(routes.size());
+    for (auto const &route : routes)
+    {
+        double x = 0;
+        double y = 0;
+        size_t count = 0;
+        for (auto const &activity : route.activities())
+            if (!activity.isDepot())
+            {
+                auto const &loc = data.location(location(data, activity));
+                x += static_cast<double>(loc.x.get());
+                y += static_cast<double>(loc.y.get());
+                count++;
+            }
+
+        angles.push_back(std::atan2(y / count - depotY, x / count - depotX));
+    }
+
+    std::vector<size_t> order(routes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&](auto lhs, auto rhs)
+                     { return angles[lhs] < angles[rhs]; });
+
+    return order;
+}
+
+// Encodes clients and shipments as visits: first the clients, then the
+// shipments. Returns nullopt for depots.
+std::optional<size_t> visit(ProblemData const &data, Activity const &activity)
+{
+    if (activity.isClient())
+        return activity.idx();
+
+    if (activity.isShipment())
+        return data.numClients() + activity.idx();
+
+    return std::nullopt;
+}
+
+// Marks the clients and shipments visited by the given route.
+void markVisits(ProblemData const &data,
+                pyvrp::Route const &route,
+                DynamicBitset &visited)
+{
+    for (auto const &activity : route.activities())
+        if (auto const idx = visit(data, activity))
+            visited[*idx] = true;
+}
+}  // namespace
+
+GeneticAlgorithmParams::GeneticAlgorithmParams(size_t minPopSize,
+                                               size_t generationSize,
+                                               size_t numElite,
+                                               size_t numClose,
+                                               size_t numThreads)
+    : minPopSize(minPopSize),
+      generationSize(generationSize),
+      numElite(numElite),
+      numClose(numClose),
+      numThreads(numThreads)
+{
+    if (minPopSize == 0)
+        throw std::invalid_argument("min_pop_size must be positive.");
+
+    if (numElite > minPopSize)
+        throw std::invalid_argument("num_elite must be <= min_pop_size.");
+
+    if (numClose == 0)
+        throw std::invalid_argument("num_close must be positive.");
+
+    if (numThreads == 0)
+        throw std::invalid_argument("num_threads must be positive.");
+}
+
+double GeneticAlgorithm::Item::avgDistanceClosest(size_t numClose) const
+{
+    auto const num = std::min(numClose, proximity.size());
+    if (num == 0)
+        return 0.0;
+
+    double total = 0.0;
+    for (size_t idx = 0; idx != num; ++idx)
+        total += proximity[idx].first;
+
+    return total / num;
+}
+
+void GeneticAlgorithm::updateFitness(SubPopulation &subPop,
+                                     CostEvaluator const &costEvaluator) const
+{
+    auto const size = subPop.size();
+    if (size == 0)
+        return;
+
+    std::vector<Cost> costs;
+    std::vector<double> diversity;
+    costs.reserve(size);
+    diversity.reserve(size);
+    for (auto const &item : subPop)
+    {
+        costs.push_back(costEvaluator.penalisedCost(item->solution));
+        diversity.push_back(item->avgDistanceClosest(params_.numClose));
+    }
+
+    std::vector<size_t> byCost(size);
+    std::iota(byCost.begin(), byCost.end(), 0);
+    std::stable_sort(byCost.begin(),
+                     byCost.end(),
+                     [&](auto lhs, auto rhs)
+                     { return costs[lhs] < costs[rhs]; });
+
+    std::vector<size_t> byDiversity(size);  // most diverse first
+    std::iota(byDiversity.begin(), byDiversity.end(), 0);
+    std::stable_sort(byDiversity.begin(),
+                     byDiversity.end(),
+                     [&](auto lhs, auto rhs)
+                     { return diversity[lhs] > diversity[rhs]; });
+
+    // The biased fitness is the normalised cost rank, plus the normalised
+    // diversity rank weighted by the fraction of non-elite solutions. Lower
+    // is better.
+    auto const denom = std::max<size_t>(size - 1, 1);
+    auto const numElite = std::min(params_.numElite, size);
+    auto const divWeight = 1.0 - static_cast<double>(numElite) / size;
+
+    for (size_t rank = 0; rank != size; ++rank)
+    {
+        subPop[byCost[rank]]->fitness = static_cast<double>(rank) / denom;
+    }
+
+    for (size_t rank = 0; rank != size; ++rank)
+    {
+        auto const divRank = static_cast<double>(rank) / denom;
+        subPop[byDiversity[rank]]->fitness += divWeight * divRank;
+    }
+}
+
+void GeneticAlgorithm::remove(SubPopulation &subPop, size_t idx) const
+{
+    auto const *item = subPop[idx].get();
+    for (auto &other : subPop)
+        std::erase_if(other->proximity,
+                      [&](auto const &pair) { return pair.second == item; });
+
+    subPop.erase(subPop.begin() + idx);
+}
+
+void GeneticAlgorithm::survivorSelection(
+    SubPopulation &subPop, CostEvaluator const &costEvaluator) const
+{
+    while (subPop.size() > params_.minPopSize)
+    {
+        updateFitness(subPop, costEvaluator);
+
+        // Remove duplicates first, and otherwise the solution with the worst
+        // biased fitness.
+        auto const key = [](auto const &item)
+        {
+            auto const isDuplicate = !item->proximity.empty()
+                                     && item->proximity.front().first == 0.0;
+            return std::make_pair(isDuplicate, item->fitness);
+        };
+
+        auto const worst = std::max_element(
+            subPop.begin(),
+            subPop.end(),
+            [&](auto const &lhs, auto const &rhs)
+            { return key(lhs) < key(rhs); });
+
+        remove(subPop, std::distance(subPop.begin(), worst));
+    }
+}
+
+pyvrp::Solution const &
+GeneticAlgorithm::select(RandomNumberGenerator &rng) const
+{
+    auto const size = feasible_.size() + infeasible_.size();
+    auto const get = [&](size_t idx) -> Item const &
+    {
+        return idx < feasible_.size() ? *feasible_[idx]
+                                      : *infeasible_[idx - feasible_.size()];
+    };
+
+    auto const &first = get(rng.randint(size));
+    auto const &second = get(rng.randint(size));
+    return first.fitness < second.fitness ? first.solution : second.solution;
+}
+
+GeneticAlgorithm::GeneticAlgorithm(ProblemData const &data,
+                                   std::vector<LocalSearch *> searches,
+                                   GeneticAlgorithmParams params)
+    : data_(data), searches_(std::move(searches)), params_(params)
+{
+    if (searches_.size() != params_.numThreads)
+        throw std::invalid_argument("Expected num_threads local searches.");
+
+    for (size_t idx = 0; idx != searches_.size(); ++idx)
+        for (size_t other = 0; other != idx; ++other)
+            if (searches_[idx] == searches_[other])
+                throw std::invalid_argument("Local searches must be distinct.");
+}
+
+void GeneticAlgorithm::add(pyvrp::Solution const &solution,
+                           CostEvaluator const &costEvaluator)
+{
+    auto &subPop = solution.isFeasible() ? feasible_ : infeasible_;
+    auto item = std::make_unique<Item>(solution, neighbours(data_, solution));
+
+    // Distances to the existing items are computed once, here, and stored
+    // in sorted order in the proximity lists of both items.
+    auto const cmp = [](double dist, auto const &pair)
+    { return dist < pair.first; };
+
+    for (auto &other : subPop)
+    {
+        auto const dist = distance(item->neighbours, other->neighbours);
+
+        auto &otherProx = other->proximity;
+        auto const otherPos
+            = std::upper_bound(otherProx.begin(), otherProx.end(), dist, cmp);
+        otherProx.emplace(otherPos, dist, item.get());
+
+        auto &itemProx = item->proximity;
+        auto const itemPos
+            = std::upper_bound(itemProx.begin(), itemProx.end(), dist, cmp);
+        itemProx.emplace(itemPos, dist, other.get());
+    }
+
+    subPop.push_back(std::move(item));
+
+    if (subPop.size() > params_.minPopSize + params_.generationSize)
+        survivorSelection(subPop, costEvaluator);
+}
+
+std::vector<pyvrp::Solution>
+GeneticAlgorithm::step(CostEvaluator const &costEvaluator,
+                       RandomNumberGenerator &rng)
+{
+    if (feasible_.empty() && infeasible_.empty())
+        throw std::runtime_error("Population is empty.");
+
+    updateFitness(feasible_, costEvaluator);
+    updateFitness(infeasible_, costEvaluator);
+
+    auto const popSize = feasible_.size() + infeasible_.size();
+    auto const numOffspring = searches_.size();
+
+    std::vector<pyvrp::Solution> parents;  // unrefined offspring
+    std::vector<uint32_t> seeds;
+    parents.reserve(numOffspring);
+    seeds.reserve(numOffspring);
+
+    for (size_t idx = 0; idx != numOffspring; ++idx)
+    {
+        auto const &first = select(rng);
+        auto const *second = &select(rng);
+        for (size_t tries = 1; popSize > 1 && second == &first
+                               && tries != MAX_PARENT_SELECTION_TRIES;
+             ++tries)
+            second = &select(rng);
+
+        parents.push_back(srex(first, *second, data_, costEvaluator, rng));
+        seeds.push_back(rng());
+    }
+
+    // Education is the most expensive part of each generation. Each offspring
+    // is educated by its own local search, on its own thread. The threads do
+    // not share any mutable state.
+    std::vector<std::optional<pyvrp::Solution>> educated(numOffspring);
+    std::vector<std::exception_ptr> errors(numOffspring);
+    auto const educate = [&](size_t idx)
+    {
+        try
+        {
+            RandomNumberGenerator threadRng(seeds[idx]);
+            CostEvaluator const threadCostEvaluator = costEvaluator;
+
+            auto &search = *searches_[idx];
+            search.shuffle(threadRng);
+            educated[idx].emplace(
+                search(parents[idx], threadCostEvaluator, true));
+        }
+        catch (...)
+        {
+            errors[idx] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numOffspring - 1);
+    for (size_t idx = 1; idx < numOffspring; ++idx)
+        threads.emplace_back(educate, idx);
+
+    educate(0);  // the calling thread educates the first offspring
+
+    for (auto &thread : threads)
+        thread.join();
+
+    for (auto const &error : errors)
+        if (error)
+            std::rethrow_exception(error);
+
+    std::vector<pyvrp::Solution> offspring;
+    offspring.reserve(numOffspring);
+    for (auto &sol : educated)
+    {
+        add(*sol, costEvaluator);
+        offspring.push_back(std::move(*sol));
+    }
+
+    return offspring;
+}
+
+size_t GeneticAlgorithm::numFeasible() const { return feasible_.size(); }
+
+size_t GeneticAlgorithm::numInfeasible() const { return infeasible_.size(); }
+
+double pyvrp::search::brokenPairsDistance(ProblemData const &data,
+                                          pyvrp::Solution const &first,
+                                          pyvrp::Solution const &second)
+{
+    return distance(neighbours(data, first), neighbours(data, second));
+}
+
+pyvrp::Solution pyvrp::search::srex(pyvrp::Solution const &first,
+                                    pyvrp::Solution const &second,
+                                    ProblemData const &data,
+                                    CostEvaluator const &costEvaluator,
+                                    RandomNumberGenerator &rng)
+{
+    auto const &routesA = first.routes();
+    auto const &routesB = second.routes();
+
+    if (routesA.empty())
+        return second;
+
+    if (routesB.empty())
+        return first;
+
+    auto const nA = routesA.size();
+    auto const nB = routesB.size();
+
+    auto const orderA = angleOrder(data, routesA);
+    auto const orderB = angleOrder(data, routesB);
+
+    auto const numMoved = 1 + rng.randint(std::min(nA, nB));
+    auto const startA = rng.randint(nA);
+    size_t startB = rng.randint(nB);
+
+    auto const numVisits = data.numClients() + data.numShipments();
+    auto const selected = [&](auto const &routes,
+                              auto const &order,
+                              size_t start)
+    {
+        DynamicBitset visited(numVisits);
+        for (size_t count = 0; count != numMoved; ++count)
+        {
+            auto const idx = order[(start + count) % routes.size()];
+            markVisits(data, routes[idx], visited);
+        }
+
+        return visited;
+    };
+
+    // Shift the routes selected from the second parent while that reduces the
+    // number of visits that differ from the routes selected from the first
+    // parent. The selected routes then cover similar regions.
+    auto const inA = selected(routesA, orderA, startA);
+    auto const difference = [&](size_t start)
+    { return (inA ^ selected(routesB, orderB, start)).count(); };
+
+    auto bestDiff = difference(startB);
+    for (size_t shifts = 0; shifts != nB; ++shifts)
+    {
+        auto const left = (startB + nB - 1) % nB;
+        auto const right = (startB + 1) % nB;
+
+        auto const leftDiff = difference(left);
+        auto const rightDiff = difference(right);
+
+        if (leftDiff >= bestDiff && rightDiff >= bestDiff)
+            break;
+
+        startB = leftDiff < rightDiff ? left : right;
+        bestDiff = std::min(leftDiff, rightDiff);
+    }
+
+    auto const inB = selected(routesB, orderB, startB);
+
+    DynamicBitset inKeptB(numVisits);  // visits of unselected routes of B
+    std::vector<size_t> keptB;
+    for (size_t count = numMoved; count != nB; ++count)
+    {
+        auto const idx = orderB[(startB + count) % nB];
+        markVisits(data, routesB[idx], inKeptB);
+        keptB.push_back(idx);
+    }
+
+    std::vector<size_t> movedA;
+    for (size_t count = 0; count != numMoved; ++count)
+        movedA.push_back(orderA[(startA + count) % nA]);
+
+    // Constructs a solution from the given routes, without the visits marked
+    // in the given bitsets. Routes that exceed the number of available
+    // vehicles, and visits to already visited client groups, are dropped.
+    using Candidate = std::pair<pyvrp::Route const *, DynamicBitset const *>;
+    auto const make = [&](std::vector<Candidate> const &candidates)
+    {
+        std::vector<size_t> numUsed(data.numVehicleTypes(), 0);
+        DynamicBitset groupVisited(data.numGroups());
+
+        std::vector<pyvrp::Route> routes;
+        for (auto const &[route, removed] : candidates)
+        {
+            auto const vehType = route->vehicleType();
+            if (numUsed[vehType] == data.vehicleType(vehType).numAvailable)
+                continue;
+
+            bool hasVisits = false;
+            std::vector<Activity> activities;
+            auto const &routeActivities = route->activities();
+            for (size_t idx = 1; idx + 1 < routeActivities.size(); ++idx)
+            {
+                auto const &activity = routeActivities[idx];
+                auto const idxVisit = visit(data, activity);
+                if (idxVisit && (*removed)[*idxVisit])
+                    continue;
+
+                if (activity.isClient())
+                    if (auto const group = data.client(activity.idx()).group)
+                    {
+                        if (groupVisited[*group])
+                            continue;
+
+                        groupVisited[*group] = true;
+                    }
+
+                // Reload depots that would start an empty trip are skipped.
+                if (activity.isDepot()
+                    && (activities.empty() || activities.back().isDepot()))
+                    continue;
+
+                hasVisits |= idxVisit.has_value();
+                activities.push_back(activity);
+            }
+
+            if (!hasVisits)
+                continue;
+
+            if (activities.back().isDepot())  // then the last trip is empty
+                activities.pop_back();
+
+            routes.emplace_back(data, activities, vehType);
+            numUsed[vehType]++;
+        }
+
+        return pyvrp::Solution(data, std::move(routes));
+    };
+
+    DynamicBitset const none(numVisits);
+
+    // The first offspring keeps the routes selected from the first parent
+    // intact, and removes their visits from the remaining routes of the
+    // second parent. The second offspring does the opposite.
+    std::vector<Candidate> candidates1;
+    std::vector<Candidate> candidates2;
+    for (auto const idx : movedA)
+    {
+        candidates1.emplace_back(&routesA[idx], &none);
+        candidates2.emplace_back(&routesA[idx], &inKeptB);
+    }
+
+    for (auto const idx : keptB)
+    {
+        candidates1.emplace_back(&routesB[idx], &inA);
+        candidates2.emplace_back(&routesB[idx], &none);
+    }
+
+    auto const offspring1 = make(candidates1);
+    auto const offspring2 = make(candidates2);
+
+    auto const cost1 = costEvaluator.penalisedCost(offspring1);
+    auto const cost2 = costEvaluator.penalisedCost(offspring2);
+    return cost1 <= cost2 ? offspring1 : offspring2;
+}
@@ -0,0 +1,239 @@
+#ifndef PYVRP_SEARCH_GENETICALGORITHM_H
+#define PYVRP_SEARCH_GENETICALGORITHM_H
+
+#include "../Solution.h"  // pyvrp::Solution
+#include "CostEvaluator.h"
+#include "LocalSearch.h"
+#include "ProblemData.h"
+#include "RandomNumberGenerator.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace pyvrp::search
+{
+/**
+ * GeneticAlgorithmParams(
+ *     min_pop_size: int = 25,
+ *     generation_size: int = 40,
+ *     num_elite: int = 4,
+ *     num_close: int = 5,
+ *     num_threads: int = 1,
+ * )
+ *
+ * Parameters for the genetic algorithm.
+ *
+ * Parameters
+ * ----------
+ * min_pop_size
+ *     Minimum number of solutions in each subpopulation. Must be positive.
+ * generation_size
+ *     Number of solutions that may be added to a subpopulation before it is
+ *     reduced back to ``min_pop_size`` by survivor selection.
+ * num_elite
+ *     Number of elite solutions. Elite solutions are protected from removal
+ *     during survivor selection, since the diversity component of their biased
+ *     fitness is downweighted. Must not exceed ``min_pop_size``.
+ * num_close
+ *     Number of closest solutions used to determine a solution's diversity
+ *     contribution. Must be positive.
+ * num_threads
+ *     Number of offspring generated in each generation. Each offspring is
+ *     educated by its own local search, on its own thread. Must be positive.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When any of the parameters are outside their allowed ranges.
+ */
+struct GeneticAlgorithmParams
+{
+    size_t const minPopSize;
+    size_t const generationSize;
+    size_t const numElite;
+    size_t const numClose;
+    size_t const numThreads;
+
+    GeneticAlgorithmParams(size_t minPopSize = 25,
+                           size_t generationSize = 40,
+                           size_t numElite = 4,
+                           size_t numClose = 5,
+                           size_t numThreads = 1);
+
+    bool operator==(GeneticAlgorithmParams const &other) const = default;
+};
+
+/**
+ * GeneticAlgorithm(
+ *     data: ProblemData,
+ *     searches: list[LocalSearch],
+ *     params: GeneticAlgorithmParams = GeneticAlgorithmParams(),
+ * )
+ *
+ * Population-based hybrid genetic search engine. The population is split
+ * into a feasible and an infeasible subpopulation. Each generation, parents
+ * are selected by binary tournaments on biased fitness, and recombined using
+ * the selective route exchange (SREX) crossover of [1]_. The offspring are
+ * educated by the given local searches in parallel, one offspring for each
+ * local search, and then added to the population.
+ *
+ * Each solution's biased fitness combines its rank in terms of cost with its
+ * rank in terms of diversity contribution, following [2]_. The diversity
+ * contribution is the average broken pairs distance to the ``num_close``
+ * closest other solutions in the same subpopulation. These distances are
+ * computed once, when a solution is added, and maintained incrementally as
+ * solutions are added and removed.
+ *
+ * Parameters
+ * ----------
+ * data
+ *     Data instance.
+ * searches
+ *     Local searches used to educate offspring. There must be exactly
+ *     ``num_threads`` of these, and each must be independent of the others.
+ * params
+ *     Genetic algorithm parameters.
+ *
+ * References
+ * ----------
+ * .. [1] Nagata, Y., and O. Bräysy (2009). A powerful route minimization
+ *        heuristic for the vehicle routing problem with time windows.
+ *        *Operations Research Letters*, 37(5): 333 - 336.
+ * .. [2] Vidal, T., T.G. Crainic, M. Gendreau, N. Lahrichi, and W. Rei
+ *        (2012). A hybrid genetic algorithm for multidepot and periodic
+ *        vehicle routing problems. *Operations Research*, 60(3): 611 - 624.
+ */
+class GeneticAlgorithm
+{
+    // A solution in the population. Each item stores its solution's
+    // predecessor and successor activities, which make computing the broken
+    // pairs distance to other solutions cheap, and a list of (distance, item)
+    // pairs to the other items in its subpopulation, sorted by distance.
+    struct Item
+    {
+        pyvrp::Solution solution;
+        std::vector<std::pair<size_t, size_t>> neighbours;
+        std::vector<std::pair<double, Item const *>> proximity;
+        double fitness = 0;
+
+        // Average distance to the given number of closest other items.
+        double avgDistanceClosest(size_t numClose) const;
+    };
+
+    using SubPopulation = std::vector<std::unique_ptr<Item>>;
+
+    ProblemData const &data_;
+    std::vector<LocalSearch *> searches_;
+    GeneticAlgorithmParams const params_;
+
+    SubPopulation feasible_;
+    SubPopulation infeasible_;
+
+    // Updates the biased fitness of each item in the given subpopulation.
+    void updateFitness(SubPopulation &subPop,
+                       CostEvaluator const &costEvaluator) const;
+
+    // Removes the given item from the subpopulation.
+    void remove(SubPopulation &subPop, size_t idx) const;
+
+    // Removes items from the given subpopulation until it contains exactly
+    // min_pop_size items, preferring duplicates and solutions with poor
+    // biased fitness.
+    void survivorSelection(SubPopulation &subPop,
+                           CostEvaluator const &costEvaluator) const;
+
+    // Selects a solution by binary tournament on biased fitness.
+    pyvrp::Solution const &select(RandomNumberGenerator &rng) const;
+
+public:
+    GeneticAlgorithm(ProblemData const &data,
+                     std::vector<LocalSearch *> searches,
+                     GeneticAlgorithmParams params = GeneticAlgorithmParams());
+
+    /**
+     * Adds the given solution to the population. If this makes the relevant
+     * subpopulation exceed ``min_pop_size + generation_size`` solutions,
+     * survivor selection reduces its size back to ``min_pop_size``.
+     *
+     * Parameters
+     * ----------
+     * solution
+     *     Solution to add.
+     * cost_evaluator
+     *     Cost evaluator used to compute biased fitness during survivor
+     *     selection.
+     */
+    void add(pyvrp::Solution const &solution,
+             CostEvaluator const &costEvaluator);
+
+    /**
+     * Performs one generation. Generates ``num_threads`` offspring by
+     * crossover of parents selected from the population, educates the
+     * offspring in parallel, and adds them to the population.
+     *
+     * Parameters
+     * ----------
+     * cost_evaluator
+     *     Cost evaluator to use for crossover, education, and survivor
+     *     selection.
+     * rng
+     *     Random number generator.
+     *
+     * Returns
+     * -------
+     * list[Solution]
+     *     The educated offspring.
+     *
+     * Raises
+     * ------
+     * RuntimeError
+     *     When the population is empty.
+     */
+    std::vector<pyvrp::Solution> step(CostEvaluator const &costEvaluator,
+                                      RandomNumberGenerator &rng);
+
+    /**
+     * Returns the number of feasible solutions in the population.
+     */
+    size_t numFeasible() const;
+
+    /**
+     * Returns the number of infeasible solutions in the population.
+     */
+    size_t numInfeasible() const;
+};
+
+/**
+ * Computes the broken pairs distance between the two given solutions. This
+ * is the fraction of client and shipment activities whose predecessor or
+ * successor differs between the two solutions. All depots are treated as the
+ * same.
+ *
+ * The returned value is in [0, 1]. Equal solutions have distance zero.
+ */
+double brokenPairsDistance(ProblemData const &data,
+                           pyvrp::Solution const &first,
+                           pyvrp::Solution const &second);
+
+/**
+ * Performs a selective route exchange crossover of the given parents. A
+ * number of consecutive routes, ordered by the polar angle of their centroid
+ * around the depots, are taken from the first parent, and replace a similar
+ * number of routes in the second parent. Activities visited by the routes
+ * taken from the first parent are removed from the remaining routes of the
+ * second parent. Activities visited only by the replaced routes of the
+ * second parent end up unplanned.
+ *
+ * Two such offspring are constructed: one that keeps the routes of the first
+ * parent intact, and one that keeps the remaining routes of the second parent
+ * intact. The offspring with the lowest penalised cost is returned.
+ */
+pyvrp::Solution srex(pyvrp::Solution const &first,
+                     pyvrp::Solution const &second,
+                     ProblemData const &data,
+                     CostEvaluator const &costEvaluator,
+                     RandomNumberGenerator &rng);
+}  // namespace pyvrp::search
+
+#endif  // PYVRP_SEARCH_GENETICALGORITHM_H
@@ -0,0 +1,116 @@
+#ifndef PYVRP_SEARCH_INCREMENTALSEGMENTBETWEEN_H
+#define PYVRP_SEARCH_INCREMENTALSEGMENTBETWEEN_H
+
+#include "DurationSegment.h"
+#include "LoadSegment.h"
+#include "ProblemData.h"
+#include "Route.h"
+
+#include <array>
+#include <cassert>
+#include <variant>
+#include <vector>
+
+namespace pyvrp::search
+{
+/**
+ * Segment that tracks a route segment between ``[start, end]``, but does so
+ * incrementally: it starts from a single node and can be grown to cover more
+ * of the route via its prefix operators. Growing the segment by one node takes
+ * constant time, whereas a regular :class:`Route::SegmentBetween` recomputes
+ * its duration and load data from scratch each time they are requested. This
+ * makes forward scans over delivery positions linear in the route length.
+ */
+class IncrementalSegmentBetween : public Route::SegmentBetween
+{
+    // Load segments are stored inline for up to this many load dimensions, so
+    // that constructing a segment does not allocate. Instances with more load
+    // dimensions fall back to heap storage.
+    static constexpr size_t INLINE_DIMENSIONS = 4;
+
+    ProblemData const &data_;
+    DurationSegment duration_;
+    size_t const numDims_;
+    std::array<LoadSegment, INLINE_DIMENSIONS> inlineLoads_;
+    std::vector<LoadSegment> heapLoads_;
+
+    inline LoadSegment *loads();
+
+public:
+    inline IncrementalSegmentBetween(ProblemData const &data,
+                                     Route::Node const *node);
+
+    inline IncrementalSegmentBetween &operator++();
+
+    inline DurationSegment const &duration(size_t profile) const;
+    inline LoadSegment const &load(size_t dimension) const;
+};
+
+IncrementalSegmentBetween::IncrementalSegmentBetween(ProblemData const &data,
+                                                     Route::Node const *node)
+    : SegmentBetween(*node->route(), node->pos(), node->pos()),
+      data_(data),
+      numDims_(data.numLoadDimensions())
+{
+    assert(node->route());
+    duration_ = SegmentBetween::duration(route_.profile());
+
+    if (numDims_ > INLINE_DIMENSIONS)
+        heapLoads_.resize(numDims_);
+
+    auto *loads = this->loads();
+    for (size_t dim = 0; dim != numDims_; ++dim)
+        loads[dim] = SegmentBetween::load(dim);
+}
+
+LoadSegment *IncrementalSegmentBetween::loads()
+{
+    return numDims_ > INLINE_DIMENSIONS ? heapLoads_.data()
+                                        : inlineLoads_.data();
+}
+
+IncrementalSegmentBetween &IncrementalSegmentBetween::operator++()
+{
+    assert(end != route_.size() - 1);
+    auto const from = back().location();  // current last location
+    end++;
+
+    // The segment must consist of a single trip only, possibly including the
+    // depot that begins the next trip (and ends this one). So the difference
+    // in trips is at most one.
+    assert(route_[end]->trip() - route_[start]->trip()
+           <= route_[end]->isDepot());
+
+    auto const at = route_.at(end);
+
+    auto *loads = this->loads();
+    for (size_t dim = 0; dim != numDims_; ++dim)
+        loads[dim] = LoadSegment::merge(loads[dim], at.load(dim));
+
+    auto const to = at.front().location();
+    auto const edge = [&](auto const &mat) { return mat(from, to); };
+    auto const edgeDur
+        = std::visit(edge, data_.durationMatrix(route_.profile()));
+
+    duration_ = DurationSegment::merge(
+        edgeDur, duration_, at.duration(route_.profile()));
+
+    return *this;
+}
+
+DurationSegment const &
+IncrementalSegmentBetween::duration([[maybe_unused]] size_t profile) const
+{
+    assert(profile == route_.profile());
+    return duration_;
+}
+
+LoadSegment const &IncrementalSegmentBetween::load(size_t dimension) const
+{
+    assert(dimension < numDims_);
+    return numDims_ > INLINE_DIMENSIONS ? heapLoads_[dimension]
+                                        : inlineLoads_[dimension];
+}
+}  // namespace pyvrp::search
+
+#endif  // PYVRP_SEARCH_INCREMENTALSEGMENTBETWEEN_H
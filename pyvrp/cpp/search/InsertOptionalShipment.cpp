@@ -1,10 +1,12 @@
 #include "InsertOptionalShipment.h"
 
 #include "DeliverySegment.h"
+#include "IncrementalSegmentBetween.h"
 #include "PickupSegment.h"
 
 #include <cassert>
 
+using pyvrp::search::IncrementalSegmentBetween;
 using pyvrp::search::InsertOptionalShipment;
 
 std::pair<pyvrp::Cost, bool> InsertOptionalShipment::evaluate(
@@ -34,15 +36,17 @@ std::pair<pyvrp::Cost, bool> InsertOptionalShipment::evaluate(
         return std::make_pair(deltaCost, true);
     }
 
-    // Pickup after V, delivery later in the route.
-    for (auto const *node = n(V); !node->isDepot(); node = n(node))
+    // Pickup after V, delivery later in the route. The segment between the
+    // pickup and delivery is grown incrementally, in constant time per node.
+    IncrementalSegmentBetween between = {data, n(V)};
+    for (auto const *node = n(V); !node->isDepot(); node = n(node), ++between)
     {
         Cost deltaCost = -shipment.prize;
         costEvaluator.deltaCost(
             deltaCost,
             Route::Proposal(route.before(V->pos()),
                             PickupSegment(data, U->idx()),
-                            route.between(V->pos() + 1, node->pos()),
+                            between,
                             DeliverySegment(data, U->idx()),
                             route.after(node->pos() + 1)));
 
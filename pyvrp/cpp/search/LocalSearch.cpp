@@ -5,15 +5,156 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <iterator>
 #include <numeric>
+#include <stdexcept>
 
 using pyvrp::Solution;
 using pyvrp::search::BinaryOperator;
 using pyvrp::search::LocalSearch;
+using pyvrp::search::OperatorSelectionParams;
+using pyvrp::search::OperatorStatistics;
 using pyvrp::search::SearchSpace;
 using pyvrp::search::UnaryOperator;
 
+namespace
+{
+#ifdef PYVRP_OPERATOR_TIMING
+// Adds the time elapsed between construction and destruction to the given
+// total, in seconds.
+class Timer
+{
+    using Clock = std::chrono::steady_clock;
+
+    double &total_;
+    Clock::time_point const start_ = Clock::now();
+
+public:
+    explicit Timer(double &total) : total_(total) {}
+
+    ~Timer()
+    {
+        std::chrono::duration<double> const elapsed = Clock::now() - start_;
+        total_ += elapsed.count();
+    }
+};
+#else
+// No-op timer used when operator instrumentation is disabled.
+class Timer
+{
+public:
+    explicit Timer([[maybe_unused]] double &total) {}
+};
+#endif
+
+// Calls fn, and adds the time this took to the given total.
+template <typename Fn> decltype(auto) timed(double &total, Fn &&fn)
+{
+    [[maybe_unused]] Timer const timer(total);
+    return fn();
+}
+
+// Selects the operators to use in the next search, and determines their
+// evaluation order. Each operator is used with probability proportional to its
+// score relative to the best score, but at least with the given minimum
+// probability. The selected operators are then ordered using roulette-wheel
+// selection with those same probabilities as weights.
+template <typename Op>
+void selectOperators(std::vector<Op *> const &ops,
+                     std::vector<double> const &scores,
+                     std::vector<Op *> &order,
+                     double minProbability,
+                     pyvrp::RandomNumberGenerator &rng)
+{
+    assert(ops.size() == scores.size());
+
+    auto const maxScore = scores.empty()
+                              ? 0.0
+                              : *std::max_element(scores.begin(), scores.end());
+
+    std::vector<std::pair<Op *, double>> candidates;
+    for (size_t idx = 0; idx != ops.size(); ++idx)
+    {
+        auto const prob = maxScore > 0
+                              ? std::max(scores[idx] / maxScore, minProbability)
+                              : 1.0;
+
+        if (rng.rand() <= prob)  // the best operator is always selected
+            candidates.emplace_back(ops[idx], prob);
+    }
+
+    order.clear();
+    while (!candidates.empty())
+    {
+        double total = 0;
+        for (auto const &[op, weight] : candidates)
+            total += weight;
+
+        auto const target = rng.rand() * total;
+        auto it = candidates.begin();
+        for (auto cumWeight = it->second;
+             cumWeight < target && std::next(it) != candidates.end();)
+            cumWeight += (++it)->second;
+
+        order.push_back(it->first);
+        candidates.erase(it);
+    }
+}
+
+// Updates the given scores with the outcome of the most recent search. An
+// operator's outcome is the number of improving moves it found, per unit of
+// evaluation effort. The effort is the time spent evaluating moves when that
+// is tracked, and the number of evaluated moves otherwise. Outcomes are
+// normalised by the best outcome, and then blended into the existing scores.
+template <typename Op>
+void updateOperatorScores(std::vector<Op *> const &ops,
+                          std::vector<double> &scores,
+                          double decay)
+{
+    assert(ops.size() == scores.size());
+
+    std::vector<double> outcomes(ops.size(), -1.0);  // < 0 if not evaluated
+    double maxOutcome = 0;
+
+    for (size_t idx = 0; idx != ops.size(); ++idx)
+    {
+        auto const &stats = ops[idx]->statistics();
+        if (stats.numEvaluations == 0)  // operator was not used, so there is
+            continue;                   // nothing to learn about it.
+
+        auto const effort = stats.evaluateTime > 0
+                                ? stats.evaluateTime
+                                : static_cast<double>(stats.numEvaluations);
+
+        outcomes[idx] = stats.numApplications / effort;
+        maxOutcome = std::max(maxOutcome, outcomes[idx]);
+    }
+
+    if (maxOutcome == 0)  // no operator found any improving moves, so these
+        return;           // outcomes are not informative.
+
+    for (size_t idx = 0; idx != ops.size(); ++idx)
+        if (outcomes[idx] >= 0)
+        {
+            auto const outcome = outcomes[idx] / maxOutcome;
+            scores[idx] = decay * scores[idx] + (1 - decay) * outcome;
+        }
+}
+}  // namespace
+
+OperatorSelectionParams::OperatorSelectionParams(bool adaptive,
+                                                 double decay,
+                                                 double minProbability)
+    : adaptive(adaptive), decay(decay), minProbability(minProbability)
+{
+    if (decay < 0 || decay >= 1)
+        throw std::invalid_argument("decay must be in [0, 1).");
+
+    if (minProbability <= 0 || minProbability > 1)
+        throw std::invalid_argument("min_probability must be in (0, 1].");
+}
+
 pyvrp::Solution LocalSearch::operator()(pyvrp::Solution const &solution,
                                         CostEvaluator const &costEvaluator,
                                         bool exhaustive)
@@ -21,17 +162,7 @@ pyvrp::Solution LocalSearch::operator()(pyvrp::Solution const &solution,
     PYVRP_DEBUG(
         "pyvrp.search", "Applying local search (exhaustive={}).", exhaustive);
 
-    std::fill(lastTest_.begin(), lastTest_.end(), -1);
-    std::fill(lastUpdate_.begin(), lastUpdate_.end(), 0);
-    numUpdates_ = 0;
-
-    solution_.load(solution);
-
-    for (auto *op : unaryOps_)
-        op->init(solution_);
-
-    for (auto *op : binaryOps_)
-        op->init(solution_);
+    load(solution);
 
     if (exhaustive)
         searchSpace_.markAllPromising();
@@ -41,6 +172,9 @@ pyvrp::Solution LocalSearch::operator()(pyvrp::Solution const &solution,
     ensureStructuralFeasibility(costEvaluator);
     search(costEvaluator);
 
+    if (params_.adaptive)
+        updateScores();
+
     [[maybe_unused]] auto const stats = statistics();
     PYVRP_DEBUG("pyvrp.search",
                 "Completed local search: improving={}, updates={}, moves={}.",
@@ -51,6 +185,64 @@ pyvrp::Solution LocalSearch::operator()(pyvrp::Solution const &solution,
     return solution_.unload();
 }
 
+pyvrp::Solution LocalSearch::operator()(pyvrp::Solution const &solution,
+                                        CostEvaluator const &costEvaluator,
+                                        std::vector<Activity> const &activities)
+{
+    PYVRP_DEBUG("pyvrp.search",
+                "Applying local search around {} activities.",
+                activities.size());
+
+    for (auto const &activity : activities)
+    {
+        if (activity.isDepot())
+            throw std::invalid_argument("Cannot search around depots.");
+
+        auto const num = activity.isClient() ? data.numClients()
+                                             : data.numShipments();
+        if (activity.idx() >= num)
+            throw std::out_of_range("Activity does not exist.");
+    }
+
+    load(solution);
+    searchSpace_.unmarkAllPromising();
+
+    // Only the given activities are promising. For activities that are in the
+    // solution, we also mark the activities around them, since their context
+    // has changed as well.
+    for (auto const &activity : activities)
+    {
+        auto const *node = solution_[activity];
+        if (node->route())
+            searchSpace_.markPromising(node);
+        else
+            searchSpace_.markPromising(activity);
+    }
+
+    ensureStructuralFeasibility(costEvaluator);
+    search(costEvaluator);
+
+    if (params_.adaptive)
+        updateScores();
+
+    return solution_.unload();
+}
+
+void LocalSearch::load(pyvrp::Solution const &solution)
+{
+    std::fill(lastTest_.begin(), lastTest_.end(), -1);
+    std::fill(lastUpdate_.begin(), lastUpdate_.end(), 0);
+    numUpdates_ = 0;
+
+    solution_.load(solution);
+
+    for (auto *op : unaryOps_)
+        op->init(solution_);
+
+    for (auto *op : binaryOps_)
+        op->init(solution_);
+}
+
 void LocalSearch::search(CostEvaluator const &costEvaluator)
 {
     if (unaryOps_.empty() && binaryOps_.empty())
@@ -78,29 +270,22 @@ void LocalSearch::search(CostEvaluator const &costEvaluator)
 
             applyUnaryOps(U, costEvaluator);
 
-            for (auto const &vActivity : searchSpace_.neighboursOf(uActivity))
-            {
-                auto *V = solution_[vActivity];
-                assert(V);
-
-                if (!V->route())
-                    continue;
-
-                auto *routes = solution_.routes.data();
-                auto uUpdate = 0;
-                if (U->route())
-                    uUpdate = lastUpdate_[std::distance(routes, U->route())];
-                auto vUpdate = lastUpdate_[std::distance(routes, V->route())];
-                if (uUpdate > lastTest || vUpdate > lastTest)
-                {
-                    if (applyBinaryOps(U, V, costEvaluator))
-                        continue;
-
-                    if (p(V)->isStartDepot()
-                        && applyBinaryOps(U, p(V), costEvaluator))
-                        continue;
-                }
-            }
+            if (searchSpace_.hasProfileNeighbours())
+                // Then each profile has its own neighbourhood, and we only
+                // consider neighbours V that are on routes of that profile.
+                for (size_t profile = 0; profile != data.numProfiles();
+                     ++profile)
+                    applyNeighbourMoves(U,
+                                        searchSpace_.neighboursOf(uActivity,
+                                                                  profile),
+                                        lastTest,
+                                        costEvaluator,
+                                        profile);
+            else
+                applyNeighbourMoves(U,
+                                    searchSpace_.neighboursOf(uActivity),
+                                    lastTest,
+                                    costEvaluator);
 
             applyEmptyRouteMoves(U, costEvaluator);
         }
@@ -112,16 +297,50 @@ void LocalSearch::shuffle(RandomNumberGenerator &rng)
     perturbationManager_.shuffle(rng);
     searchSpace_.shuffle(rng);
 
+    if (params_.adaptive)
+    {
+        auto const minProb = params_.minProbability;
+        selectOperators(unaryOps_, unaryScores_, unaryOrder_, minProb, rng);
+        selectOperators(binaryOps_, binaryScores_, binaryOrder_, minProb, rng);
+        return;
+    }
+
     rng.shuffle(unaryOps_.begin(), unaryOps_.end());
     rng.shuffle(binaryOps_.begin(), binaryOps_.end());
+
+    unaryOrder_ = unaryOps_;
+    binaryOrder_ = binaryOps_;
+}
+
+void LocalSearch::updateScores()
+{
+    updateOperatorScores(unaryOps_, unaryScores_, params_.decay);
+    updateOperatorScores(binaryOps_, binaryScores_, params_.decay);
 }
 
 bool LocalSearch::applyUnaryOps(Route::Node *U,
                                 CostEvaluator const &costEvaluator)
 {
-    for (auto *op : unaryOps_)
+    for (auto *op : unaryOrder_)
     {
-        auto const [deltaCost, shouldApply] = op->evaluate(U, costEvaluator);
+        auto &stats = op->stats_;
+        if (op->hasLowerBound())
+        {
+            auto const bound
+                = timed(stats.evaluateTime,
+                        [&] { return op->lowerBound(U, costEvaluator); });
+            if (bound && *bound >= 0)  // then the move cannot be improving
+            {
+                stats.numSkips++;
+                continue;
+            }
+        }
+
+        auto const numShortcuts = costEvaluator.numShortcuts();
+        auto const [deltaCost, shouldApply] = timed(
+            stats.evaluateTime, [&] { return op->evaluate(U, costEvaluator); });
+        stats.numShortcuts += costEvaluator.numShortcuts() - numShortcuts;
+
         if (shouldApply)
         {
             PYVRP_DEBUG("pyvrp.search",
@@ -134,18 +353,43 @@ bool LocalSearch::applyUnaryOps(Route::Node *U,
             if (rU)
                 searchSpace_.markPromising(U);
 
+            // Some operators move the other nodes in U's route to different
+            // routes. We track those nodes, so we can update their new routes.
+            std::vector<Route::Node *> nodes;
+            if (rU)
+                for (auto *node : *rU)
+                    if (!node->isDepot())
+                        nodes.push_back(node);
+
 #ifndef NDEBUG
             auto const costBefore = costEvaluator.penalisedCost(solution_);
 #endif
 
-            op->apply(U);
+            timed(stats.applyTime, [&] { op->apply(U); });
             if (!rU)  // then U wasn't in the solution before, and the operator
             {         // just inserted it.
                 rU = U->route();
                 searchSpace_.markPromising(U);
             }
 
-            update(rU, rU);
+            timed(stats.updateTime, [&] { update(rU, rU); });
+
+            std::vector<Route *> updated = {rU};
+            for (auto *node : nodes)
+            {
+                auto *route = node->route();
+                if (!route || route == rU)
+                    continue;
+
+                searchSpace_.markPromising(node);
+                if (std::ranges::find(updated, route) == updated.end())
+                {
+                    timed(stats.updateTime, [&] { update(route, route); });
+                    updated.push_back(route);
+                }
+            }
+
+            stats.improvingDelta += deltaCost;
 
 #ifndef NDEBUG
             auto const costAfter = costEvaluator.penalisedCost(solution_);
@@ -166,9 +410,27 @@ bool LocalSearch::applyBinaryOps(Route::Node *U,
                                  Route::Node *V,
                                  CostEvaluator const &costEvaluator)
 {
-    for (auto *op : binaryOps_)
+    for (auto *op : binaryOrder_)
     {
-        auto const [deltaCost, shouldApply] = op->evaluate(U, V, costEvaluator);
+        auto &stats = op->stats_;
+        if (op->hasLowerBound())
+        {
+            auto const bound
+                = timed(stats.evaluateTime,
+                        [&] { return op->lowerBound(U, V, costEvaluator); });
+            if (bound && *bound >= 0)  // then the move cannot be improving
+            {
+                stats.numSkips++;
+                continue;
+            }
+        }
+
+        auto const numShortcuts = costEvaluator.numShortcuts();
+        auto const [deltaCost, shouldApply]
+            = timed(stats.evaluateTime,
+                    [&] { return op->evaluate(U, V, costEvaluator); });
+        stats.numShortcuts += costEvaluator.numShortcuts() - numShortcuts;
+
         if (shouldApply)
         {
             PYVRP_DEBUG("pyvrp.search",
@@ -190,8 +452,9 @@ bool LocalSearch::applyBinaryOps(Route::Node *U,
             auto const costBefore = costEvaluator.penalisedCost(solution_);
 #endif
 
-            op->apply(U, V);
-            update(rU, rV);
+            timed(stats.applyTime, [&] { op->apply(U, V); });
+            timed(stats.updateTime, [&] { update(rU, rV); });
+            stats.improvingDelta += deltaCost;
 
 #ifndef NDEBUG
             auto const costAfter = costEvaluator.penalisedCost(solution_);
@@ -208,6 +471,39 @@ bool LocalSearch::applyBinaryOps(Route::Node *U,
     return false;
 }
 
+void LocalSearch::applyNeighbourMoves(Route::Node *U,
+                                      std::vector<Activity> const &neighbours,
+                                      int lastTest,
+                                      CostEvaluator const &costEvaluator,
+                                      std::optional<size_t> profile)
+{
+    for (auto const &vActivity : neighbours)
+    {
+        auto *V = solution_[vActivity];
+        assert(V);
+
+        if (!V->route())
+            continue;
+
+        if (profile && V->route()->profile() != *profile)
+            continue;
+
+        auto *routes = solution_.routes.data();
+        auto uUpdate = 0;
+        if (U->route())
+            uUpdate = lastUpdate_[std::distance(routes, U->route())];
+        auto vUpdate = lastUpdate_[std::distance(routes, V->route())];
+        if (uUpdate > lastTest || vUpdate > lastTest)
+        {
+            if (applyBinaryOps(U, V, costEvaluator))
+                continue;
+
+            if (p(V)->isStartDepot() && applyBinaryOps(U, p(V), costEvaluator))
+                continue;
+        }
+    }
+}
+
 void LocalSearch::applyEmptyRouteMoves(Route::Node *U,
                                        CostEvaluator const &costEvaluator)
 {
@@ -364,12 +660,18 @@ void LocalSearch::update(Route *U, Route *V)
 
 void LocalSearch::addOperator(UnaryOperator &op)
 {
+    op.searchSpace_ = &searchSpace_;
     unaryOps_.emplace_back(&op);
+    unaryScores_.emplace_back(1.0);  // optimistic initial score
+    unaryOrder_.emplace_back(&op);
 }
 
 void LocalSearch::addOperator(BinaryOperator &op)
 {
+    op.searchSpace_ = &searchSpace_;
     binaryOps_.emplace_back(&op);
+    binaryScores_.emplace_back(1.0);  // optimistic initial score
+    binaryOrder_.emplace_back(&op);
 }
 
 std::vector<UnaryOperator *> const &LocalSearch::unaryOperators() const
@@ -392,32 +694,49 @@ SearchSpace::Neighbours const &LocalSearch::neighbours() const
     return searchSpace_.neighbours();
 }
 
+void LocalSearch::setProfileNeighbours(
+    std::vector<SearchSpace::Neighbours> neighbours)
+{
+    searchSpace_.setProfileNeighbours(neighbours);
+}
+
+std::vector<SearchSpace::Neighbours> const &
+LocalSearch::profileNeighbours() const
+{
+    return searchSpace_.profileNeighbours();
+}
+
 LocalSearch::Statistics LocalSearch::statistics() const
 {
     size_t numMoves = 0;
     size_t numImproving = 0;
+    std::vector<std::pair<std::string, OperatorStatistics>> operators;
+    operators.reserve(unaryOps_.size() + binaryOps_.size());
 
     auto const count = [&](auto const *op)
     {
         auto const &stats = op->statistics();
         numMoves += stats.numEvaluations;
         numImproving += stats.numApplications;
+        operators.emplace_back(op->name(), stats);
     };
 
     std::for_each(unaryOps_.begin(), unaryOps_.end(), count);
     std::for_each(binaryOps_.begin(), binaryOps_.end(), count);
 
     assert(numImproving <= numUpdates_);
-    return {numMoves, numImproving, numUpdates_};
+    return {numMoves, numImproving, numUpdates_, std::move(operators)};
 }
 
 LocalSearch::LocalSearch(ProblemData const &data,
                          SearchSpace::Neighbours neighbours,
-                         PerturbationManager &perturbationManager)
+                         PerturbationManager &perturbationManager,
+                         OperatorSelectionParams params)
     : data(data),
       solution_(data),
       searchSpace_(data, neighbours),
       perturbationManager_(perturbationManager),
+      params_(params),
       lastTest_(data.numClients() + data.numShipments()),
       lastUpdate_(data.numVehicles())
 {
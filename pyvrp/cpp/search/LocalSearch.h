@@ -11,11 +11,60 @@
 #include "Solution.h"  // pyvrp::search::Solution
 
 #include <functional>
+#include <optional>
 #include <stdexcept>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace pyvrp::search
 {
+/**
+ * OperatorSelectionParams(
+ *     adaptive: bool = False,
+ *     decay: float = 0.8,
+ *     min_probability: float = 0.1,
+ * )
+ *
+ * Operator selection parameters. By default, the local search evaluates all
+ * operators in a uniformly random order. When adaptive selection is enabled,
+ * each operator instead maintains a score that tracks how many improving moves
+ * it recently found, relative to the effort spent evaluating moves. Before
+ * each search, operators are ordered by roulette-wheel selection on these
+ * scores, and operators with low scores are skipped with a probability that
+ * is proportional to how much worse they performed than the best operator.
+ *
+ * Parameters
+ * ----------
+ * adaptive
+ *     Whether to adaptively reorder and throttle operators. Default ``False``,
+ *     which evaluates all operators in a uniformly random order.
+ * decay
+ *     Weight given to an operator's previous score when updating it with the
+ *     outcome of the most recent search. Must be in :math:`[0, 1)`.
+ * min_probability
+ *     Minimum probability with which each operator is used in a search. This
+ *     ensures low-scoring operators are still used occasionally, so their
+ *     scores can recover. Must be in :math:`(0, 1]`.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When ``decay`` or ``min_probability`` are outside their allowed ranges.
+ */
+struct OperatorSelectionParams
+{
+    bool const adaptive;
+    double const decay;
+    double const minProbability;
+
+    OperatorSelectionParams(bool adaptive = false,
+                            double decay = 0.8,
+                            double minProbability = 0.1);
+
+    bool operator==(OperatorSelectionParams const &other) const = default;
+};
+
 class LocalSearch
 {
     ProblemData const &data;
@@ -31,9 +80,21 @@ class LocalSearch
     // each LS invocation.
     PerturbationManager &perturbationManager_;
 
+    OperatorSelectionParams const params_;
+
     std::vector<UnaryOperator *> unaryOps_;
     std::vector<BinaryOperator *> binaryOps_;
 
+    // Operator scores, in the same order as the operators above. These are
+    // only used when adaptive operator selection is enabled.
+    std::vector<double> unaryScores_;
+    std::vector<double> binaryScores_;
+
+    // Operators to use in the current search, in evaluation order. These are
+    // (ordered subsets of) the operators above.
+    std::vector<UnaryOperator *> unaryOrder_;
+    std::vector<BinaryOperator *> binaryOrder_;
+
     std::vector<int> lastTest_;    // tracks last client and pickup evaluations
     std::vector<int> lastUpdate_;  // tracks when routes were last modified
 
@@ -48,6 +109,14 @@ class LocalSearch
                         Route::Node *V,
                         CostEvaluator const &costEvaluator);
 
+    // Tests the node pairs (U, V) for all V in the given neighbours. If a
+    // profile is given, only nodes V in routes of that profile are tested.
+    void applyNeighbourMoves(Route::Node *U,
+                             std::vector<Activity> const &neighbours,
+                             int lastTest,
+                             CostEvaluator const &costEvaluator,
+                             std::optional<size_t> profile = std::nullopt);
+
     // Tests moves involving empty routes.
     void applyEmptyRouteMoves(Route::Node *U,
                               CostEvaluator const &costEvaluator);
@@ -57,12 +126,19 @@ class LocalSearch
     // and remove group duplicates if needed.
     void ensureStructuralFeasibility(CostEvaluator const &costEvaluator);
 
+    // Loads the given solution, and resets the search state.
+    void load(pyvrp::Solution const &solution);
+
     // Updates solution state after an improving local search move.
     void update(Route *U, Route *V);
 
     // Performs search on the currently loaded solution.
     void search(CostEvaluator const &costEvaluator);
 
+    // Updates the operator scores using the statistics of the most recent
+    // search.
+    void updateScores();
+
 public:
     /**
      * Simple data structure that tracks statistics about the number of local
@@ -78,6 +154,9 @@ public:
      *     Total number of changes to the solution. This always includes the
      *     number of evaluated improving moves, but also e.g. insertion of
      *     required but missing clients and shipments.
+     * operators
+     *     List of (name, statistics) pairs, one for each unary and binary
+     *     operator in use.
      */
     struct Statistics
     {
@@ -89,6 +168,9 @@ public:
 
         // Number of times the solution has been modified in some way.
         size_t const numUpdates;
+
+        // Per-operator statistics, by operator name.
+        std::vector<std::pair<std::string, OperatorStatistics>> const operators;
     };
 
     /**
@@ -125,6 +207,19 @@ public:
      */
     SearchSpace::Neighbours const &neighbours() const;
 
+    /**
+     * Convenience method to set per-profile neighbourhoods. When set, each
+     * node U is only tested against neighbours V in routes of the profile
+     * whose neighbourhood contains V. Pass an empty list to disable.
+     */
+    void setProfileNeighbours(std::vector<SearchSpace::Neighbours> neighbours);
+
+    /**
+     * Returns the per-profile neighbourhoods currently used by the local
+     * search, if any.
+     */
+    std::vector<SearchSpace::Neighbours> const &profileNeighbours() const;
+
     /**
      * Returns search statistics for the currently loaded solution.
      */
@@ -138,15 +233,29 @@ public:
                                CostEvaluator const &costEvaluator,
                                bool exhaustive = false);
 
+    /**
+     * Performs a local search around the given client and shipment activities
+     * only, and returns a new, hopefully improved solution. This first inserts
+     * any missing required clients, shipments, and groups, and then searches
+     * the neighbourhoods of the given activities, and of the activities
+     * affected by improving moves. This is useful to quickly re-optimise a
+     * solution after a few clients or shipments were added or changed.
+     */
+    pyvrp::Solution operator()(pyvrp::Solution const &solution,
+                               CostEvaluator const &costEvaluator,
+                               std::vector<Activity> const &activities);
+
     /**
      * Shuffles the order in which the node and route pairs are evaluated, and
-     * the order in which operators are applied.
+     * the order in which operators are applied. When adaptive operator
+     * selection is enabled, this also determines which operators are used.
      */
     void shuffle(RandomNumberGenerator &rng);
 
     LocalSearch(ProblemData const &data,
                 SearchSpace::Neighbours neighbours,
-                PerturbationManager &perturbationManager);
+                PerturbationManager &perturbationManager,
+                OperatorSelectionParams params = OperatorSelectionParams());
 };
 }  // namespace pyvrp::search
 
@@ -5,8 +5,11 @@
 #include "Measure.h"
 #include "ProblemData.h"
 #include "Route.h"
+#include "SearchSpace.h"
 #include "Solution.h"  // pyvrp::search::Solution
 
+#include <algorithm>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -16,25 +19,71 @@ namespace pyvrp::search
  * Simple data structure that tracks statistics about the number of times
  * an operator was evaluated and applied.
  *
+ * The timing and shortcut fields are only populated when PyVRP is compiled
+ * with operator instrumentation enabled (the ``operator_timing`` build
+ * option). They are zero otherwise.
+ *
  * Attributes
  * ----------
  * num_evaluations
  *     Number of evaluated moves.
  * num_applications
  *     Number of applied, improving moves.
+ * num_shortcuts
+ *     Number of delta cost evaluations that returned early because the move
+ *     could not be improving.
+ * num_skips
+ *     Number of moves that were not evaluated at all, because a cheap lower
+ *     bound on their cost delta showed they could not be improving. Skipped
+ *     moves are not counted as evaluations.
+ * improving_delta
+ *     Sum of the cost deltas of all applied, improving moves.
+ * evaluate_time
+ *     Time spent evaluating moves, in seconds.
+ * apply_time
+ *     Time spent applying improving moves, in seconds.
+ * update_time
+ *     Time spent updating routes after applying improving moves, in seconds.
  */
 struct OperatorStatistics
 {
     size_t numEvaluations = 0;
     size_t numApplications = 0;
+    size_t numShortcuts = 0;
+    size_t numSkips = 0;
+    Cost improvingDelta = 0;
+    double evaluateTime = 0;
+    double applyTime = 0;
+    double updateTime = 0;
 };
 
+class LocalSearch;
+
 template <std::same_as<Route::Node *>... Args> class LocalSearchOperator
 {
+    friend class LocalSearch;  // records timing and delta statistics
+
 protected:
     ProblemData const &data;
     mutable OperatorStatistics stats_;
 
+    // Search space of the local search this operator was most recently added
+    // to. Operators may use it to access the granular neighbourhood. This is
+    // null if the operator has not been added to a local search.
+    SearchSpace const *searchSpace_ = nullptr;
+
+    // Whether this operator overrides lowerBound(). The local search only
+    // computes lower bounds for operators that do.
+    bool const hasLowerBound_;
+
+    // Returns a lower bound on the cost delta of changing the given (non-empty)
+    // route such that its distance becomes at least the given distance. Only
+    // the fixed vehicle cost and distance-related costs of the new route are
+    // counted; all other cost components are non-negative.
+    static Cost distanceBound(Route const &route,
+                              Distance distance,
+                              CostEvaluator const &costEvaluator);
+
 public:
     /**
      * Determines the cost delta of applying this move to the arguments. If the
@@ -52,6 +101,24 @@ public:
                                            CostEvaluator const &costEvaluator)
         = 0;
 
+    /**
+     * Returns a cheap lower bound on the cost delta of applying this move to
+     * the arguments, or no value if the operator cannot bound the move. The
+     * local search does not evaluate moves whose lower bound is non-negative,
+     * since such moves cannot be improving. Lower bounds should be much
+     * cheaper to compute than a full evaluation, for example by only
+     * considering the changed arcs' distances.
+     *
+     * Operators that override this method should pass ``hasLowerBound = true``
+     * to the constructor. Otherwise, the local search does not call it.
+     */
+    virtual std::optional<Cost>
+    lowerBound([[maybe_unused]] Args... args,
+               [[maybe_unused]] CostEvaluator const &costEvaluator) const
+    {
+        return std::nullopt;
+    }
+
     /**
      * Applies this move to the given arguments. Should only be called
      * when ``evaluate()`` suggests applying the move.
@@ -72,6 +139,11 @@ public:
      */
     virtual std::string name() const = 0;
 
+    /**
+     * Whether this operator provides lower bounds through ``lowerBound()``.
+     */
+    bool hasLowerBound() const { return hasLowerBound_; }
+
     /**
      * Returns evaluation and application statistics collected since the last
      * solution initialisation.
@@ -89,10 +161,27 @@ public:
      */
     virtual void update([[maybe_unused]] Route const *route) {};
 
-    LocalSearchOperator(ProblemData const &data) : data(data){};
+    LocalSearchOperator(ProblemData const &data, bool hasLowerBound = false)
+        : data(data), hasLowerBound_(hasLowerBound){};
     virtual ~LocalSearchOperator() = default;
 };
 
+template <std::same_as<Route::Node *>... Args>
+Cost LocalSearchOperator<Args...>::distanceBound(
+    Route const &route, Distance distance, CostEvaluator const &costEvaluator)
+{
+    auto const excess = std::max<Distance>(distance - route.maxDistance(), 0);
+
+    Cost bound = route.fixedVehicleCost();
+    if (route.hasDistanceCost())
+    {
+        bound += route.unitDistanceCost() * static_cast<Cost>(distance);
+        bound += costEvaluator.excessDistPenalty(excess);
+    }
+
+    return bound - costEvaluator.penalisedCost(route);
+}
+
 using UnaryOperator = LocalSearchOperator<Route::Node *>;
 using BinaryOperator = LocalSearchOperator<Route::Node *, Route::Node *>;
 }  // namespace pyvrp::search
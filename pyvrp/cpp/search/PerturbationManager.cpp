@@ -2,26 +2,143 @@
 
 #include "DynamicBitset.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <limits>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
+using pyvrp::Cost;
 using pyvrp::search::PerturbationManager;
 using pyvrp::search::PerturbationParams;
+using pyvrp::search::RecreateMethod;
 using pyvrp::search::Route;
+using pyvrp::search::RuinMethod;
+
+namespace
+{
+// Worst removal selects the client or shipment at position y^p among the
+// candidates sorted by decreasing cost savings, for uniform y in [0, 1]. The
+// larger p, the more likely the worst candidate is selected.
+constexpr double WORST_REMOVAL_DETERMINISM = 3.0;
+
+// Removes the given client or shipment, and marks it promising.
+void remove(Route::Node *node, pyvrp::search::SearchSpace &searchSpace)
+{
+    assert(node->isClient() || node->isPickup());
+    assert(node->route());
+
+    searchSpace.markPromising(node);
+
+    auto *route = node->route();
+    route->remove(node->pos());
+
+    if (node->isPickup())  // then we also remove the associated delivery
+    {
+        auto const *delivery = node + 1;
+        assert(delivery->route() == route);
+
+        searchSpace.markPromising(delivery);
+        route->remove(delivery->pos());
+    }
+
+    route->update();
+}
+
+// Updates the route of the given (just inserted) client or shipment, and marks
+// it promising.
+void inserted(Route::Node *node, pyvrp::search::SearchSpace &searchSpace)
+{
+    assert(node->isClient() || node->isPickup());
+
+    auto *route = node->route();
+    assert(route);
+
+    route->update();
+    searchSpace.markPromising(node);
+
+    if (node->isPickup())
+    {
+        assert((node + 1)->route() == route);
+        searchSpace.markPromising(node + 1);
+    }
+}
+
+// Inserts the given client or shipment at the cheapest position in its
+// neighbourhood.
+void insertGreedy(Route::Node *node,
+                  pyvrp::search::Solution &solution,
+                  pyvrp::search::SearchSpace &searchSpace,
+                  pyvrp::CostEvaluator const &costEvaluator)
+{
+    assert(node->isClient() || node->isPickup());
+    assert(!node->route());
+
+    if (node->isClient())
+        solution.insert(node, searchSpace, costEvaluator, true);
+    else
+        solution.insert(node, node + 1, searchSpace, costEvaluator, true);
+
+    inserted(node, searchSpace);
+}
+
+// Returns the cost delta of removing the given client or shipment from its
+// route, ignoring prizes.
+Cost removalCost(Route::Node *node, pyvrp::CostEvaluator const &costEvaluator)
+{
+    auto const *route = node->route();
+    auto const *last = node->isPickup() ? node + 1 : node;
+
+    if (route->numClients() + route->numShipments() == 1)
+        // This removal leaves the route empty, so the cost delta is just the
+        // current route cost.
+        return -costEvaluator.penalisedCost(*route);
+
+    Cost deltaCost = 0;
+    if (node == last || n(node) == last)
+        costEvaluator.deltaCost<true>(
+            deltaCost,
+            Route::Proposal(route->before(node->pos() - 1),
+                            route->after(last->pos() + 1)));
+    else
+        costEvaluator.deltaCost<true>(
+            deltaCost,
+            Route::Proposal(route->before(node->pos() - 1),
+                            route->between(node->pos() + 1, last->pos() - 1),
+                            route->after(last->pos() + 1)));
+
+    return deltaCost;
+}
+}  // namespace
 
 PerturbationParams::PerturbationParams(size_t minPerturbations,
-                                       size_t maxPerturbations)
-    : minPerturbations(minPerturbations), maxPerturbations(maxPerturbations)
+                                       size_t maxPerturbations,
+                                       RuinMethod ruinMethod,
+                                       RecreateMethod recreateMethod,
+                                       size_t maxStringLength,
+                                       double blinkRate)
+    : minPerturbations(minPerturbations),
+      maxPerturbations(maxPerturbations),
+      ruinMethod(ruinMethod),
+      recreateMethod(recreateMethod),
+      maxStringLength(maxStringLength),
+      blinkRate(blinkRate)
 {
     if (minPerturbations > maxPerturbations)
         throw std::invalid_argument(
             "min_perturbations must be <= max_perturbations.");
+
+    if (maxStringLength == 0)
+        throw std::invalid_argument("max_string_length must be positive.");
+
+    if (blinkRate < 0 || blinkRate >= 1)
+        throw std::invalid_argument("blink_rate must be in [0, 1).");
 }
 
 PerturbationManager::PerturbationManager(PerturbationParams params)
-    : params_(params), numPerturbations_(params_.minPerturbations)
+    : params_(params), numPerturbations_(params_.minPerturbations), seed_(0)
 {
 }
 
@@ -34,65 +151,269 @@ void PerturbationManager::shuffle(RandomNumberGenerator &rng)
 {
     auto const range = params_.maxPerturbations - params_.minPerturbations;
     numPerturbations_ = params_.minPerturbations + rng.randint(range + 1);
+
+    // Only the strings and worst ruin methods, and blink recreate, need random
+    // numbers of their own. We do not draw a seed otherwise, which keeps the
+    // random number stream of the default configuration unchanged.
+    if (params_.ruinMethod != RuinMethod::NEIGHBOURHOOD
+        || params_.recreateMethod == RecreateMethod::BLINK)
+        seed_ = rng();
 }
 
-void PerturbationManager::perturb(Solution &solution,
-                                  SearchSpace &searchSpace,
-                                  CostEvaluator const &costEvaluator) const
+std::vector<Route::Node *>
+PerturbationManager::ruin(Solution &solution,
+                          SearchSpace &searchSpace,
+                          CostEvaluator const &costEvaluator,
+                          RandomNumberGenerator &rng) const
 {
-    if (numPerturbations_ == 0)  // nothing to do
-        return;
+    assert(params_.ruinMethod != RuinMethod::NEIGHBOURHOOD);
 
-    // Clear the set of promising nodes. Perturbation determines the initial
-    // set of promising nodes for further (local search) improvement.
-    searchSpace.unmarkAllPromising();
+    std::vector<Route::Node *> removed;
+    removed.reserve(numPerturbations_);
 
-    auto const insert = [&](Route::Node *node)  // insert and mark promising
+    if (params_.ruinMethod == RuinMethod::STRINGS)
     {
-        assert(node->isClient() || node->isPickup());
-        assert(!node->route());
+        // The first planned activity in the (random) activity order seeds the
+        // removal. We remove one string from its route, and from the routes
+        // of its neighbours.
+        auto const &order = searchSpace.activityOrder();
+        auto const planned = [&](Activity const &activity)
+        { return solution[activity]->route() != nullptr; };
 
-        if (node->isClient())
+        auto const seed = std::find_if(order.begin(), order.end(), planned);
+        if (seed == order.end())  // there is nothing to remove
+            return removed;
+
+        std::vector<Activity> activities = {*seed};
+        auto const &neighbours = searchSpace.neighboursOf(*seed);
+        activities.insert(
+            activities.end(), neighbours.begin(), neighbours.end());
+
+        std::vector<Route const *> ruined;
+        for (auto const &activity : activities)
         {
-            solution.insert(node, searchSpace, costEvaluator, true);
-            node->route()->update();
-            searchSpace.markPromising(node);
+            if (removed.size() >= numPerturbations_)
+                break;
+
+            auto *node = solution[activity];
+            auto *route = node->route();
+            if (!route || std::find(ruined.begin(), ruined.end(), route)
+                              != ruined.end())
+                continue;
+
+            ruined.push_back(route);
+
+            // Select a string of random length that contains the node, and
+            // does not contain the start or end depots.
+            auto const maxLength = std::min(params_.maxStringLength,
+                                            numPerturbations_ - removed.size());
+            size_t const length = 1 + rng.randint(maxLength);
+            size_t const offset = rng.randint(length);
+            auto const first = node->pos() - std::min(offset, node->pos() - 1);
+            auto const last = std::min(first + length, route->size() - 1);
+
+            std::vector<Route::Node *> string;
+            for (size_t pos = first; pos != last; ++pos)
+            {
+                auto *strNode = (*route)[pos];
+                if (strNode->isDelivery())  // shipments are removed via their
+                    strNode = strNode - 1;  // pickup
+
+                if (!strNode->isClient() && !strNode->isPickup())
+                    continue;
+
+                if (std::find(string.begin(), string.end(), strNode)
+                    == string.end())
+                    string.push_back(strNode);
+            }
+
+            for (auto *strNode : string)
+            {
+                remove(strNode, searchSpace);
+                removed.push_back(strNode);
+            }
         }
-        else
+    }
+
+    if (params_.ruinMethod == RuinMethod::WORST)
+    {
+        std::vector<std::pair<Cost, Route::Node *>> candidates;
+        auto const addCandidates = [&](Route &route)
+        {
+            for (size_t idx = 1; idx != route.size() - 1; ++idx)
+            {
+                auto *node = route[idx];
+                if (node->isClient() || node->isPickup())
+                    candidates.emplace_back(removalCost(node, costEvaluator),
+                                            node);
+            }
+        };
+
+        for (auto &route : solution.routes)
+            addCandidates(route);
+
+        auto const cmp = [](auto const &lhs, auto const &rhs)
+        { return lhs.first < rhs.first; };
+
+        for (size_t count = 0; count != numPerturbations_; ++count)
         {
-            auto *pickup = node;
-            auto *delivery = node + 1;
-            solution.insert(pickup, delivery, searchSpace, costEvaluator, true);
+            if (candidates.empty())  // there is nothing left to remove
+                break;
+
+            std::stable_sort(candidates.begin(), candidates.end(), cmp);
 
-            auto *route = pickup->route();
-            assert(delivery->route() == route);
+            auto const y = std::pow(rng.rand(), WORST_REMOVAL_DETERMINISM);
+            auto idx = static_cast<size_t>(y * candidates.size());
+            idx = std::min(idx, candidates.size() - 1);
+            auto *node = candidates[idx].second;
+            auto *route = node->route();
 
-            route->update();
-            searchSpace.markPromising(pickup);
-            searchSpace.markPromising(delivery);
+            remove(node, searchSpace);
+            removed.push_back(node);
+
+            // The removal only changes the removal costs of the other clients
+            // and shipments in the same route, so we re-evaluate just those.
+            std::erase_if(candidates,
+                          [&](auto const &candidate)
+                          {
+                              return candidate.second == node
+                                     || candidate.second->route() == route;
+                          });
+
+            addCandidates(*route);
         }
-    };
+    }
+
+    return removed;
+}
+
+void PerturbationManager::recreate(std::vector<Route::Node *> &nodes,
+                                   Solution &solution,
+                                   SearchSpace &searchSpace,
+                                   CostEvaluator const &costEvaluator,
+                                   RandomNumberGenerator &rng) const
+{
+    if (params_.recreateMethod == RecreateMethod::GREEDY)
+    {
+        rng.shuffle(nodes.begin(), nodes.end());
+        for (auto *node : nodes)
+            insertGreedy(node, solution, searchSpace, costEvaluator);
+    }
 
-    auto const remove = [&](Route::Node *node)  // remove and mark promising
+    if (params_.recreateMethod == RecreateMethod::BLINK)
     {
-        assert(node->isClient() || node->isPickup());
-        assert(node->route());
+        rng.shuffle(nodes.begin(), nodes.end());
+        for (auto *node : nodes)
+        {
+            auto const insertions = solution.insertions(
+                node, searchSpace, costEvaluator, rng, params_.blinkRate);
 
-        searchSpace.markPromising(node);
+            if (insertions.empty())  // then all positions were skipped, and
+            {                        // we fall back to a greedy insertion
+                insertGreedy(node, solution, searchSpace, costEvaluator);
+                continue;
+            }
 
-        auto *route = node->route();
-        route->remove(node->pos());
+            auto const best = std::min_element(
+                insertions.begin(),
+                insertions.end(),
+                [](auto const &lhs, auto const &rhs)
+                { return lhs.deltaCost < rhs.deltaCost; });
 
-        if (node->isPickup())  // then we also remove the associated delivery
+            solution.insert(node, *best);
+            inserted(node, searchSpace);
+        }
+    }
+
+    if (params_.recreateMethod == RecreateMethod::REGRET)
+    {
+        auto const cmp = [](auto const &lhs, auto const &rhs)
+        { return lhs.deltaCost < rhs.deltaCost; };
+
+        // Each step inserts the node with the largest regret: the difference
+        // between the cost of inserting it into its second-best route and
+        // into its best route. Nodes that can be inserted into a single route
+        // only have infinite regret, and are thus inserted first. Ties are
+        // broken by insertion cost.
+        while (!nodes.empty())
         {
-            auto const *delivery = node + 1;
-            assert(delivery->route() == route);
+            auto bestIdx = nodes.size();
+            Solution::Insertion bestInsertion = {0, nullptr, 0};
+            Cost bestRegret = 0;
+
+            for (size_t idx = 0; idx != nodes.size(); ++idx)
+            {
+                auto insertions = solution.insertions(
+                    nodes[idx], searchSpace, costEvaluator, rng);
+
+                if (insertions.empty())
+                    continue;
+
+                auto const num = std::min<size_t>(insertions.size(), 2);
+                std::partial_sort(insertions.begin(),
+                                  insertions.begin() + num,
+                                  insertions.end(),
+                                  cmp);
 
-            searchSpace.markPromising(delivery);
-            route->remove(delivery->pos());
+                auto const regret = insertions.size() == 1
+                                        ? std::numeric_limits<Cost>::max()
+                                        : insertions[1].deltaCost
+                                              - insertions[0].deltaCost;
+
+                if (bestIdx == nodes.size() || regret > bestRegret
+                    || (regret == bestRegret
+                        && cmp(insertions[0], bestInsertion)))
+                {
+                    bestIdx = idx;
+                    bestInsertion = insertions[0];
+                    bestRegret = regret;
+                }
+            }
+
+            if (bestIdx == nodes.size())  // then there are no candidate
+            {                             // insertions, and we fall back to
+                for (auto *node : nodes)  // greedy insertion
+                    insertGreedy(node, solution, searchSpace, costEvaluator);
+
+                return;
+            }
+
+            auto *node = nodes[bestIdx];
+            solution.insert(node, bestInsertion);
+            inserted(node, searchSpace);
+            nodes.erase(nodes.begin() + bestIdx);
         }
+    }
+}
+
+void PerturbationManager::perturb(Solution &solution,
+                                  SearchSpace &searchSpace,
+                                  CostEvaluator const &costEvaluator) const
+{
+    if (numPerturbations_ == 0)  // nothing to do
+        return;
+
+    // Clear the set of promising nodes. Perturbation determines the initial
+    // set of promising nodes for further (local search) improvement.
+    searchSpace.unmarkAllPromising();
+
+    RandomNumberGenerator rng(seed_);
+
+    if (params_.ruinMethod != RuinMethod::NEIGHBOURHOOD)
+    {
+        auto removed = ruin(solution, searchSpace, costEvaluator, rng);
+        recreate(removed, solution, searchSpace, costEvaluator, rng);
+        return;
+    }
+
+    std::vector<Route::Node *> toInsert;
+    auto const insert = [&](Route::Node *node)  // insert and mark promising
+    {
+        assert(node->isClient() || node->isPickup());
+        assert(!node->route());
 
-        route->update();
+        toInsert = {node};
+        recreate(toInsert, solution, searchSpace, costEvaluator, rng);
     };
 
     DynamicBitset perturbed
@@ -144,7 +465,7 @@ void PerturbationManager::perturb(Solution &solution,
             for (auto *node : nodes)
             {
                 if (route)
-                    remove(node);
+                    remove(node, searchSpace);
                 else
                     insert(node);
 
@@ -6,12 +6,71 @@
 #include "SearchSpace.h"
 #include "Solution.h"
 
+#include <cstdint>
 #include <iosfwd>
+#include <vector>
 
 namespace pyvrp::search
 {
 /**
- * PerturbationParams(min_perturbations: int = 1, max_perturbations: int = 25)
+ * Enum of methods that remove clients and shipments from the solution during
+ * perturbation.
+ *
+ * Attributes
+ * ----------
+ * NEIGHBOURHOOD
+ *     Removes (resp., inserts) the planned (unplanned) clients and shipments
+ *     in the neighbourhoods of randomly selected activities.
+ * STRINGS
+ *     Removes strings of consecutive clients and shipments from the routes
+ *     that visit a randomly selected activity and its neighbours, following
+ *     the slack induction by string removals (SISR) heuristic. The removed
+ *     clients and shipments are then re-inserted.
+ * WORST
+ *     Removes clients and shipments whose removal saves the most cost,
+ *     with some randomisation. The removed clients and shipments are then
+ *     re-inserted.
+ */
+enum class RuinMethod
+{
+    NEIGHBOURHOOD = 0,
+    STRINGS = 1,
+    WORST = 2,
+};
+
+/**
+ * Enum of methods that insert clients and shipments into the solution during
+ * perturbation.
+ *
+ * Attributes
+ * ----------
+ * GREEDY
+ *     Inserts each client and shipment in turn, at the cheapest position in
+ *     its neighbourhood.
+ * BLINK
+ *     Like ``GREEDY``, but skips each candidate position with probability
+ *     ``blink_rate``.
+ * REGRET
+ *     Repeatedly inserts the client or shipment with the largest difference
+ *     in cost between inserting it into its best route and its second-best
+ *     route.
+ */
+enum class RecreateMethod
+{
+    GREEDY = 0,
+    BLINK = 1,
+    REGRET = 2,
+};
+
+/**
+ * PerturbationParams(
+ *     min_perturbations: int = 1,
+ *     max_perturbations: int = 25,
+ *     ruin_method: RuinMethod = RuinMethod.NEIGHBOURHOOD,
+ *     recreate_method: RecreateMethod = RecreateMethod.GREEDY,
+ *     max_string_length: int = 10,
+ *     blink_rate: float = 0.01,
+ * )
  *
  * Perturbation parameters.
  *
@@ -21,14 +80,33 @@ namespace pyvrp::search
  *     Minimum number of perturbations to apply. Must not be negative.
  * max_perturbations
  *     Maximum number of perturbations to apply.
+ * ruin_method
+ *     Method used to remove clients and shipments. Each removed client or
+ *     shipment counts as one perturbation.
+ * recreate_method
+ *     Method used to insert clients and shipments.
+ * max_string_length
+ *     Maximum number of clients and shipments in each string removed by
+ *     :attr:`~RuinMethod.STRINGS`. Must be positive.
+ * blink_rate
+ *     Probability of skipping a candidate insertion position when using
+ *     :attr:`~RecreateMethod.BLINK`. Must be in [0, 1).
  */
 struct PerturbationParams
 {
     size_t const minPerturbations;
     size_t const maxPerturbations;
+    RuinMethod const ruinMethod;
+    RecreateMethod const recreateMethod;
+    size_t const maxStringLength;
+    double const blinkRate;
 
     PerturbationParams(size_t minPerturbations = 1,
-                       size_t maxPerturbations = 25);
+                       size_t maxPerturbations = 25,
+                       RuinMethod ruinMethod = RuinMethod::NEIGHBOURHOOD,
+                       RecreateMethod recreateMethod = RecreateMethod::GREEDY,
+                       size_t maxStringLength = 10,
+                       double blinkRate = 0.01);
 
     bool operator==(PerturbationParams const &other) const = default;
 };
@@ -37,9 +115,10 @@ struct PerturbationParams
  * PerturbationManager(params: PerturbationParams)
  *
  * Handles perturbation during the search. In each iteration, it applies
- * :meth:`~num_perturbations` perturbations that strengthen (resp., weaken)
- * randomly selected neighbourhoods by inserting (removing) clients and
- * shipments.
+ * :meth:`~num_perturbations` perturbations. By default, these strengthen
+ * (resp., weaken) randomly selected neighbourhoods by inserting (removing)
+ * clients and shipments. Other ruin and recreate methods can be configured
+ * via the perturbation parameters.
  *
  * Parameters
  * ----------
@@ -50,6 +129,21 @@ class PerturbationManager
 {
     PerturbationParams const params_;  // owned by us
     size_t numPerturbations_;
+    uint32_t seed_;  // seeds the RNG used by the ruin and recreate methods
+
+    // Removes clients and shipments using the configured ruin method, and
+    // returns the removed nodes.
+    std::vector<Route::Node *> ruin(Solution &solution,
+                                    SearchSpace &searchSpace,
+                                    CostEvaluator const &costEvaluator,
+                                    RandomNumberGenerator &rng) const;
+
+    // Inserts the given nodes using the configured recreate method.
+    void recreate(std::vector<Route::Node *> &nodes,
+                  Solution &solution,
+                  SearchSpace &searchSpace,
+                  CostEvaluator const &costEvaluator,
+                  RandomNumberGenerator &rng) const;
 
 public:
     PerturbationManager(PerturbationParams params = PerturbationParams());
@@ -60,7 +154,8 @@ public:
     size_t numPerturbations() const;
 
     /**
-     * Draws and sets a new random number of perturbations to apply.
+     * Draws and sets a new random number of perturbations to apply, and
+     * reseeds the randomised ruin and recreate methods.
      */
     void shuffle(RandomNumberGenerator &rng);
 
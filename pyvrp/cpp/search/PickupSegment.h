@@ -6,6 +6,8 @@
 #include "LoadSegment.h"
 #include "ProblemData.h"
 
+#include <cassert>
+
 namespace pyvrp::search
 {
 /**
@@ -37,6 +39,12 @@ public:
                 shipment_.pickup.location};
     }
 
+    SegmentProxy at([[maybe_unused]] size_t idx) const
+    {
+        assert(idx == 0);
+        return front();
+    }
+
     size_t size() const { return 1; }
     size_t numClients() const { return 0; }
     size_t numPickups() const { return 1; }
@@ -5,6 +5,8 @@
 #include "LocalSearchOperator.h"
 
 #include <cassert>
+#include <optional>
+#include <variant>
 #include <vector>
 
 namespace pyvrp::search
@@ -36,6 +38,11 @@ public:
                                    Route::Node *V,
                                    CostEvaluator const &costEvaluator) override;
 
+    std::optional<Cost>
+    lowerBound(Route::Node *U,
+               Route::Node *V,
+               CostEvaluator const &costEvaluator) const override;
+
     void apply(Route::Node *U, Route::Node *V) const override;
 
     void init(Solution &solution) override;
@@ -152,6 +159,64 @@ std::pair<Cost, bool> Relocate<N>::evaluate(Route::Node *U,
     return std::make_pair(deltaCost, deltaCost < 0);
 }
 
+template <size_t N>
+std::optional<Cost>
+Relocate<N>::lowerBound(Route::Node *U,
+                        Route::Node *V,
+                        CostEvaluator const &costEvaluator) const
+{
+    // Only moves between routes are bounded. Moves within a route often
+    // change few arcs, so they are cheap enough to evaluate directly.
+    if (!U->route() || !V->route() || U->route() == V->route() || hasDepot(U)
+        || splitsShipment(U))
+        return std::nullopt;
+
+    auto const *uRoute = U->route();
+    auto const *vRoute = V->route();
+    auto const first = U->pos();
+    auto const last = first + N - 1;
+
+    Cost bound = 0;
+    auto const idx = (U->isClient() ? 0 : data.numClients()) + U->idx();
+    if (hasCachedRemoveCost_[idx])
+        bound += removeCost_[idx];
+    else if (uRoute->numClients() + 2 * uRoute->numShipments() == N)
+        bound -= costEvaluator.penalisedCost(*uRoute);
+    else
+    {
+        // Removing the segment from U's route replaces the arcs around it by
+        // a single arc connecting its predecessor and successor.
+        auto const pred = uRoute->at(first - 1).front().location();
+        auto const succ = uRoute->at(last + 1).front().location();
+        auto const added = [&](auto const &mat) { return mat(pred, succ); };
+
+        auto const &uDist = data.distanceMatrix(uRoute->profile());
+        auto const removed = uRoute->between(first - 1, last + 1);
+        auto const dist = uRoute->distance()
+                          - removed.distance(uRoute->profile())
+                          + std::visit(added, uDist);
+
+        bound += distanceBound(*uRoute, dist, costEvaluator);
+    }
+
+    // Inserting the segment after V replaces the arc leaving V by the arcs to
+    // and from the segment. The segment's own distance is non-negative, so we
+    // can leave it out of the bound.
+    auto const from = vRoute->at(V->pos()).front().location();
+    auto const to = vRoute->at(V->pos() + 1).front().location();
+    auto const delta = [&](auto const &mat)
+    {
+        return mat(from, uRoute->at(first).front().location())
+               + mat(uRoute->at(last).front().location(), to)
+               - mat(from, to);
+    };
+
+    auto const &vDist = data.distanceMatrix(vRoute->profile());
+    auto const dist = vRoute->distance() + std::visit(delta, vDist);
+
+    return bound + distanceBound(*vRoute, dist, costEvaluator);
+}
+
 template <size_t N>
 void Relocate<N>::apply(Route::Node *U, Route::Node *V) const
 {
@@ -204,7 +269,7 @@ template <size_t N> void Relocate<N>::update(Route const *route)
 
 template <size_t N>
 Relocate<N>::Relocate(ProblemData const &data)
-    : BinaryOperator(data),
+    : BinaryOperator(data, true),
       hasCachedRemoveCost_(data.numClients() + data.numShipments()),
       removeCost_(data.numClients() + data.numShipments())
 {
@@ -1,7 +1,10 @@
 #include "RelocateShipment.h"
 
+#include "IncrementalSegmentBetween.h"
+
 #include <cassert>
 
+using pyvrp::search::IncrementalSegmentBetween;
 using pyvrp::search::RelocateShipment;
 
 std::pair<pyvrp::Cost, bool> RelocateShipment::evaluate(
@@ -64,15 +67,17 @@ std::pair<pyvrp::Cost, bool> RelocateShipment::evaluate(
         return std::make_pair(deltaCost, true);
     }
 
-    // Pickup after V, delivery later in the route.
-    for (auto const *node = n(V); !node->isDepot(); node = n(node))
+    // Pickup after V, delivery later in the route. The segment between the
+    // pickup and delivery is grown incrementally, in constant time per node.
+    IncrementalSegmentBetween between = {data, n(V)};
+    for (auto const *node = n(V); !node->isDepot(); node = n(node), ++between)
     {
         Cost deltaCost = removeCost_[uPickup->idx()];
         costEvaluator.deltaCost(
             deltaCost,
             Route::Proposal(vRoute->before(V->pos()),
                             uRoute->at(uPickup->pos()),
-                            vRoute->between(V->pos() + 1, node->pos()),
+                            between,
                             uRoute->at(uDelivery->pos()),
                             vRoute->after(node->pos() + 1)));
 
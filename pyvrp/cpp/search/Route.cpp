@@ -2,6 +2,7 @@
 
 #include <ostream>
 #include <utility>
+#include <variant>
 
 using pyvrp::search::Route;
 
@@ -235,13 +236,17 @@ void Route::update()
             = numDeliveries_[idx - 1] + nodes[idx]->isDelivery();
 
     // Distance.
-    auto const &distMat = data.distanceMatrix(profile());
-
     cumDist.resize(nodes.size());
     cumDist[0] = 0;
-    for (size_t idx = 1; idx != nodes.size(); ++idx)
-        cumDist[idx]
-            = cumDist[idx - 1] + distMat(locations[idx - 1], locations[idx]);
+
+    auto const accumulate = [&](auto const &distMat)
+    {
+        for (size_t idx = 1; idx != nodes.size(); ++idx)
+            cumDist[idx] = cumDist[idx - 1]
+                           + distMat(locations[idx - 1], locations[idx]);
+    };
+
+    std::visit(accumulate, data.distanceMatrix(profile()));
 
     // Duration.
     durAt.resize(nodes.size());
@@ -279,51 +284,56 @@ void Route::update()
         }
     }
 
-    auto const &durations = data.durationMatrix(profile());
-
-    durBefore.resize(nodes.size());
-    durBefore[0] = durAt[0];
-    for (size_t idx = 1; idx != nodes.size(); ++idx)
+    auto const schedule = [&](auto const &durations)
     {
-        auto const prev = idx - 1;
-        auto before = nodes[prev]->isReloadDepot()
-                          ? durBefore[prev].finaliseBack()
-                          : durBefore[prev];
-
-        if (nodes[prev]->isReloadDepot())
+        durBefore.resize(nodes.size());
+        durBefore[0] = durAt[0];
+        for (size_t idx = 1; idx != nodes.size(); ++idx)
         {
-            // Then we need to first account for depot service before we merge
-            // with the idx segment.
-            auto const &depot = data.depot(nodes[prev]->idx());
-            before = DurationSegment::merge(before, {depot.serviceDuration});
-        }
+            auto const prev = idx - 1;
+            auto before = nodes[prev]->isReloadDepot()
+                              ? durBefore[prev].finaliseBack()
+                              : durBefore[prev];
 
-        auto const edgeDur = durations(locations[prev], locations[idx]);
-        durBefore[idx] = DurationSegment::merge(edgeDur, before, durAt[idx]);
-    }
+            if (nodes[prev]->isReloadDepot())
+            {
+                // Then we need to first account for depot service before we
+                // merge with the idx segment.
+                auto const &depot = data.depot(nodes[prev]->idx());
+                before = DurationSegment::merge(before,
+                                                {depot.serviceDuration});
+            }
 
-    durAfter.resize(nodes.size());
-    durAfter[nodes.size() - 1] = durAt[nodes.size() - 1];
-    for (size_t next = nodes.size() - 1; next != 0; --next)
-    {
-        auto const idx = next - 1;
-        auto after = nodes[next]->isReloadDepot()
-                         ? durAfter[next].finaliseFront()
-                         : durAfter[next];
+            auto const edgeDur = durations(locations[prev], locations[idx]);
+            durBefore[idx]
+                = DurationSegment::merge(edgeDur, before, durAt[idx]);
+        }
 
-        if (nodes[idx]->isReloadDepot())
+        durAfter.resize(nodes.size());
+        durAfter[nodes.size() - 1] = durAt[nodes.size() - 1];
+        for (size_t next = nodes.size() - 1; next != 0; --next)
         {
-            // This is not entirely correct logically, since we now do service
-            // at idx after already travelling to next, but that's OK since
-            // we're essentially using the trick of adding service to the
-            // outgoing edge.
-            auto const &depot = data.depot(nodes[idx]->idx());
-            after = DurationSegment::merge({depot.serviceDuration}, after);
+            auto const idx = next - 1;
+            auto after = nodes[next]->isReloadDepot()
+                             ? durAfter[next].finaliseFront()
+                             : durAfter[next];
+
+            if (nodes[idx]->isReloadDepot())
+            {
+                // This is not entirely correct logically, since we now do
+                // service at idx after already travelling to next, but that's
+                // OK since we're essentially using the trick of adding service
+                // to the outgoing edge.
+                auto const &depot = data.depot(nodes[idx]->idx());
+                after = DurationSegment::merge({depot.serviceDuration}, after);
+            }
+
+            auto const edgeDur = durations(locations[idx], locations[next]);
+            durAfter[idx] = DurationSegment::merge(edgeDur, durAt[idx], after);
         }
+    };
 
-        auto const edgeDur = durations(locations[idx], locations[next]);
-        durAfter[idx] = DurationSegment::merge(edgeDur, durAt[idx], after);
-    }
+    std::visit(schedule, data.durationMatrix(profile()));
 
     // Load.
     for (size_t dim = 0; dim != data.numLoadDimensions(); ++dim)
@@ -401,6 +411,10 @@ void Route::update()
     durationCost_ = unitDurationCost() * static_cast<Cost>(duration_)
                     + unitOvertimeCost() * static_cast<Cost>(overtime);
 
+    latenessCost_ = 0;
+    if (data.hasLatenessCosts())
+        latenessCost_ = latenessCost(SegmentBefore(*this, nodes.size() - 1));
+
 #ifndef NDEBUG
     dirty = false;
 #endif
@@ -11,7 +11,9 @@
 #include <cassert>
 #include <concepts>
 #include <iosfwd>
+#include <optional>
 #include <utility>
+#include <variant>
 
 namespace pyvrp::search
 {
@@ -24,6 +26,7 @@ concept Segment
           { arg.route() };
           { arg.front() } -> std::convertible_to<SegmentProxy>;
           { arg.back() } -> std::convertible_to<SegmentProxy>;
+          { arg.at(idx) } -> std::convertible_to<SegmentProxy>;
           { arg.size() } -> std::same_as<size_t>;
           { arg.numClients() } -> std::same_as<size_t>;
           { arg.numPickups() } -> std::same_as<size_t>;
@@ -89,8 +92,16 @@ public:
      */
     template <Segment... Segments> class Proposal
     {
+        friend class Route;
+
         std::tuple<Segments...> segments_;
 
+        // Number of activities in the proposed route.
+        size_t size() const;
+
+        // Activity at the given index in the proposed route.
+        SegmentProxy at(size_t idx) const;
+
     public:
         Proposal(Segments &&...segments);
 
@@ -114,7 +125,8 @@ public:
 
         /**
          * Returns the (duration cost, time warp) attributes of the proposed
-         * route.
+         * route. The duration cost includes any lateness costs, which takes
+         * time linear in the size of the proposed route to evaluate.
          */
         std::pair<Cost, Duration> duration() const;
 
@@ -243,6 +255,7 @@ public:
 
         inline SegmentProxy front() const;  // at start
         inline SegmentProxy back() const;   // at end depot
+        inline SegmentProxy at(size_t idx) const;
 
         inline size_t size() const;
         inline size_t numClients() const;
@@ -271,6 +284,7 @@ public:
 
         inline SegmentProxy front() const;  // at start depot
         inline SegmentProxy back() const;   // at end
+        inline SegmentProxy at(size_t idx) const;
 
         inline size_t size() const;
         inline size_t numClients() const;
@@ -302,6 +316,7 @@ public:
 
         inline SegmentProxy front() const;  // at start
         inline SegmentProxy back() const;   // at end
+        inline SegmentProxy at(size_t idx) const;
 
         inline size_t size() const;
         inline size_t numClients() const;
@@ -328,6 +343,7 @@ private:
     Distance excessDistance_;
     Duration duration_;
     Cost durationCost_;
+    Cost latenessCost_;
     Duration timeWarp_;
 
     std::vector<Node> depots_;  // start, end, and reload depots (in that order)
@@ -367,6 +383,12 @@ private:
     bool dirty = false;
 #endif
 
+    // Returns the lateness cost of the given activities, which start and end
+    // at this route's depots. This follows the schedule of pyvrp::Route, and
+    // takes time linear in the number of activities.
+    template <typename Activities>
+    Cost latenessCost(Activities const &activities) const;
+
 public:
     /**
      * @return The client or depot node at the given ``idx``.
@@ -478,6 +500,11 @@ public:
      */
     [[nodiscard]] inline Cost durationCost() const;
 
+    /**
+     * @return Total lateness cost of the activities on this route.
+     */
+    [[nodiscard]] inline Cost latenessCost() const;
+
     /**
      * @return Cost per unit of duration travelled on this route.
      */
@@ -800,6 +827,12 @@ SegmentProxy Route::SegmentBefore::back() const
     return {route_.nodes[end]->activity(), route_.locations[end]};
 }
 
+SegmentProxy Route::SegmentBefore::at(size_t idx) const
+{
+    assert(idx <= end);
+    return {route_.nodes[idx]->activity(), route_.locations[idx]};
+}
+
 size_t Route::SegmentBefore::size() const { return end + 1; }
 
 size_t Route::SegmentBefore::numClients() const
@@ -831,6 +864,13 @@ SegmentProxy Route::SegmentAfter::back() const
     return {route_.nodes.back()->activity(), route_.locations.back()};
 }
 
+SegmentProxy Route::SegmentAfter::at(size_t idx) const
+{
+    assert(start + idx < route_.size());
+    auto const pos = start + idx;
+    return {route_.nodes[pos]->activity(), route_.locations[pos]};
+}
+
 size_t Route::SegmentAfter::size() const { return route_.size() - start; }
 
 size_t Route::SegmentAfter::numClients() const
@@ -867,6 +907,13 @@ SegmentProxy Route::SegmentBetween::back() const
     return {route_.nodes[end]->activity(), route_.locations[end]};
 }
 
+SegmentProxy Route::SegmentBetween::at(size_t idx) const
+{
+    assert(start + idx <= end);
+    auto const pos = start + idx;
+    return {route_.nodes[pos]->activity(), route_.locations[pos]};
+}
+
 size_t Route::SegmentBetween::size() const { return end - start + 1; }
 
 size_t Route::SegmentBetween::numClients() const
@@ -899,17 +946,20 @@ Distance Route::SegmentBetween::distance(size_t profile) const
 {
     if (profile != route_.profile())  // then we have to compute the distance
     {                                 // segment from scratch.
-        auto const &mat = route_.data.distanceMatrix(profile);
-        Distance distance = 0;
-
-        for (size_t step = start; step != end; ++step)
+        auto const fn = [&](auto const &mat)
         {
-            auto const from = route_.locations[step];
-            auto const to = route_.locations[step + 1];
-            distance += mat(from, to);
-        }
+            Distance distance = 0;
+            for (size_t step = start; step != end; ++step)
+            {
+                auto const from = route_.locations[step];
+                auto const to = route_.locations[step + 1];
+                distance += mat(from, to);
+            }
 
-        return distance;
+            return distance;
+        };
+
+        return std::visit(fn, route_.data.distanceMatrix(profile));
     }
 
     auto const startDist = route_.cumDist[start];
@@ -921,7 +971,6 @@ Distance Route::SegmentBetween::distance(size_t profile) const
 
 DurationSegment Route::SegmentBetween::duration(size_t profile) const
 {
-    auto const &mat = route_.data.durationMatrix(profile);
     auto segment = route_.durAt[start];
 
     if (size() != 1 && route_[start]->isReloadDepot())  // first need to add the
@@ -930,14 +979,18 @@ DurationSegment Route::SegmentBetween::duration(size_t profile) const
         segment = DurationSegment::merge(segment, {depot.serviceDuration});
     }
 
-    for (size_t step = start; step != end; ++step)
+    auto const fn = [&](auto const &mat)
     {
-        auto const from = route_.locations[step];
-        auto const to = route_.locations[step + 1];
-        auto const &durAt = route_.durAt[step + 1];
-        segment = DurationSegment::merge(mat(from, to), segment, durAt);
-    }
+        for (size_t step = start; step != end; ++step)
+        {
+            auto const from = route_.locations[step];
+            auto const to = route_.locations[step + 1];
+            auto const &durAt = route_.durAt[step + 1];
+            segment = DurationSegment::merge(mat(from, to), segment, durAt);
+        }
+    };
 
+    std::visit(fn, route_.data.durationMatrix(profile));
     return segment;
 }
 
@@ -1057,6 +1110,12 @@ Cost Route::durationCost() const
     return durationCost_;
 }
 
+Cost Route::latenessCost() const
+{
+    assert(!dirty);
+    return latenessCost_;
+}
+
 Cost Route::unitDurationCost() const { return vehicleType_.unitDurationCost; }
 
 Cost Route::unitOvertimeCost() const { return vehicleType_.unitOvertimeCost; }
@@ -1065,6 +1124,7 @@ bool Route::hasDurationCost() const
 {
     // clang-format off
     return data.hasTimeWindows()
+        || data.hasLatenessCosts()
         || unitDurationCost() != 0
         || (unitOvertimeCost() != 0 && maxOvertime() != 0)
         || maxDuration() != std::numeric_limits<Duration>::max();
@@ -1153,6 +1213,156 @@ Route::SegmentBetween Route::between(size_t start, size_t end) const
     return {*this, start, end};
 }
 
+template <typename Activities>
+Cost Route::latenessCost(Activities const &activities) const
+{
+    auto const size = activities.size();
+    assert(size >= 2);
+
+    // Each trip is released at the latest release time of its clients. Trips
+    // start at the depot at the given index.
+    auto const releaseTime = [&](size_t idx)
+    {
+        Duration releaseTime = 0;
+        for (++idx; idx != size - 1; ++idx)
+        {
+            auto const activity = activities.at(idx).activity();
+            if (activity.isDepot())
+                break;
+
+            if (activity.isClient())
+            {
+                auto const &client = data.client(activity.idx());
+                releaseTime = std::max(releaseTime, client.releaseTime);
+            }
+        }
+
+        return releaseTime;
+    };
+
+    // The route starts at the earliest start time of its duration segment,
+    // which we compute as pyvrp::Route does: backwards, finalising the trips
+    // at each reload depot.
+    auto const startTime = [&](auto const &durations)
+    {
+        auto const &end = data.depot(endDepot());
+        auto ds = DurationSegment::merge(
+            {end, 0}, {vehicleType_, vehicleType_.twLate});
+
+        auto nextLoc = activities.at(size - 1).location();
+        for (size_t idx = size - 2; idx != 0; --idx)
+        {
+            auto const proxy = activities.at(idx);
+            auto const edgeDur = durations(proxy.location(), nextLoc);
+            nextLoc = proxy.location();
+
+            auto const activity = proxy.activity();
+            switch (activity.type())
+            {
+            case Activity::ActivityType::DEPOT:
+            {
+                auto const &depot = data.depot(activity.idx());
+                DurationSegment const depotDS = {depot, depot.serviceDuration};
+                ds = DurationSegment::merge(edgeDur, depotDS, ds);
+                ds = ds.finaliseFront();
+                break;
+            }
+
+            case Activity::ActivityType::CLIENT:
+            {
+                DurationSegment const clientDS = {data.client(activity.idx())};
+                ds = DurationSegment::merge(edgeDur, clientDS, ds);
+                break;
+            }
+
+            case Activity::ActivityType::PICKUP:
+            case Activity::ActivityType::DELIVERY:
+            {
+                auto const &shipment = data.shipment(activity.idx());
+                DurationSegment const stepDS = activity.isPickup()
+                                                   ? shipment.pickup
+                                                   : shipment.delivery;
+                ds = DurationSegment::merge(edgeDur, stepDS, ds);
+                break;
+            }
+            }
+        }
+
+        auto const &start = data.depot(startDepot());
+        auto const edgeDur = durations(start.location, nextLoc);
+        DurationSegment const depotStart = {start, start.serviceDuration};
+        ds = DurationSegment::merge(edgeDur, depotStart, ds);
+        ds = DurationSegment::merge({vehicleType_, vehicleType_.startLate}, ds);
+        return ds.startEarly();
+    };
+
+    // We then simulate the schedule forwards, starting each activity as early
+    // as its time window allows, and evaluate the lateness costs.
+    auto const simulate = [&](auto const &durations)
+    {
+        Cost cost = 0;
+        auto now = startTime(durations);
+        auto const serve = [&](Duration early, Duration late, auto const &arg)
+        {
+            // Service starts when the time window opens, or, if we arrive
+            // after the time window closes, at its end, with time warp.
+            now = std::min(std::max(now, early), late);
+            if constexpr (requires { arg.latenessCost; })
+                if (arg.latenessCost)
+                    cost += (*arg.latenessCost)(now.get());
+
+            now += arg.serviceDuration;
+        };
+
+        auto const &start = data.depot(startDepot());
+        auto const startRelease = std::min(releaseTime(0), start.twLate);
+        serve(std::max(start.twEarly, startRelease),
+              std::min(start.twLate, vehicleType_.startLate),
+              start);
+
+        auto prevLoc = activities.at(0).location();
+        for (size_t idx = 1; idx != size - 1; ++idx)
+        {
+            auto const proxy = activities.at(idx);
+            now += durations(prevLoc, proxy.location());
+            prevLoc = proxy.location();
+
+            auto const activity = proxy.activity();
+            switch (activity.type())
+            {
+            case Activity::ActivityType::DEPOT:
+            {
+                auto const &depot = data.depot(activity.idx());
+                auto const release = std::min(releaseTime(idx), depot.twLate);
+                serve(std::max(depot.twEarly, release), depot.twLate, depot);
+                break;
+            }
+
+            case Activity::ActivityType::CLIENT:
+            {
+                auto const &client = data.client(activity.idx());
+                serve(client.twEarly, client.twLate, client);
+                break;
+            }
+
+            case Activity::ActivityType::PICKUP:
+            case Activity::ActivityType::DELIVERY:
+            {
+                auto const &shipment = data.shipment(activity.idx());
+                auto const &step = activity.isPickup() ? shipment.pickup
+                                                       : shipment.delivery;
+                serve(step.twEarly, step.twLate, step);
+                break;
+            }
+            }
+        }
+
+        return cost;
+    };
+
+    return std::visit(simulate, data.durationMatrix(profile()));
+}
+
 template <Segment... Segments>
 Route::Proposal<Segments...>::Proposal(Segments &&...segments)
     : segments_(std::forward<Segments>(segments)...)
@@ -1181,6 +1391,34 @@ Route const *Route::Proposal<Segments...>::route() const
     return std::get<0>(segments_).route();
 }
 
+template <Segment... Segments>
+size_t Route::Proposal<Segments...>::size() const
+{
+    return std::apply([](auto &&...args) { return (args.size() + ...); },
+                      segments_);
+}
+
+template <Segment... Segments>
+SegmentProxy Route::Proposal<Segments...>::at(size_t idx) const
+{
+    std::optional<SegmentProxy> proxy;
+    auto const find = [&](auto const &segment)
+    {
+        if (proxy)  // already found in an earlier segment
+            return;
+
+        if (idx < segment.size())
+            proxy = segment.at(idx);
+        else
+            idx -= segment.size();
+    };
+
+    std::apply([&](auto const &...args) { (find(args), ...); }, segments_);
+
+    assert(proxy);
+    return *proxy;
+}
+
 template <Segment... Segments>
 Cost Route::Proposal<Segments...>::fixedVehicleCost() const
 {
@@ -1194,9 +1432,7 @@ std::pair<Cost, Distance> Route::Proposal<Segments...>::distance() const
     auto const unitDistanceCost = route()->unitDistanceCost();
     auto const maxDistance = route()->maxDistance();
     auto const profile = route()->profile();
-    auto const &matrix = data.distanceMatrix(profile);
-
-    auto const fn = [&](auto &&segment, auto &&...args)
+    auto const fn = [&](auto const &matrix, auto &&segment, auto &&...args)
     {
         auto distance = segment.distance(profile);
         auto lastLoc = segment.back().location();
@@ -1218,7 +1454,16 @@ std::pair<Cost, Distance> Route::Proposal<Segments...>::distance() const
         return std::make_pair(cost, excess);
     };
 
-    return std::apply(fn, segments_);
+    // We dispatch on the matrix storage once, rather than for each lookup.
+    auto const evaluate = [&](auto const &matrix)
+    {
+        auto const withMatrix = [&](auto &&...segments)
+        { return fn(matrix, std::forward<decltype(segments)>(segments)...); };
+
+        return std::apply(withMatrix, segments_);
+    };
+
+    return std::visit(evaluate, data.distanceMatrix(profile));
 }
 
 template <Segment... Segments>
@@ -1230,12 +1475,10 @@ std::pair<Cost, Duration> Route::Proposal<Segments...>::duration() const
     auto const shiftDuration = route()->shiftDuration();
     auto const maxDuration = route()->maxDuration();
     auto const profile = route()->profile();
-    auto const &matrix = data.durationMatrix(profile);
-
     // Finalising is expensive with duration segments. However, finaliseFront is
     // significantly less expensive than finaliseBack. To use it, we iterate the
     // segments in reverse (right to left, rather than default left to right).
-    auto const fn = [&](auto &&segment, auto &&...args)
+    auto const fn = [&](auto const &matrix, auto &&segment, auto &&...args)
     {
         auto ds = segment.duration(profile);
         auto firstLoc = segment.front().location();
@@ -1280,16 +1523,29 @@ std::pair<Cost, Duration> Route::Proposal<Segments...>::duration() const
         };
 
         merge(merge, std::forward<decltype(args)>(args)...);
+        return ds;
+    };
+
+    // We dispatch on the matrix storage once, rather than for each lookup.
+    auto const evaluate = [&](auto const &matrix)
+    {
+        auto const withMatrix = [&](auto &&...segments)
+        { return fn(matrix, std::forward<decltype(segments)>(segments)...); };
 
-        auto const duration = ds.duration();
-        auto const overtime = std::max<Duration>(duration - shiftDuration, 0);
-        auto const cost = unitDurationCost * static_cast<Cost>(duration)
-                          + unitOvertimeCost * static_cast<Cost>(overtime);
-        auto const timeWarp = ds.timeWarp(maxDuration);
-        return std::make_pair(cost, timeWarp);
+        return std::apply(withMatrix, detail::reverse(segments_));
     };
 
-    return std::apply(fn, detail::reverse(segments_));
+    auto const ds = std::visit(evaluate, data.durationMatrix(profile));
+
+    auto const duration = ds.duration();
+    auto const overtime = std::max<Duration>(duration - shiftDuration, 0);
+    auto cost = unitDurationCost * static_cast<Cost>(duration)
+                + unitOvertimeCost * static_cast<Cost>(overtime);
+
+    if (data.hasLatenessCosts())
+        cost += route()->latenessCost(*this);
+
+    return std::make_pair(cost, ds.timeWarp(maxDuration));
 }
 
 template <Segment... Segments>
@@ -1347,6 +1603,7 @@ pyvrp::CostEvaluator::penalisedCost(pyvrp::search::Route const &route) const
     // clang-format off
     return route.distanceCost()
          + route.durationCost()
+         + route.latenessCost()
          + route.fixedVehicleCost()
          + excessLoadPenalties(route.excessLoad())
          + twPenalty(route.timeWarp())
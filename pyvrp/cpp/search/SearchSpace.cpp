@@ -8,8 +8,38 @@ using pyvrp::Activity;
 using pyvrp::search::Route;
 using pyvrp::search::SearchSpace;
 
+namespace
+{
+void validateNeighbours(SearchSpace::Neighbours const &neighbours)
+{
+    for (auto const &[activity, neighbourhood] : neighbours)
+    {
+        if (!activity.isClient() && !activity.isPickup())
+        {
+            std::ostringstream msg;
+            msg << "Expected neighbourhoods for clients and pickups, not "
+                << activity << ".";
+            throw std::runtime_error(msg.str());
+        }
+
+        auto const beginPos = neighbourhood.begin();
+        auto const endPos = neighbourhood.end();
+
+        auto const pred = [&](auto const &item) { return item == activity; };
+
+        if (std::any_of(beginPos, endPos, pred))
+        {
+            std::ostringstream msg;
+            msg << "Neighbourhood of " << activity << " contains itself.";
+            throw std::runtime_error(msg.str());
+        }
+    }
+}
+}  // namespace
+
 SearchSpace::SearchSpace(ProblemData const &data, Neighbours neighbours)
-    : promising_(data.numClients() + data.numShipments())
+    : numProfiles_(data.numProfiles()),
+      promising_(data.numClients() + data.numShipments())
 {
     if (neighbours.size() != data.numClients() + data.numShipments())
         throw std::runtime_error(
@@ -36,35 +66,41 @@ void SearchSpace::setNeighbours(Neighbours neighbours)
     if (!neighbours_.empty() && neighbours.size() != neighbours_.size())
         throw std::runtime_error("Neighbourhood dimensions do not match.");
 
-    for (auto const &[activity, neighbourhood] : neighbours)
-    {
-        if (!activity.isClient() && !activity.isPickup())
-        {
-            std::ostringstream msg;
-            msg << "Expected neighbourhoods for clients and pickups, not "
-                << activity << ".";
-            throw std::runtime_error(msg.str());
-        }
+    validateNeighbours(neighbours);
+    neighbours_ = neighbours;
+}
 
-        auto const beginPos = neighbourhood.begin();
-        auto const endPos = neighbourhood.end();
+SearchSpace::Neighbours const &SearchSpace::neighbours() const
+{
+    return neighbours_;
+}
 
-        auto const pred = [&](auto const &item) { return item == activity; };
+void SearchSpace::setProfileNeighbours(std::vector<Neighbours> neighbours)
+{
+    if (!neighbours.empty() && neighbours.size() != numProfiles_)
+        throw std::runtime_error(
+            "Expected a neighbourhood structure for each profile.");
 
-        if (std::any_of(beginPos, endPos, pred))
-        {
-            std::ostringstream msg;
-            msg << "Neighbourhood of " << activity << " contains itself.";
-            throw std::runtime_error(msg.str());
-        }
+    for (auto const &profileNeighbours : neighbours)
+    {
+        if (profileNeighbours.size() != neighbours_.size())
+            throw std::runtime_error("Neighbourhood dimensions do not match.");
+
+        validateNeighbours(profileNeighbours);
     }
 
-    neighbours_ = neighbours;
+    profileNeighbours_ = neighbours;
 }
 
-SearchSpace::Neighbours const &SearchSpace::neighbours() const
+std::vector<SearchSpace::Neighbours> const &
+SearchSpace::profileNeighbours() const
 {
-    return neighbours_;
+    return profileNeighbours_;
+}
+
+bool SearchSpace::hasProfileNeighbours() const
+{
+    return !profileNeighbours_.empty();
 }
 
 std::vector<Activity> const &
@@ -73,6 +109,16 @@ SearchSpace::neighboursOf(Activity const &activity) const
     return neighbours_.at(activity);
 }
 
+std::vector<Activity> const &
+SearchSpace::neighboursOf(Activity const &activity, size_t profile) const
+{
+    if (profileNeighbours_.empty())
+        return neighbours_.at(activity);
+
+    assert(profile < profileNeighbours_.size());
+    return profileNeighbours_[profile].at(activity);
+}
+
 bool SearchSpace::isPromising(Activity const &activity) const
 {
     assert(activity.isClient() || activity.isShipment());
@@ -20,6 +20,11 @@ namespace pyvrp::search
  * to determine which activity's neighbourhoods to search. It can also be used
  * to define a (randomised) search ordering for activities, routes, and vehicle
  * types.
+ *
+ * Optionally, the search space can additionally store a separate neighbourhood
+ * for each routing profile. This is useful for heterogeneous fleets, where
+ * activities that are close for one vehicle type need not be close for
+ * another.
  */
 class SearchSpace
 {
@@ -31,6 +36,11 @@ private:
     // and pickup activity.
     Neighbours neighbours_;
 
+    // Optional neighbourhood restrictions for each routing profile. This is
+    // either empty, or contains one neighbourhood structure per profile.
+    std::vector<Neighbours> profileNeighbours_;
+    size_t numProfiles_;
+
     // Activity order used for node-based search.
     std::vector<Activity> activityOrder_;
 
@@ -58,12 +68,38 @@ public:
      */
     Neighbours const &neighbours() const;
 
+    /**
+     * Set per-profile neighbourhood structures. The argument should either be
+     * empty, which disables per-profile neighbourhoods, or contain one
+     * neighbourhood structure for each routing profile.
+     */
+    void setProfileNeighbours(std::vector<Neighbours> neighbours);
+
+    /**
+     * Returns the current per-profile neighbourhood structures. This is empty
+     * when per-profile neighbourhoods are not used.
+     */
+    std::vector<Neighbours> const &profileNeighbours() const;
+
+    /**
+     * Returns whether per-profile neighbourhood structures are used.
+     */
+    bool hasProfileNeighbours() const;
+
     /**
      * Returns the vector of neighbours for a given client or shipment
      * activity.
      */
     std::vector<Activity> const &neighboursOf(Activity const &activity) const;
 
+    /**
+     * Returns the vector of neighbours for a given client or shipment activity
+     * that are relevant to routes of the given profile. This falls back to the
+     * regular neighbourhood when per-profile neighbourhoods are not used.
+     */
+    std::vector<Activity> const &neighboursOf(Activity const &activity,
+                                              size_t profile) const;
+
     /**
      * Returns whether the given activity is a promising evaluation candidate.
      */
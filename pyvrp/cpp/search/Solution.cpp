@@ -3,6 +3,7 @@
 #include "ClientSegment.h"
 #include "DeliverySegment.h"
 #include "DurationSegment.h"
+#include "IncrementalSegmentBetween.h"
 #include "LoadSegment.h"
 #include "PickupSegment.h"
 #include "Route.h"
@@ -14,83 +15,12 @@
 #include <vector>
 
 using pyvrp::Cost;
+using pyvrp::search::IncrementalSegmentBetween;
 using pyvrp::search::Route;
 using pyvrp::search::Solution;
 
 namespace
 {
-/**
- * Segment that tracks a route segment between ``[start, end]``, but does so
- * incrementally: it starts from a single node and can be grown to cover more
- * of the route via its prefix operators.
- */
-class IncrementalSegmentBetween : public Route::SegmentBetween
-{
-    pyvrp::ProblemData const &data_;
-    pyvrp::DurationSegment duration_;
-    std::vector<pyvrp::LoadSegment> loads_;
-
-public:
-    IncrementalSegmentBetween(pyvrp::ProblemData const &data,
-                              Route::Node const *node);
-
-    IncrementalSegmentBetween &operator++();
-
-    inline pyvrp::DurationSegment const &duration(size_t profile) const;
-    inline pyvrp::LoadSegment const &load(size_t dimension) const;
-};
-
-IncrementalSegmentBetween::IncrementalSegmentBetween(
-    pyvrp::ProblemData const &data, Route::Node const *node)
-    : SegmentBetween(*node->route(), node->pos(), node->pos()), data_(data)
-{
-    assert(node->route());
-    duration_ = SegmentBetween::duration(route_.profile());
-
-    loads_.reserve(data_.numLoadDimensions());
-    for (size_t dim = 0; dim != data_.numLoadDimensions(); ++dim)
-        loads_.emplace_back(SegmentBetween::load(dim));
-}
-
-IncrementalSegmentBetween &IncrementalSegmentBetween::operator++()
-{
-    assert(end != route_.size() - 1);
-    auto const from = back().location();  // current last location
-    end++;
-
-    // The segment must consist of a single trip only, possibly including the
-    // depot that begins the next trip (and ends this one). So the difference
-    // in trips is at most one.
-    assert(route_[end]->trip() - route_[start]->trip()
-           <= route_[end]->isDepot());
-
-    auto const at = route_.at(end);
-
-    for (size_t dim = 0; dim != loads_.size(); ++dim)
-        loads_[dim] = pyvrp::LoadSegment::merge(loads_[dim], at.load(dim));
-
-    auto const &mat = data_.durationMatrix(route_.profile());
-    auto const to = at.front().location();
-
-    duration_ = pyvrp::DurationSegment::merge(
-        mat(from, to), duration_, at.duration(route_.profile()));
-
-    return *this;
-}
-
-pyvrp::DurationSegment const &
-IncrementalSegmentBetween::duration([[maybe_unused]] size_t profile) const
-{
-    assert(profile == route_.profile());
-    return duration_;
-}
-
-pyvrp::LoadSegment const &
-IncrementalSegmentBetween::load(size_t dimension) const
-{
-    return loads_[dimension];
-}
-
 Cost insertCost(pyvrp::search::Route::Node *U,
                 pyvrp::search::Route::Node *V,
                 pyvrp::ProblemData const &data,
@@ -128,7 +58,7 @@ bool operator==(pyvrp::Route const &pyvrp, pyvrp::search::Route const &search)
         return false;
 
     size_t idx = 0;
-    for (auto const &activity : pyvrp)
+    for (auto const &activity : pyvrp.activities())
         if (search[idx++]->activity() != activity)
             return false;
 
@@ -181,10 +111,11 @@ void Solution::load(pyvrp::Solution const &solution)
         // the solution.
         route.clear();
 
-        route.reserve(solRoute.size());
-        for (size_t idx = 1; idx != solRoute.size() - 1; ++idx)
+        auto const &activities = solRoute.activities();
+        route.reserve(activities.size());
+        for (size_t idx = 1; idx != activities.size() - 1; ++idx)
         {
-            auto const &activity = solRoute[idx];
+            auto const &activity = activities[idx];
             if (auto *ptr = this->operator[](activity))  // client or shipment
                 route.push_back(ptr);                    // visit
             else
@@ -309,6 +240,27 @@ bool Solution::insert(Route::Node *pickup,
     size_t deliveryPos = 1;
     Cost bestCost = std::numeric_limits<Cost>::max();
 
+    // Tests whether the given proposal improves on the best insertion found so
+    // far, and updates the best cost if it does. The delta cost is evaluated
+    // relative to the best cost, so the evaluation can return early once the
+    // partial delta cost shows that no improvement is possible.
+    auto const improves = [&](auto const &proposal)
+    {
+        if (bestCost == std::numeric_limits<Cost>::max())
+        {
+            bestCost = -shipment.prize;
+            costEvaluator.deltaCost<true>(bestCost, proposal);
+            return true;
+        }
+
+        Cost deltaCost = -shipment.prize - bestCost;
+        if (!costEvaluator.deltaCost(deltaCost, proposal) || deltaCost >= 0)
+            return false;
+
+        bestCost += deltaCost;
+        return true;
+    };
+
     // First we search the shipment's neighbourhood to insert the pickup and
     // delivery in a route that's already in use.
     for (auto const &vActivity : searchSpace.neighboursOf(pickup->activity()))
@@ -322,39 +274,29 @@ bool Solution::insert(Route::Node *pickup,
 
         for (auto *V : {p(neighbour), neighbour})  // before or after neighbour
         {
-            Cost deltaCost = -shipment.prize;
-            costEvaluator.deltaCost<true>(
-                deltaCost,  // delivery directly after pickup
-                Route::Proposal(route->before(V->pos()),
-                                PickupSegment(data_, pickup->idx()),
-                                DeliverySegment(data_, delivery->idx()),
-                                route->after(V->pos() + 1)));
-
-            if (deltaCost < bestCost)
+            if (improves(  // delivery directly after pickup
+                    Route::Proposal(route->before(V->pos()),
+                                    PickupSegment(data_, pickup->idx()),
+                                    DeliverySegment(data_, delivery->idx()),
+                                    route->after(V->pos() + 1))))
             {
                 pickupAfter = V;
                 deliveryPos = V->pos() + 1;
-                bestCost = deltaCost;
             }
 
             IncrementalSegmentBetween between = {data_, n(V)};
             for (auto const *node = n(V); !node->isDepot();
                  node = n(node), ++between)
             {
-                Cost deltaCost = -shipment.prize;
-                costEvaluator.deltaCost<true>(
-                    deltaCost,
-                    Route::Proposal(route->before(V->pos()),
-                                    PickupSegment(data_, pickup->idx()),
-                                    between,
-                                    DeliverySegment(data_, delivery->idx()),
-                                    route->after(node->pos() + 1)));
-
-                if (deltaCost < bestCost)
+                if (improves(
+                        Route::Proposal(route->before(V->pos()),
+                                        PickupSegment(data_, pickup->idx()),
+                                        between,
+                                        DeliverySegment(data_, delivery->idx()),
+                                        route->after(node->pos() + 1))))
                 {
                     pickupAfter = V;
                     deliveryPos = node->pos() + 1;
-                    bestCost = deltaCost;
                 }
             }
         }
@@ -372,19 +314,13 @@ bool Solution::insert(Route::Node *pickup,
         if (empty == end)
             continue;
 
-        Cost deltaCost = -shipment.prize;
-        costEvaluator.deltaCost<true>(
-            deltaCost,
-            Route::Proposal(empty->before(0),
-                            PickupSegment(data_, pickup->idx()),
-                            DeliverySegment(data_, delivery->idx()),
-                            empty->after(1)));
-
-        if (deltaCost < bestCost)
+        if (improves(Route::Proposal(empty->before(0),
+                                     PickupSegment(data_, pickup->idx()),
+                                     DeliverySegment(data_, delivery->idx()),
+                                     empty->after(1))))
         {
             pickupAfter = (*empty)[0];
             deliveryPos = 1;
-            bestCost = deltaCost;
             break;
         }
     }
@@ -400,6 +336,122 @@ bool Solution::insert(Route::Node *pickup,
     return false;
 }
 
+std::vector<Solution::Insertion>
+Solution::insertions(Route::Node *U,
+                     SearchSpace const &searchSpace,
+                     CostEvaluator const &costEvaluator,
+                     RandomNumberGenerator &rng,
+                     double blinkRate)
+{
+    assert(U->isClient() || U->isPickup());
+    assert(!U->route());
+
+    auto const prize = U->isClient() ? data_.client(U->idx()).prize
+                                     : data_.shipment(U->idx()).prize;
+
+    std::vector<Insertion> best;
+    auto const consider = [&](auto const &proposal,
+                              Route::Node *after,
+                              size_t deliveryPos)
+    {
+        if (blinkRate > 0 && rng.rand() < blinkRate)  // blink: skip position
+            return;
+
+        Cost deltaCost = -prize;
+        costEvaluator.deltaCost<true>(deltaCost, proposal);
+
+        for (auto &insertion : best)  // update existing insertion for this
+            if (insertion.after->route() == after->route())  // route..
+            {
+                if (deltaCost < insertion.deltaCost)
+                    insertion = {deltaCost, after, deliveryPos};
+                return;
+            }
+
+        best.push_back({deltaCost, after, deliveryPos});  // .. or add new one
+    };
+
+    for (auto const &vActivity : searchSpace.neighboursOf(U->activity()))
+    {
+        Route::Node *neighbour = this->operator[](vActivity);
+        assert(neighbour);
+
+        auto const *route = neighbour->route();
+        if (!route)
+            continue;
+
+        if (U->isClient())
+        {
+            consider(Route::Proposal(route->before(neighbour->pos()),
+                                     ClientSegment(data_, U->idx()),
+                                     route->after(neighbour->pos() + 1)),
+                     neighbour,
+                     0);
+            continue;
+        }
+
+        for (auto *V : {p(neighbour), neighbour})  // before or after neighbour
+        {
+            consider(Route::Proposal(route->before(V->pos()),
+                                     PickupSegment(data_, U->idx()),
+                                     DeliverySegment(data_, U->idx()),
+                                     route->after(V->pos() + 1)),
+                     V,
+                     V->pos() + 1);
+
+            IncrementalSegmentBetween between = {data_, n(V)};
+            for (auto const *node = n(V); !node->isDepot();
+                 node = n(node), ++between)
+                consider(Route::Proposal(route->before(V->pos()),
+                                         PickupSegment(data_, U->idx()),
+                                         between,
+                                         DeliverySegment(data_, U->idx()),
+                                         route->after(node->pos() + 1)),
+                         V,
+                         node->pos() + 1);
+        }
+    }
+
+    for (auto const &[vehType, offset] : searchSpace.vehTypeOrder())
+    {
+        auto const begin = routes.begin() + offset;
+        auto const end = begin + data_.vehicleType(vehType).numAvailable;
+        auto const pred = [](auto const &route) { return route.empty(); };
+        auto empty = std::find_if(begin, end, pred);
+
+        if (empty == end)
+            continue;
+
+        if (U->isClient())
+            consider(Route::Proposal(empty->before(0),
+                                     ClientSegment(data_, U->idx()),
+                                     empty->after(1)),
+                     (*empty)[0],
+                     0);
+        else
+            consider(Route::Proposal(empty->before(0),
+                                     PickupSegment(data_, U->idx()),
+                                     DeliverySegment(data_, U->idx()),
+                                     empty->after(1)),
+                     (*empty)[0],
+                     1);
+    }
+
+    return best;
+}
+
+void Solution::insert(Route::Node *U, Insertion const &insertion)
+{
+    assert(U->isClient() || U->isPickup());
+    assert(!U->route() && insertion.after->route());
+
+    auto *route = insertion.after->route();
+    if (U->isPickup())  // then we first insert the associated delivery
+        route->insert(insertion.deliveryPos, U + 1);
+
+    route->insert(insertion.after->pos() + 1, U);
+}
+
 std::ostream &operator<<(std::ostream &out, pyvrp::search::Solution const &sol)
 {
     for (size_t idx = 0; idx != sol.routes.size(); ++idx)
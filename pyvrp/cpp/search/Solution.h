@@ -4,6 +4,7 @@
 #include "../Solution.h"  // pyvrp::Solution
 #include "CostEvaluator.h"
 #include "ProblemData.h"
+#include "RandomNumberGenerator.h"
 #include "Route.h"  // pyvrp::search::Route
 #include "SearchSpace.h"
 
@@ -39,6 +40,16 @@ public:
     using Clients = std::vector<Route::Node>;
     using Shipments = std::vector<std::pair<Route::Node, Route::Node>>;
 
+    // Candidate insertion of a client or shipment. The client or pickup is
+    // inserted directly after ``after``. For shipments, the delivery is first
+    // inserted at ``deliveryPos`` in the same route.
+    struct Insertion
+    {
+        Cost deltaCost;
+        Route::Node *after;
+        size_t deliveryPos;
+    };
+
     Clients clients;            // size numClients()
     Shipments shipments;        // size numShipments()
     std::vector<Route> routes;  // size numVehicles(), ordered by type
@@ -70,6 +81,22 @@ public:
                 CostEvaluator const &costEvaluator,
                 bool required);
 
+    // Determines the best insertion of the given client or pickup node into
+    // each route in its neighbourhood, and into the first empty route of each
+    // vehicle type. Each candidate position is skipped with probability
+    // blinkRate. Returns at most one insertion per route, in no particular
+    // order.
+    std::vector<Insertion> insertions(Route::Node *node,
+                                      SearchSpace const &searchSpace,
+                                      CostEvaluator const &costEvaluator,
+                                      RandomNumberGenerator &rng,
+                                      double blinkRate = 0.0);
+
+    // Inserts the given client or pickup node (and its delivery) as described
+    // by the given insertion. Updating the search space and inserted route is
+    // left to the calling code.
+    void insert(Route::Node *node, Insertion const &insertion);
+
     // Maps from an activity to a client or shipment node pointer in this
     // solution. Returns null if the activity is not represented via a
     // solution-level node.
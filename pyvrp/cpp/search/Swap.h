@@ -4,6 +4,8 @@
 #include "LocalSearchOperator.h"
 
 #include <cassert>
+#include <optional>
+#include <variant>
 
 namespace pyvrp::search
 {
@@ -16,8 +18,6 @@ namespace pyvrp::search
  */
 template <size_t N, size_t M> class Swap : public BinaryOperator
 {
-    using BinaryOperator::BinaryOperator;
-
     static_assert(N >= M && M > 0, "N < M or M == 0 does not make sense");
 
     // Tests if the segment starting at node of given length contains the depot.
@@ -38,11 +38,18 @@ public:
                                    Route::Node *V,
                                    CostEvaluator const &costEvaluator) override;
 
+    std::optional<Cost>
+    lowerBound(Route::Node *U,
+               Route::Node *V,
+               CostEvaluator const &costEvaluator) const override;
+
     void apply(Route::Node *U, Route::Node *V) const override;
 
     std::string name() const override;
 
     static bool supports(ProblemData const &data);
+
+    Swap(ProblemData const &data);
 };
 
 template <size_t N, size_t M>
@@ -150,6 +157,53 @@ std::pair<Cost, bool> Swap<N, M>::evaluate(Route::Node *U,
     return std::make_pair(deltaCost, deltaCost < 0);
 }
 
+template <size_t N, size_t M>
+std::optional<Cost>
+Swap<N, M>::lowerBound(Route::Node *U,
+                       Route::Node *V,
+                       CostEvaluator const &costEvaluator) const
+{
+    // Only moves between routes are bounded. Moves within a route often
+    // change few arcs, so they are cheap enough to evaluate directly.
+    if (!U->route() || !V->route() || U->route() == V->route()
+        || hasDepot(U, N) || hasDepot(V, M))
+        return std::nullopt;
+
+    // Each segment replaces the other in its route. The arcs around the
+    // replaced segment are exchanged for arcs to and from the inserted one,
+    // whose own distance is non-negative and thus left out of the bound.
+    auto const bound = [&](Route const &route,
+                           size_t first,
+                           size_t last,
+                           Route const &other,
+                           size_t otherFirst,
+                           size_t otherLast)
+    {
+        auto const pred = route.at(first - 1).front().location();
+        auto const succ = route.at(last + 1).front().location();
+        auto const added = [&](auto const &mat)
+        {
+            return mat(pred, other.at(otherFirst).front().location())
+                   + mat(other.at(otherLast).front().location(), succ);
+        };
+
+        auto const &mat = data.distanceMatrix(route.profile());
+        auto const removed = route.between(first - 1, last + 1);
+        auto const dist = route.distance() - removed.distance(route.profile())
+                          + std::visit(added, mat);
+
+        return distanceBound(route, dist, costEvaluator);
+    };
+
+    auto const uFirst = U->pos();
+    auto const vFirst = V->pos();
+    auto const uLast = uFirst + N - 1;
+    auto const vLast = vFirst + M - 1;
+
+    return bound(*U->route(), uFirst, uLast, *V->route(), vFirst, vLast)
+           + bound(*V->route(), vFirst, vLast, *U->route(), uFirst, uLast);
+}
+
 template <size_t N, size_t M>
 void Swap<N, M>::apply(Route::Node *U, Route::Node *V) const
 {
@@ -191,6 +245,11 @@ template <size_t N, size_t M> bool Swap<N, M>::supports(ProblemData const &data)
 
     return true;
 }
+
+template <size_t N, size_t M>
+Swap<N, M>::Swap(ProblemData const &data) : BinaryOperator(data, true)
+{
+}
 }  // namespace pyvrp::search
 
 #endif  // PYVRP_SEARCH_SWAP_H
@@ -1,4 +1,6 @@
 #include "bindings.h"
+#include "EliminateRoute.h"
+#include "GeneticAlgorithm.h"
 #include "InsertOptionalClient.h"
 #include "InsertOptionalShipment.h"
 #include "LocalSearch.h"
@@ -33,13 +35,18 @@
 namespace py = pybind11;
 
 using pyvrp::search::BinaryOperator;
+using pyvrp::search::EliminateRoute;
+using pyvrp::search::GeneticAlgorithm;
+using pyvrp::search::GeneticAlgorithmParams;
 using pyvrp::search::InsertOptionalClient;
 using pyvrp::search::InsertOptionalShipment;
 using pyvrp::search::LocalSearch;
 using pyvrp::search::NeighbourhoodParams;
+using pyvrp::search::OperatorSelectionParams;
 using pyvrp::search::OperatorStatistics;
 using pyvrp::search::PerturbationManager;
 using pyvrp::search::PerturbationParams;
+using pyvrp::search::RecreateMethod;
 using pyvrp::search::Relocate;
 using pyvrp::search::RelocateAlternative;
 using pyvrp::search::RelocateDelivery;
@@ -53,6 +60,7 @@ using pyvrp::search::ReplaceGroup;
 using pyvrp::search::ReplaceOptionalClient;
 using pyvrp::search::ReplaceOptionalShipment;
 using pyvrp::search::Route;
+using pyvrp::search::RuinMethod;
 using pyvrp::search::SearchSpace;
 using pyvrp::search::Solution;
 using pyvrp::search::Swap;
@@ -69,7 +77,13 @@ PYBIND11_MODULE(_search, m)
     py::class_<OperatorStatistics>(
         m, "OperatorStatistics", DOC(pyvrp, search, OperatorStatistics))
         .def_readonly("num_evaluations", &OperatorStatistics::numEvaluations)
-        .def_readonly("num_applications", &OperatorStatistics::numApplications);
+        .def_readonly("num_applications", &OperatorStatistics::numApplications)
+        .def_readonly("num_shortcuts", &OperatorStatistics::numShortcuts)
+        .def_readonly("num_skips", &OperatorStatistics::numSkips)
+        .def_readonly("improving_delta", &OperatorStatistics::improvingDelta)
+        .def_readonly("evaluate_time", &OperatorStatistics::evaluateTime)
+        .def_readonly("apply_time", &OperatorStatistics::applyTime)
+        .def_readonly("update_time", &OperatorStatistics::updateTime);
 
     py::class_<RelocateDelivery, UnaryOperator>(
         m, "RelocateDelivery", DOC(pyvrp, search, RelocateDelivery))
@@ -105,6 +119,23 @@ PYBIND11_MODULE(_search, m)
         .def("init", &RelocatePickup::init, py::arg("solution"))
         .def_static("supports", &RelocatePickup::supports, py::arg("data"));
 
+    py::class_<EliminateRoute, UnaryOperator>(
+        m, "EliminateRoute", DOC(pyvrp, search, EliminateRoute))
+        .def(py::init<pyvrp::ProblemData const &>(),
+             py::arg("data"),
+             py::keep_alive<1, 2>())  // keep data alive
+        .def_property_readonly("statistics",
+                               &EliminateRoute::statistics,
+                               py::return_value_policy::reference_internal)
+        .def_property_readonly("name", &EliminateRoute::name)
+        .def("evaluate",
+             &EliminateRoute::evaluate,
+             py::arg("U"),
+             py::arg("cost_evaluator"))
+        .def("apply", &EliminateRoute::apply, py::arg("U"))
+        .def("init", &EliminateRoute::init, py::arg("solution"))
+        .def_static("supports", &EliminateRoute::supports, py::arg("data"));
+
     py::class_<RemoveAdjacentDepot, UnaryOperator>(
         m, "RemoveAdjacentDepot", DOC(pyvrp, search, RemoveAdjacentDepot))
         .def(py::init<pyvrp::ProblemData const &>(),
@@ -500,10 +531,24 @@ PYBIND11_MODULE(_search, m)
                       &SearchSpace::neighbours,
                       &SearchSpace::setNeighbours,
                       py::return_value_policy::reference_internal)
+        .def_property("profile_neighbours",
+                      &SearchSpace::profileNeighbours,
+                      &SearchSpace::setProfileNeighbours,
+                      py::return_value_policy::reference_internal)
+        .def("has_profile_neighbours",
+             &SearchSpace::hasProfileNeighbours,
+             DOC(pyvrp, search, SearchSpace, hasProfileNeighbours))
         .def("neighbours_of",
-             &SearchSpace::neighboursOf,
+             py::overload_cast<pyvrp::Activity const &>(
+                 &SearchSpace::neighboursOf, py::const_),
              py::arg("activity"),
-             DOC(pyvrp, search, SearchSpace, neighboursOf))
+             DOC(pyvrp, search, SearchSpace, neighboursOf, 1))
+        .def("neighbours_of",
+             py::overload_cast<pyvrp::Activity const &, size_t>(
+                 &SearchSpace::neighboursOf, py::const_),
+             py::arg("activity"),
+             py::arg("profile"),
+             DOC(pyvrp, search, SearchSpace, neighboursOf, 2))
         .def("is_promising",
              &SearchSpace::isPromising,
              py::arg("activity"),
@@ -535,15 +580,40 @@ PYBIND11_MODULE(_search, m)
              py::arg("rng"),
              DOC(pyvrp, search, SearchSpace, shuffle));
 
+    py::enum_<RuinMethod>(m, "RuinMethod", DOC(pyvrp, search, RuinMethod))
+        .value("NEIGHBOURHOOD", RuinMethod::NEIGHBOURHOOD)
+        .value("STRINGS", RuinMethod::STRINGS)
+        .value("WORST", RuinMethod::WORST);
+
+    py::enum_<RecreateMethod>(
+        m, "RecreateMethod", DOC(pyvrp, search, RecreateMethod))
+        .value("GREEDY", RecreateMethod::GREEDY)
+        .value("BLINK", RecreateMethod::BLINK)
+        .value("REGRET", RecreateMethod::REGRET);
+
     py::class_<PerturbationParams>(
         m, "PerturbationParams", DOC(pyvrp, search, PerturbationParams))
-        .def(py::init<size_t, size_t>(),
+        .def(py::init<size_t,
+                      size_t,
+                      RuinMethod,
+                      RecreateMethod,
+                      size_t,
+                      double>(),
              py::arg("min_perturbations") = 1,
-             py::arg("max_perturbations") = 25)
+             py::arg("max_perturbations") = 25,
+             py::arg("ruin_method") = RuinMethod::NEIGHBOURHOOD,
+             py::arg("recreate_method") = RecreateMethod::GREEDY,
+             py::arg("max_string_length") = 10,
+             py::arg("blink_rate") = 0.01)
         .def_readonly("min_perturbations",
                       &PerturbationParams::minPerturbations)
         .def_readonly("max_perturbations",
                       &PerturbationParams::maxPerturbations)
+        .def_readonly("ruin_method", &PerturbationParams::ruinMethod)
+        .def_readonly("recreate_method", &PerturbationParams::recreateMethod)
+        .def_readonly("max_string_length",
+                      &PerturbationParams::maxStringLength)
+        .def_readonly("blink_rate", &PerturbationParams::blinkRate)
         .def(py::self == py::self, py::arg("other"));  // this is __eq__
 
     py::class_<PerturbationManager>(
@@ -565,25 +635,46 @@ PYBIND11_MODULE(_search, m)
              py::call_guard<py::gil_scoped_release>(),
              DOC(pyvrp, search, PerturbationManager, perturb));
 
+    py::class_<OperatorSelectionParams>(
+        m,
+        "OperatorSelectionParams",
+        DOC(pyvrp, search, OperatorSelectionParams))
+        .def(py::init<bool, double, double>(),
+             py::arg("adaptive") = false,
+             py::arg("decay") = 0.8,
+             py::arg("min_probability") = 0.1)
+        .def_readonly("adaptive", &OperatorSelectionParams::adaptive)
+        .def_readonly("decay", &OperatorSelectionParams::decay)
+        .def_readonly("min_probability",
+                      &OperatorSelectionParams::minProbability)
+        .def(py::self == py::self, py::arg("other"));  // this is __eq__
+
     py::class_<LocalSearch::Statistics>(
         m, "LocalSearchStatistics", DOC(pyvrp, search, LocalSearch, Statistics))
         .def_readonly("num_moves", &LocalSearch::Statistics::numMoves)
         .def_readonly("num_improving", &LocalSearch::Statistics::numImproving)
-        .def_readonly("num_updates", &LocalSearch::Statistics::numUpdates);
+        .def_readonly("num_updates", &LocalSearch::Statistics::numUpdates)
+        .def_readonly("operators", &LocalSearch::Statistics::operators);
 
     py::class_<LocalSearch>(m, "LocalSearch")
         .def(py::init<pyvrp::ProblemData const &,
                       SearchSpace::Neighbours,
-                      PerturbationManager &>(),
+                      PerturbationManager &,
+                      OperatorSelectionParams>(),
              py::arg("data"),
              py::arg("neighbours"),
              py::arg("perturbation_manager") = PerturbationManager(),
+             py::arg("selection_params") = OperatorSelectionParams(),
              py::keep_alive<1, 2>(),  // keep data alive until LS is freed
              py::keep_alive<1, 4>())  // also keep perturbation_manager alive
         .def_property("neighbours",
                       &LocalSearch::neighbours,
                       &LocalSearch::setNeighbours,
                       py::return_value_policy::reference_internal)
+        .def_property("profile_neighbours",
+                      &LocalSearch::profileNeighbours,
+                      &LocalSearch::setProfileNeighbours,
+                      py::return_value_policy::reference_internal)
         .def_property_readonly("statistics", &LocalSearch::statistics)
         .def_property_readonly("unary_operators",
                                &LocalSearch::unaryOperators,
@@ -600,13 +691,70 @@ PYBIND11_MODULE(_search, m)
              py::arg("op"),
              py::keep_alive<1, 2>())
         .def("__call__",
-             &LocalSearch::operator(),
+             py::overload_cast<pyvrp::Solution const &,
+                               pyvrp::CostEvaluator const &,
+                               bool>(&LocalSearch::operator()),
              py::arg("solution"),
              py::arg("cost_evaluator"),
              py::arg("exhaustive") = false,
              py::call_guard<py::gil_scoped_release>())
+        .def("search_around",
+             py::overload_cast<pyvrp::Solution const &,
+                               pyvrp::CostEvaluator const &,
+                               std::vector<pyvrp::Activity> const &>(
+                 &LocalSearch::operator()),
+             py::arg("solution"),
+             py::arg("cost_evaluator"),
+             py::arg("activities"),
+             py::call_guard<py::gil_scoped_release>())
         .def("shuffle", &LocalSearch::shuffle, py::arg("rng"));
 
+    py::class_<GeneticAlgorithmParams>(
+        m,
+        "GeneticAlgorithmParams",
+        DOC(pyvrp, search, GeneticAlgorithmParams))
+        .def(py::init<size_t, size_t, size_t, size_t, size_t>(),
+             py::arg("min_pop_size") = 25,
+             py::arg("generation_size") = 40,
+             py::arg("num_elite") = 4,
+             py::arg("num_close") = 5,
+             py::arg("num_threads") = 1)
+        .def_readonly("min_pop_size", &GeneticAlgorithmParams::minPopSize)
+        .def_readonly("generation_size",
+                      &GeneticAlgorithmParams::generationSize)
+        .def_readonly("num_elite", &GeneticAlgorithmParams::numElite)
+        .def_readonly("num_close", &GeneticAlgorithmParams::numClose)
+        .def_readonly("num_threads", &GeneticAlgorithmParams::numThreads)
+        .def(py::self == py::self, py::arg("other"));  // this is __eq__
+
+    py::class_<GeneticAlgorithm>(
+        m, "GeneticAlgorithm", DOC(pyvrp, search, GeneticAlgorithm))
+        .def(py::init<pyvrp::ProblemData const &,
+                      std::vector<LocalSearch *>,
+                      GeneticAlgorithmParams>(),
+             py::arg("data"),
+             py::arg("searches"),
+             py::arg("params") = GeneticAlgorithmParams(),
+             py::keep_alive<1, 2>(),  // keep data alive
+             py::keep_alive<1, 3>())  // and the local searches
+        .def("add",
+             &GeneticAlgorithm::add,
+             py::arg("solution"),
+             py::arg("cost_evaluator"),
+             DOC(pyvrp, search, GeneticAlgorithm, add))
+        .def("step",
+             &GeneticAlgorithm::step,
+             py::arg("cost_evaluator"),
+             py::arg("rng"),
+             py::call_guard<py::gil_scoped_release>(),
+             DOC(pyvrp, search, GeneticAlgorithm, step))
+        .def("num_feasible",
+             &GeneticAlgorithm::numFeasible,
+             DOC(pyvrp, search, GeneticAlgorithm, numFeasible))
+        .def("num_infeasible",
+             &GeneticAlgorithm::numInfeasible,
+             DOC(pyvrp, search, GeneticAlgorithm, numInfeasible));
+
     py::class_<Solution>(m, "Solution", DOC(pyvrp, search, Solution))
         .def(py::init<pyvrp::ProblemData const &>(),
              py::arg("data"),
@@ -716,6 +864,7 @@ PYBIND11_MODULE(_search, m)
         .def("duration", &Route::duration)
         .def("overtime", &Route::overtime)
         .def("duration_cost", &Route::durationCost)
+        .def("lateness_cost", &Route::latenessCost)
         .def("unit_duration_cost", &Route::unitDurationCost)
         .def("unit_overtime_cost", &Route::unitOvertimeCost)
         .def("has_duration_cost", &Route::hasDurationCost)
@@ -844,18 +993,47 @@ PYBIND11_MODULE(_search, m)
 
     py::class_<NeighbourhoodParams>(
         m, "NeighbourhoodParams", DOC(pyvrp, search, NeighbourhoodParams))
-        .def(py::init<double, size_t, bool>(),
+        .def(py::init<double, size_t, bool, bool, double>(),
              py::arg("weight_wait_time") = 0.2,
              py::arg("num_neighbours") = 50,
-             py::arg("symmetric_proximity") = true)
+             py::arg("symmetric_proximity") = true,
+             py::arg("per_profile") = false,
+             py::arg("spatial_oversampling") = 0.0)
         .def(py::self == py::self, py::arg("other"))  // this is __eq__
         .def_readonly("weight_wait_time", &NeighbourhoodParams::weightWaitTime)
         .def_readonly("num_neighbours", &NeighbourhoodParams::numNeighbours)
         .def_readonly("symmetric_proximity",
-                      &NeighbourhoodParams::symmetricProximity);
+                      &NeighbourhoodParams::symmetricProximity)
+        .def_readonly("per_profile", &NeighbourhoodParams::perProfile)
+        .def_readonly("spatial_oversampling",
+                      &NeighbourhoodParams::spatialOversampling);
 
     m.def("compute_neighbours",
           &pyvrp::search::computeNeighbours,
           py::arg("data"),
-          py::arg("params"));
+          py::arg("params"),
+          py::arg("profile") = py::none());
+
+    m.def("update_neighbours",
+          &pyvrp::search::updateNeighbours,
+          py::arg("data"),
+          py::arg("neighbours"),
+          py::arg("changed"),
+          py::arg("removed"),
+          py::arg("params"),
+          py::arg("profile") = py::none());
+
+    m.def("broken_pairs_distance",
+          &pyvrp::search::brokenPairsDistance,
+          py::arg("data"),
+          py::arg("first"),
+          py::arg("second"));
+
+    m.def("srex",
+          &pyvrp::search::srex,
+          py::arg("first"),
+          py::arg("second"),
+          py::arg("data"),
+          py::arg("cost_evaluator"),
+          py::arg("rng"));
 }
@@ -1,24 +1,50 @@
 #include "neighbourhood.h"
 
-#include "Matrix.h"
-
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <numeric>
 #include <set>
 #include <stdexcept>
 #include <tuple>
+#include <variant>
 
 using pyvrp::Activity;
-using pyvrp::Matrix;
 using pyvrp::ProblemData;
+using pyvrp::ProfileMatrix;
 using pyvrp::search::NeighbourhoodParams;
 
 namespace
 {
+// Proximity-relevant data of a client, pickup, or delivery activity.
+struct ActivityData
+{
+    size_t location;
+    double serviceDuration;
+    double twEarly;
+    double twLate;
+};
+
+// Distinct combination of unit distance and duration costs, and the routing
+// profile's distance and duration matrices.
+struct CostProfile
+{
+    double unitDistanceCost;
+    double unitDurationCost;
+    ProfileMatrix<pyvrp::Distance> const &distances;
+    ProfileMatrix<pyvrp::Duration> const &durations;
+};
+
 /**
  * Computes proximity for neighbourhood. Proximity is based on [1]_, but
- * generalised to additional VRP variants.
+ * generalised to additional VRP variants. If a profile is given, only vehicle
+ * types of that profile contribute to proximity.
+ *
+ * Rows (from) are #clients + #pickups. Columns (to) are #clients + #pickups +
+ * #deliveries. Proximity between an activity and itself, and between a pickup
+ * and its own delivery, is infinite. Proximity between members of the same
+ * client group is the largest finite value: we want to avoid same group
+ * neighbours, but it is not too problematic if we need to have them.
  *
  * References
  * ----------
@@ -27,251 +53,738 @@ namespace
  *        large class of vehicle routing problems with time-windows.
  *        *Computers & Operations Research*, 40(1), 475 - 489.
  */
-Matrix<double> computeProximity(ProblemData const &data,
-                                NeighbourhoodParams const &params)
+class Proximity
+{
+    ProblemData const &data_;
+    NeighbourhoodParams const &params_;
+    std::vector<ActivityData> activities_;  // clients, pickups, deliveries
+    std::vector<CostProfile> profiles_;
+
+    template <typename Distances, typename Durations>
+    double arcCost(CostProfile const &profile,
+                   Distances const &distances,
+                   Durations const &durations,
+                   ActivityData const &from,
+                   ActivityData const &to) const;
+
+public:
+    Proximity(ProblemData const &data,
+              NeighbourhoodParams const &params,
+              std::optional<size_t> profile);
+
+    size_t numRows() const;
+
+    size_t numCols() const;
+
+    ActivityData const &activity(size_t col) const;
+
+    // Proximity between the given row and each of the given columns. If
+    // proximity is symmetric, we evaluate arcs in both directions, and take
+    // the best of the two. We take the best over all cost profiles. Matrix
+    // storage is resolved once per cost profile, not for every arc.
+    void operator()(size_t row,
+                    std::vector<size_t> const &cols,
+                    std::vector<double> &values) const;
+};
+
+Proximity::Proximity(ProblemData const &data,
+                     NeighbourhoodParams const &params,
+                     std::optional<size_t> profile)
+    : data_(data), params_(params)
 {
-    // Rows (from) are #clients + #pickups. Columns (to) are #clients
-    // + #pickups + #deliveries.
-    Matrix<double> prox(data.numClients() + data.numShipments(),
-                        data.numClients() + 2 * data.numShipments(),
-                        std::numeric_limits<double>::max());
+    activities_.reserve(data.numClients() + 2 * data.numShipments());
+
+    auto const add = [&](auto const &activity)
+    {
+        activities_.push_back({activity.location,
+                               static_cast<double>(activity.serviceDuration),
+                               static_cast<double>(activity.twEarly),
+                               static_cast<double>(activity.twLate)});
+    };
+
+    for (auto const &client : data.clients())
+        add(client);
+
+    for (auto const &shipment : data.shipments())
+        add(shipment.pickup);
+
+    for (auto const &shipment : data.shipments())
+        add(shipment.delivery);
 
     std::set<std::tuple<pyvrp::Cost, pyvrp::Cost, size_t>> seen = {};
     for (auto const &vehType : data.vehicleTypes())
     {
+        if (profile && vehType.profile != *profile)
+            continue;
+
         auto const key = std::make_tuple(vehType.unitDistanceCost,
                                          vehType.unitDurationCost,
                                          vehType.profile);
 
-        if (seen.contains(key))  // then proximity has already been updated
-            continue;            // based on this cost profile
+        if (seen.contains(key))  // then proximity already accounts for this
+            continue;            // cost profile
 
         seen.insert(key);
-        auto const &dists = data.distanceMatrix(vehType.profile);
-        auto const &durs = data.durationMatrix(vehType.profile);
+        profiles_.push_back({static_cast<double>(vehType.unitDistanceCost),
+                             static_cast<double>(vehType.unitDurationCost),
+                             data.distanceMatrix(vehType.profile),
+                             data.durationMatrix(vehType.profile)});
+    }
+}
 
-        auto const arcCost = [&](auto const &from, auto const &to)
-        {
-            auto const frmServ = static_cast<double>(from.serviceDuration);
-            auto const frmEarly = static_cast<double>(from.twEarly);
-            auto const frmLate = static_cast<double>(from.twLate);
+template <typename Distances, typename Durations>
+double Proximity::arcCost(CostProfile const &profile,
+                          Distances const &distances,
+                          Durations const &durations,
+                          ActivityData const &from,
+                          ActivityData const &to) const
+{
+    auto const dur = durations(from.location, to.location);
+    auto const edgeDur = static_cast<double>(dur);
 
-            auto const toEarly = static_cast<double>(to.twEarly);
-            auto const toLate = static_cast<double>(to.twLate);
+    if (from.twEarly + from.serviceDuration + edgeDur > to.twLate)  // then
+        return std::numeric_limits<double>::max();  // edge is not feasible
 
-            auto const dur = durs(from.location, to.location);
-            auto const edgeDur = static_cast<double>(dur);
+    auto const dist = distances(from.location, to.location);
+    auto const distance = static_cast<double>(dist);
 
-            if (frmEarly + frmServ + edgeDur > toLate)      // then this edge
-                return std::numeric_limits<double>::max();  // is not feasible
+    auto const minWait = to.twEarly - edgeDur - from.serviceDuration
+                         - from.twLate;
+    auto const duration = edgeDur + std::max(minWait, 0.0);
 
-            auto const dist = dists(from.location, to.location);
-            auto const distance = static_cast<double>(dist);
+    return profile.unitDistanceCost * distance
+           + profile.unitDurationCost * duration
+           + params_.weightWaitTime * std::max(minWait, 0.0);
+}
 
-            auto const minWait = toEarly - edgeDur - frmServ - frmLate;
-            auto const duration = edgeDur + std::max(minWait, 0.0);
+size_t Proximity::numRows() const
+{
+    return data_.numClients() + data_.numShipments();
+}
 
-            return static_cast<double>(vehType.unitDistanceCost) * distance
-                   + static_cast<double>(vehType.unitDurationCost) * duration
-                   + params.weightWaitTime * std::max(minWait, 0.0);
-        };
+size_t Proximity::numCols() const { return activities_.size(); }
 
-        // Proximity between two activities. If proximity is symmetric, we
-        // evaluate the arc in both directions, and take the best of the two.
-        auto const cost = [&](auto const &from, auto const &to)
-        {
-            auto value = arcCost(from, to);
-            if (params.symmetricProximity)
-                value = std::min(value, arcCost(to, from));
+ActivityData const &Proximity::activity(size_t col) const
+{
+    return activities_[col];
+}
 
-            return value;
-        };
+void Proximity::operator()(size_t row,
+                           std::vector<size_t> const &cols,
+                           std::vector<double> &values) const
+{
+    auto const numClients = data_.numClients();
+    auto const numShipments = data_.numShipments();
 
-        // From clients.
-        for (size_t frm = 0; frm != data.numClients(); ++frm)
+    values.assign(cols.size(), std::numeric_limits<double>::max());
+    for (auto const &profile : profiles_)
+    {
+        auto const update = [&](auto const &dists, auto const &durs)
         {
-            auto const &frmData = data.client(frm);
-
-            // To clients.
-            for (size_t client = 0; client != data.numClients(); ++client)
+            auto const cost = [&](auto const &from, auto const &to)
             {
-                auto const idx = client;
-                auto const &to = data.client(client);
-                prox(frm, idx) = std::min(cost(frmData, to), prox(frm, idx));
-            }
+                auto value = arcCost(profile, dists, durs, from, to);
+                if (params_.symmetricProximity)
+                    value = std::min(value,
+                                     arcCost(profile, dists, durs, to, from));
 
-            // To shipment pickups.
-            for (size_t pick = 0; pick != data.numShipments(); ++pick)
-            {
-                auto const idx = data.numClients() + pick;
-                auto const &to = data.shipment(pick).pickup;
-                prox(frm, idx) = std::min(cost(frmData, to), prox(frm, idx));
-            }
+                return value;
+            };
 
-            // To shipment deliveries.
-            for (size_t del = 0; del != data.numShipments(); ++del)
+            for (size_t idx = 0; idx != cols.size(); ++idx)
             {
-                auto const idx = data.numClients() + data.numShipments() + del;
-                auto const &to = data.shipment(del).delivery;
-                prox(frm, idx) = std::min(cost(frmData, to), prox(frm, idx));
+                auto const &to = activities_[cols[idx]];
+                auto value = cost(activities_[row], to);
+
+                // If row is a shipment pickup, its neighbourhood considers
+                // proximity cost from both the pickup and delivery steps to
+                // other activities.
+                if (row >= numClients)
+                    value = std::min(value,
+                                     cost(activities_[row + numShipments], to));
+
+                values[idx] = std::min(values[idx], value);
             }
+        };
+
+        std::visit(update, profile.distances, profile.durations);
+    }
+
+    for (size_t idx = 0; idx != cols.size(); ++idx)
+    {
+        auto const col = cols[idx];
+        auto const isOwnDelivery = row >= numClients
+                                   && col == row + numShipments;
+
+        if (row == col || isOwnDelivery)  // excl. self and own delivery
+            values[idx] = std::numeric_limits<double>::infinity();
+        else if (row < numClients && col < numClients)
+        {
+            // Group members should not neighbour each other, as only one of
+            // them can be in the solution at a time.
+            auto const &frmGroup = data_.client(row).group;
+            auto const &toGroup = data_.client(col).group;
+            if (frmGroup && frmGroup == toGroup)
+                values[idx] = std::numeric_limits<double>::max();
         }
+    }
+}
+
+/**
+ * Simple uniform grid over two-dimensional points, used to quickly find the
+ * points nearest to a given query point.
+ */
+class SpatialGrid
+{
+    std::vector<std::pair<double, double>> points_;
+
+    double minX_ = 0;
+    double minY_ = 0;
+    double cellSize_ = 1;
+    size_t numX_ = 1;
+    size_t numY_ = 1;
+
+    // Points are stored per cell, in compressed form: the points in cell c are
+    // cellPoints_[cellStart_[c]], ..., cellPoints_[cellStart_[c + 1] - 1].
+    std::vector<size_t> cellStart_;
+    std::vector<size_t> cellPoints_;
+
+    size_t cellX(double x) const;
+    size_t cellY(double y) const;
+
+public:
+    explicit SpatialGrid(std::vector<std::pair<double, double>> points);
+
+    /**
+     * Returns the indices of the (at most) k points nearest to the given
+     * query point, in no particular order.
+     */
+    std::vector<size_t> nearest(double x, double y, size_t k) const;
+};
+
+SpatialGrid::SpatialGrid(std::vector<std::pair<double, double>> points)
+    : points_(std::move(points))
+{
+    if (!points_.empty())
+    {
+        auto maxX = points_[0].first;
+        auto maxY = points_[0].second;
+        minX_ = maxX;
+        minY_ = maxY;
 
-        // From shipment pickups. Their neighbourhood considers proximity cost
-        // from both pickup and delivery steps to other activities.
-        for (size_t frm = data.numClients(); frm != prox.numRows(); ++frm)
+        for (auto const &[x, y] : points_)
         {
-            auto const &shipment = data.shipment(frm - data.numClients());
+            minX_ = std::min(minX_, x);
+            minY_ = std::min(minY_, y);
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+        }
 
-            // To clients.
-            for (size_t client = 0; client != data.numClients(); ++client)
-            {
-                auto const idx = client;
-                auto const &to = data.client(client);
-                prox(frm, idx) = std::min({cost(shipment.pickup, to),
-                                           cost(shipment.delivery, to),
-                                           prox(frm, idx)});
-            }
+        // We aim for a few points per cell, on average.
+        auto const extent = std::max(maxX - minX_, maxY - minY_);
+        auto const perAxis = std::ceil(std::sqrt(points_.size() / 2.0));
+        cellSize_ = extent > 0 ? extent / perAxis : 1.0;
 
-            // To shipment pickups.
-            for (size_t pick = 0; pick != data.numShipments(); ++pick)
-            {
-                auto const idx = data.numClients() + pick;
-                auto const &to = data.shipment(pick).pickup;
-                prox(frm, idx) = std::min({cost(shipment.pickup, to),
-                                           cost(shipment.delivery, to),
-                                           prox(frm, idx)});
-            }
+        numX_ = static_cast<size_t>((maxX - minX_) / cellSize_) + 1;
+        numY_ = static_cast<size_t>((maxY - minY_) / cellSize_) + 1;
+    }
+
+    std::vector<size_t> cellOf(points_.size());
+    cellStart_.resize(numX_ * numY_ + 1, 0);
+    for (size_t idx = 0; idx != points_.size(); ++idx)
+    {
+        auto const &[x, y] = points_[idx];
+        cellOf[idx] = cellY(y) * numX_ + cellX(x);
+        cellStart_[cellOf[idx] + 1]++;
+    }
+
+    std::partial_sum(cellStart_.begin(), cellStart_.end(), cellStart_.begin());
+
+    auto fill = cellStart_;
+    cellPoints_.resize(points_.size());
+    for (size_t idx = 0; idx != points_.size(); ++idx)
+        cellPoints_[fill[cellOf[idx]]++] = idx;
+}
+
+size_t SpatialGrid::cellX(double x) const
+{
+    auto const cell = std::max((x - minX_) / cellSize_, 0.0);
+    return std::min(static_cast<size_t>(cell), numX_ - 1);
+}
+
+size_t SpatialGrid::cellY(double y) const
+{
+    auto const cell = std::max((y - minY_) / cellSize_, 0.0);
+    return std::min(static_cast<size_t>(cell), numY_ - 1);
+}
+
+std::vector<size_t> SpatialGrid::nearest(double x, double y, size_t k) const
+{
+    k = std::min(k, points_.size());
+    if (k == 0)
+        return {};
+
+    auto const cx = static_cast<std::ptrdiff_t>(cellX(x));
+    auto const cy = static_cast<std::ptrdiff_t>(cellY(y));
+    auto const numX = static_cast<std::ptrdiff_t>(numX_);
+    auto const numY = static_cast<std::ptrdiff_t>(numY_);
+    auto const maxRing = std::max(numX, numY);
+
+    std::vector<std::pair<double, size_t>> found;  // (squared distance, idx)
+    for (std::ptrdiff_t ring = 0; ring <= maxRing; ++ring)
+    {
+        // Scan all cells at Chebyshev distance ring from the query's cell.
+        for (auto i = cx - ring; i <= cx + ring; ++i)
+        {
+            if (i < 0 || i >= numX)
+                continue;
 
-            // To shipment deliveries.
-            for (size_t del = 0; del != data.numShipments(); ++del)
+            for (auto j = cy - ring; j <= cy + ring; ++j)
             {
-                auto const idx = data.numClients() + data.numShipments() + del;
-                auto const &to = data.shipment(del).delivery;
-                prox(frm, idx) = std::min({cost(shipment.pickup, to),
-                                           cost(shipment.delivery, to),
-                                           prox(frm, idx)});
+                if (j < 0 || j >= numY)
+                    continue;
+
+                if (std::abs(i - cx) != ring && std::abs(j - cy) != ring)
+                    continue;  // interior cell, so already scanned
+
+                auto const cell = j * numX + i;
+                for (auto pos = cellStart_[cell]; pos != cellStart_[cell + 1];
+                     ++pos)
+                {
+                    auto const idx = cellPoints_[pos];
+                    auto const dx = points_[idx].first - x;
+                    auto const dy = points_[idx].second - y;
+                    found.emplace_back(dx * dx + dy * dy, idx);
+                }
             }
         }
+
+        if (found.size() < k)
+            continue;
+
+        // Any point in cells beyond the current ring is at least ring * cell
+        // size away. If the k-th nearest point is closer than that, we are
+        // done.
+        auto const kth = found.begin() + (k - 1);
+        std::nth_element(found.begin(), kth, found.end());
+        auto const bound = static_cast<double>(ring) * cellSize_;
+        if (std::sqrt(kth->first) <= bound)
+            break;
     }
 
-    return prox;
+    auto const kth = found.begin() + (k - 1);
+    std::nth_element(found.begin(), kth, found.end());
+
+    std::vector<size_t> indices;
+    indices.reserve(k);
+    for (auto it = found.begin(); it != found.begin() + k; ++it)
+        indices.push_back(it->second);
+
+    return indices;
+}
+
+// Turns a proximity column index into the corresponding activity.
+Activity toActivity(ProblemData const &data, size_t col)
+{
+    if (col < data.numClients())
+        return {Activity::ActivityType::CLIENT, col};
+
+    if (col < data.numClients() + data.numShipments())
+        return {Activity::ActivityType::PICKUP, col - data.numClients()};
+
+    return {Activity::ActivityType::DELIVERY,
+            col - data.numClients() - data.numShipments()};
+}
+
+// Turns a proximity row index into the corresponding activity.
+Activity rowActivity(ProblemData const &data, size_t row)
+{
+    if (row < data.numClients())
+        return {Activity::ActivityType::CLIENT, row};
+
+    return {Activity::ActivityType::PICKUP, row - data.numClients()};
+}
+
+// Turns a client, pickup, or delivery activity into the corresponding
+// proximity column index. For clients and pickups, this is also the row index.
+size_t toColumn(ProblemData const &data, Activity const &activity)
+{
+    if (activity.isClient())
+        return activity.idx();
+
+    if (activity.isPickup())
+        return data.numClients() + activity.idx();
+
+    return data.numClients() + data.numShipments() + activity.idx();
+}
+
+// Number of neighbours in each neighbourhood. This is the minimum of the
+// number of other clients and shipments, and the given neighbourhood size. We
+// need to make sure we do not wrap-around in case there are no clients or
+// shipments. Since we have both pickup and delivery nodes for shipments, we
+// count those double.
+size_t neighbourhoodSize(ProblemData const &data,
+                         NeighbourhoodParams const &params)
+{
+    auto const numClients = std::max<size_t>(data.numClients(), 1) - 1;
+    auto const numShipments = std::max<size_t>(2 * data.numShipments(), 2) - 2;
+    auto const maxNeighbours = numClients + numShipments;
+    return std::min(params.numNeighbours, maxNeighbours);
+}
+
+// Returns the given number of columns nearest to the given row, among the
+// given candidate columns. Neighbours are ordered by increasing proximity, and
+// ties are broken by column index.
+std::vector<Activity> nearest(ProblemData const &data,
+                              Proximity const &proximity,
+                              size_t row,
+                              std::vector<size_t> const &candidates,
+                              size_t numNeighbours)
+{
+    std::vector<double> values;
+    proximity(row, candidates, values);
+
+    std::vector<std::pair<double, size_t>> ranked;
+    ranked.reserve(candidates.size());
+    for (size_t idx = 0; idx != candidates.size(); ++idx)
+        ranked.emplace_back(values[idx], candidates[idx]);
+
+    auto const size = std::min(numNeighbours, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + size, ranked.end());
+
+    std::vector<Activity> neighbourhood;
+    neighbourhood.reserve(size);
+    for (size_t neighbour = 0; neighbour != size; ++neighbour)
+        neighbourhood.push_back(toActivity(data, ranked[neighbour].second));
+
+    return neighbourhood;
+}
+
+/**
+ * Maps activities of an earlier version of the data to the current version,
+ * given the clients and shipments that were removed in between.
+ */
+class Remapping
+{
+    std::vector<size_t> clients_;    // sorted indices of removed clients
+    std::vector<size_t> shipments_;  // sorted indices of removed shipments
+
+public:
+    explicit Remapping(std::vector<Activity> const &removed);
+
+    // Returns the activity in the current data, or nothing if the activity
+    // was removed.
+    std::optional<Activity> operator()(Activity const &activity) const;
+};
+
+Remapping::Remapping(std::vector<Activity> const &removed)
+{
+    for (auto const &activity : removed)
+    {
+        if (activity.isDepot())
+            throw std::invalid_argument("Cannot remove depot activities.");
+
+        auto &indices = activity.isClient() ? clients_ : shipments_;
+        indices.push_back(activity.idx());
+    }
+
+    for (auto *indices : {&clients_, &shipments_})
+    {
+        std::sort(indices->begin(), indices->end());
+        auto const last = std::unique(indices->begin(), indices->end());
+        indices->erase(last, indices->end());
+    }
+}
+
+std::optional<Activity> Remapping::operator()(Activity const &activity) const
+{
+    auto const &indices = activity.isClient() ? clients_ : shipments_;
+    auto const idx = activity.idx();
+    auto const it = std::lower_bound(indices.begin(), indices.end(), idx);
+
+    if (it != indices.end() && *it == idx)  // activity was removed
+        return std::nullopt;
+
+    auto const shift = static_cast<size_t>(std::distance(indices.begin(), it));
+    return Activity(activity.type(), idx - shift);
+}
+
+// Computes the neighbourhood from the full proximity matrix.
+std::unordered_map<Activity, std::vector<Activity>>
+denseNeighbours(ProblemData const &data,
+                Proximity const &proximity,
+                size_t numNeighbours)
+{
+    std::vector<size_t> allCols(proximity.numCols());
+    std::iota(allCols.begin(), allCols.end(), 0);
+
+    std::unordered_map<Activity, std::vector<Activity>> neighbours;
+
+    std::vector<double> prox;
+    std::vector<size_t> indices(proximity.numCols());
+    for (size_t row = 0; row != proximity.numRows(); ++row)
+    {
+        proximity(row, allCols, prox);
+        auto const comp = [&](auto const a, auto const b)
+        { return prox[a] < prox[b]; };
+
+        // Reset the vector and then re-sort for this activity.
+        std::iota(indices.begin(), indices.end(), 0);
+        std::stable_sort(indices.begin(), indices.end(), comp);
+
+        // Neighbourhood is set to the first numNeighbours indices.
+        auto &neighbourhood = neighbours[rowActivity(data, row)];
+        for (size_t neighbour = 0; neighbour != numNeighbours; ++neighbour)
+            neighbourhood.push_back(toActivity(data, indices[neighbour]));
+    }
+
+    return neighbours;
+}
+
+// Computes the neighbourhood by first determining a set of candidate
+// neighbours based on (Euclidean) distances between location coordinates, and
+// then ranking those candidates by proximity. This avoids computing the full
+// proximity matrix.
+std::unordered_map<Activity, std::vector<Activity>>
+spatialNeighbours(ProblemData const &data,
+                  Proximity const &proximity,
+                  size_t numNeighbours,
+                  double oversampling)
+{
+    auto const coords = [&](size_t col)
+    {
+        auto const &location = data.location(proximity.activity(col).location);
+        return std::make_pair(location.x.get(), location.y.get());
+    };
+
+    std::vector<std::pair<double, double>> points;
+    points.reserve(proximity.numCols());
+    for (size_t col = 0; col != proximity.numCols(); ++col)
+        points.push_back(coords(col));
+
+    SpatialGrid const grid(std::move(points));
+
+    // Number of candidates to consider. Two more than strictly needed since
+    // the candidates may include the activity itself, and its own delivery.
+    auto const numCandidates = static_cast<size_t>(
+        std::ceil(oversampling * static_cast<double>(numNeighbours)) + 2);
+
+    std::unordered_map<Activity, std::vector<Activity>> neighbours;
+
+    std::vector<size_t> candidates;
+    std::vector<double> values;
+    std::vector<std::pair<double, size_t>> ranked;
+    for (size_t row = 0; row != proximity.numRows(); ++row)
+    {
+        auto const [x, y] = coords(row);
+        candidates = grid.nearest(x, y, numCandidates);
+
+        if (row >= data.numClients())  // then this is a pickup, and we also
+        {                               // consider candidates near delivery.
+            auto const [dx, dy] = coords(row + data.numShipments());
+            auto const other = grid.nearest(dx, dy, numCandidates);
+            candidates.insert(candidates.end(), other.begin(), other.end());
+        }
+
+        std::sort(candidates.begin(), candidates.end());
+        auto const last = std::unique(candidates.begin(), candidates.end());
+        candidates.erase(last, candidates.end());
+
+        proximity(row, candidates, values);
+
+        ranked.clear();
+        for (size_t idx = 0; idx != candidates.size(); ++idx)
+            if (values[idx] != std::numeric_limits<double>::infinity())
+                ranked.emplace_back(values[idx], candidates[idx]);
+
+        // Candidates are sorted by index, so this is a stable sort that breaks
+        // ties by index, just like the dense neighbourhood computation.
+        std::sort(ranked.begin(), ranked.end());
+
+        auto &neighbourhood = neighbours[rowActivity(data, row)];
+        auto const size = std::min(numNeighbours, ranked.size());
+        for (size_t neighbour = 0; neighbour != size; ++neighbour)
+            neighbourhood.push_back(toActivity(data, ranked[neighbour].second));
+    }
+
+    return neighbours;
 }
 }  // namespace
 
 NeighbourhoodParams::NeighbourhoodParams(double weightWaitTime,
                                          size_t numNeighbours,
-                                         bool symmetricProximity)
+                                         bool symmetricProximity,
+                                         bool perProfile,
+                                         double spatialOversampling)
     : weightWaitTime(weightWaitTime),
       numNeighbours(numNeighbours),
-      symmetricProximity(symmetricProximity)
+      symmetricProximity(symmetricProximity),
+      perProfile(perProfile),
+      spatialOversampling(spatialOversampling)
 {
     if (numNeighbours == 0)
         throw std::invalid_argument("num_neighbours == 0 not understood.");
+
+    if (spatialOversampling != 0 && spatialOversampling < 1)
+        throw std::invalid_argument("spatial_oversampling must be 0 or >= 1.");
 }
 
 std::unordered_map<Activity, std::vector<Activity>>
 pyvrp::search::computeNeighbours(ProblemData const &data,
-                                 NeighbourhoodParams const &params)
+                                 NeighbourhoodParams const &params,
+                                 std::optional<size_t> profile)
 {
-    auto prox = computeProximity(data, params);
-
-    for (auto const &group : data.groups())
-        for (auto const frmClient : group)
-            for (auto const toClient : group)
-                // Group members should not neighbour each other, as only one
-                // of them can be in the solution at a time. We use max float,
-                // not infty: we want to avoid same group neighbours, but it is
-                // not too problematic if we need to have them.
-                prox(frmClient, toClient) = std::numeric_limits<double>::max();
-
-    for (size_t idx = 0; idx != prox.numRows(); ++idx)  // excl. self
-        prox(idx, idx) = std::numeric_limits<double>::infinity();
-
-    for (size_t idx = data.numClients(); idx != prox.numRows(); ++idx)
-        prox(idx, idx + data.numShipments())  // excl. own delivery
-            = std::numeric_limits<double>::infinity();
-
-    // Adjust the neighbourhood size to the minimum of the number of other
-    // clients and shipments, and the default neighbourhood size. We need to
-    // make sure we do not wrap-around in case the there are no clients or
-    // shipments. Since we have both pickup and delivery nodes for shipments,
-    // we count those double.
-    auto const numClients = std::max<size_t>(data.numClients(), 1) - 1;
-    auto const numShipments = std::max<size_t>(2 * data.numShipments(), 2) - 2;
-    auto const maxNeighbours = numClients + numShipments;
-    auto const numNeighbours = std::min(params.numNeighbours, maxNeighbours);
+    if (profile && *profile >= data.numProfiles())
+        throw std::out_of_range("Profile does not exist.");
 
-    std::unordered_map<Activity, std::vector<Activity>> neighbours;
+    Proximity const proximity(data, params, profile);
+    auto const numNeighbours = neighbourhoodSize(data, params);
 
-    std::vector<size_t> indices(prox.numCols());
-    for (size_t idx = 0; idx != data.numClients(); ++idx)
+    if (params.spatialOversampling > 0)
+        return spatialNeighbours(
+            data, proximity, numNeighbours, params.spatialOversampling);
+
+    return denseNeighbours(data, proximity, numNeighbours);
+}
+
+std::unordered_map<Activity, std::vector<Activity>>
+pyvrp::search::updateNeighbours(
+    ProblemData const &data,
+    std::unordered_map<Activity, std::vector<Activity>> const &neighbours,
+    std::vector<Activity> const &changed,
+    std::vector<Activity> const &removed,
+    NeighbourhoodParams const &params,
+    std::optional<size_t> profile)
+{
+    if (profile && *profile >= data.numProfiles())
+        throw std::out_of_range("Profile does not exist.");
+
+    // When the instance is small, the neighbourhood size depends on the number
+    // of clients and shipments, which may have changed. Recomputing is cheap
+    // for such small instances anyway.
+    auto const numNeighbours = neighbourhoodSize(data, params);
+    if (numNeighbours != params.numNeighbours)
+        return computeNeighbours(data, params, profile);
+
+    Proximity const proximity(data, params, profile);
+    Remapping const remap(removed);
+
+    std::vector<bool> isChanged(proximity.numCols(), false);
+    std::vector<size_t> changedCols;
+    auto const markChanged = [&](size_t col)
     {
-        Activity const activity = {Activity::ActivityType::CLIENT, idx};
+        if (!isChanged[col])
+        {
+            isChanged[col] = true;
+            changedCols.push_back(col);
+        }
+    };
 
-        auto const comp = [&](auto const a, auto const b)
-        { return prox(idx, a) < prox(idx, b); };
+    for (auto const &activity : changed)
+    {
+        if (activity.isDepot())
+            throw std::invalid_argument("Cannot change depot activities.");
 
-        // Reset the vector and then re-sort for this client.
-        std::iota(indices.begin(), indices.end(), 0);
-        std::stable_sort(indices.begin(), indices.end(), comp);
+        auto const numActivities
+            = activity.isClient() ? data.numClients() : data.numShipments();
+        if (activity.idx() >= numActivities)
+            throw std::out_of_range("Changed activity does not exist.");
 
-        // Neighbourhood of client is set to the first numNeighbours indices.
-        neighbours[activity] = {};
-        for (size_t neighbour = 0; neighbour != numNeighbours; ++neighbour)
+        if (activity.isClient())
+            markChanged(activity.idx());
+        else  // the pickup and delivery are both new candidates
         {
-            auto &neighbourhood = neighbours[activity];
-
-            if (indices[neighbour] < data.numClients())
-                neighbourhood.emplace_back(Activity::ActivityType::CLIENT,
-                                           indices[neighbour]);
-            else if (indices[neighbour]
-                     < data.numClients() + data.numShipments())
-                neighbourhood.emplace_back(Activity::ActivityType::PICKUP,
-                                           indices[neighbour]
-                                               - data.numClients());
-            else
-                neighbourhood.emplace_back(Activity::ActivityType::DELIVERY,
-                                           indices[neighbour]
-                                               - data.numClients()
-                                               - data.numShipments());
+            auto const pickup = data.numClients() + activity.idx();
+            markChanged(pickup);
+            markChanged(pickup + data.numShipments());
         }
     }
 
-    for (size_t idx = 0; idx != data.numShipments(); ++idx)
+    // Returns the row of the given activity of the earlier data in the new
+    // data, if it (still) has one.
+    auto const toRow = [&](Activity const &activity) -> std::optional<size_t>
     {
-        Activity const activity = {Activity::ActivityType::PICKUP, idx};
+        auto const key = remap(activity);
+        if (!key || key->isDepot() || key->isDelivery())
+            return std::nullopt;
+
+        auto const row = toColumn(data, *key);
+        if (row >= proximity.numRows())
+            return std::nullopt;
+
+        return row;
+    };
+
+    // Clients and shipments without a neighbourhood are new, and thus also
+    // changed.
+    std::vector<bool> hasNeighbours(proximity.numRows(), false);
+    for (auto const &[activity, _] : neighbours)
+        if (auto const row = toRow(activity))
+            hasNeighbours[*row] = true;
+
+    for (size_t row = 0; row != proximity.numRows(); ++row)
+        if (!hasNeighbours[row])
+        {
+            markChanged(row);
+            if (row >= data.numClients())  // pickup, so also mark delivery
+                markChanged(row + data.numShipments());
+        }
 
-        auto const comp = [&](auto const a, auto const b) {
-            return prox(data.numClients() + idx, a)
-                   < prox(data.numClients() + idx, b);
-        };
+    // Existing neighbourhoods, as columns in the new data. An existing
+    // neighbourhood is only kept when all its neighbours still exist and are
+    // unchanged. Otherwise, the neighbourhood must be recomputed in full.
+    std::vector<std::optional<std::vector<size_t>>> existing(
+        proximity.numRows());
 
-        // Reset the vector and then re-sort for this pickup.
-        std::iota(indices.begin(), indices.end(), 0);
-        std::stable_sort(indices.begin(), indices.end(), comp);
+    for (auto const &[activity, activityNeighbours] : neighbours)
+    {
+        auto const row = toRow(activity);
+        if (!row || isChanged[*row]
+            || activityNeighbours.size() != numNeighbours)
+            continue;
+
+        std::vector<size_t> cols;
+        cols.reserve(numNeighbours + changedCols.size());
+        for (auto const &neighbour : activityNeighbours)
+        {
+            auto const mapped = remap(neighbour);
+            if (!mapped || mapped->isDepot())
+                break;
 
-        // Neighbourhood of pickup is set to the first numNeighbours indices.
-        neighbours[activity] = {};
-        for (size_t neighbour = 0; neighbour != numNeighbours; ++neighbour)
+            auto const col = toColumn(data, *mapped);
+            if (col >= proximity.numCols() || isChanged[col])
+                break;
+
+            cols.push_back(col);
+        }
+
+        if (cols.size() == numNeighbours)
+            existing[*row] = std::move(cols);
+    }
+
+    std::vector<size_t> allCols(proximity.numCols());
+    std::iota(allCols.begin(), allCols.end(), 0);
+
+    std::unordered_map<Activity, std::vector<Activity>> updated;
+    for (size_t row = 0; row != proximity.numRows(); ++row)
+    {
+        auto const activity = rowActivity(data, row);
+        if (!existing[row])  // then we recompute the full neighbourhood
         {
-            auto &neighbourhood = neighbours[activity];
-
-            if (indices[neighbour] < data.numClients())
-                neighbourhood.emplace_back(Activity::ActivityType::CLIENT,
-                                           indices[neighbour]);
-            else if (indices[neighbour]
-                     < data.numClients() + data.numShipments())
-                neighbourhood.emplace_back(Activity::ActivityType::PICKUP,
-                                           indices[neighbour]
-                                               - data.numClients());
-            else
-                neighbourhood.emplace_back(Activity::ActivityType::DELIVERY,
-                                           indices[neighbour]
-                                               - data.numClients()
-                                               - data.numShipments());
+            updated[activity]
+                = nearest(data, proximity, row, allCols, numNeighbours);
+            continue;
         }
+
+        // The existing neighbourhood contains the nearest unchanged
+        // activities, so we only need to additionally consider the changed
+        // activities as candidates.
+        auto &candidates = *existing[row];
+        candidates.insert(
+            candidates.end(), changedCols.begin(), changedCols.end());
+        updated[activity]
+            = nearest(data, proximity, row, candidates, numNeighbours);
     }
 
-    return neighbours;
+    return updated;
 }
@@ -4,6 +4,7 @@
 #include "Activity.h"
 #include "ProblemData.h"
 
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -14,6 +15,8 @@ namespace pyvrp::search
  *    weight_wait_time: float = 0.2,
  *    num_neighbours: int = 50,
  *    symmetric_proximity: bool = True,
+ *    per_profile: bool = False,
+ *    spatial_oversampling: float = 0.0,
  * )
  *
  * Configuration for calculating a granular neighbourhood.
@@ -30,30 +33,99 @@ namespace pyvrp::search
  * symmetric_proximity
  *     Whether to calculate a symmetric proximity matrix. This ensures edge
  *     :math:`(i, j)` is given the same weight as :math:`(j, i)`.
+ * per_profile
+ *     Whether to additionally compute a separate neighbourhood for each
+ *     routing profile. This is useful for heterogeneous fleets whose vehicle
+ *     types use different profiles, since activities that are close for one
+ *     profile need not be close for another. Has no effect on instances with
+ *     a single profile.
+ * spatial_oversampling
+ *     When positive, neighbourhoods are computed from a spatial index over
+ *     the location coordinates, rather than from the full proximity matrix.
+ *     For each activity, ``spatial_oversampling * num_neighbours`` nearest
+ *     activities by coordinate distance are considered as candidates, which
+ *     are then ranked by proximity. This avoids the quadratic cost of the
+ *     full proximity computation, and is useful for very large instances
+ *     where coordinates reflect travel costs reasonably well. Default 0,
+ *     which computes the full proximity matrix.
  *
  * Raises
  * ------
  * ValueError
- *     When ``num_neighbours`` is not strictly positive.
+ *     When ``num_neighbours`` is not strictly positive, or when
+ *     ``spatial_oversampling`` is positive but smaller than one.
  */
 struct NeighbourhoodParams
 {
     double const weightWaitTime;
     size_t const numNeighbours;
     bool const symmetricProximity;
+    bool const perProfile;
+    double const spatialOversampling;
 
     NeighbourhoodParams(double weightWaitTime = 0.2,
                         size_t numNeighbours = 50,
-                        bool symmetricProximity = true);
+                        bool symmetricProximity = true,
+                        bool perProfile = false,
+                        double spatialOversampling = 0.0);
 
     bool operator==(NeighbourhoodParams const &other) const = default;
 };
 
 /**
- * Computes neighbours defining the neighbourhood for a problem instance.
+ * Computes neighbours defining the neighbourhood for a problem instance. If a
+ * profile is given, only vehicle types using that routing profile are used to
+ * determine proximity. Otherwise all vehicle types are considered.
+ *
+ * Raises
+ * ------
+ * IndexError
+ *     When the given profile does not exist.
+ */
+std::unordered_map<Activity, std::vector<Activity>>
+computeNeighbours(ProblemData const &data,
+                  NeighbourhoodParams const &params,
+                  std::optional<size_t> profile = std::nullopt);
+
+/**
+ * Updates a neighbourhood after a few clients or shipments were added,
+ * removed, or modified, without recomputing the full neighbourhood. Only the
+ * neighbourhoods of changed activities, and of activities whose neighbourhood
+ * contained changed or removed activities, are recomputed in full. All other
+ * neighbourhoods are patched by considering just the changed activities as
+ * new candidate neighbours. The result is the same as that of
+ * :func:`computeNeighbours` on the new data, except that recomputed
+ * neighbourhoods use the full proximity computation also when spatial
+ * oversampling is enabled.
+ *
+ * The given neighbourhood must have been computed for an earlier version of
+ * the data, using the same parameters and profile. The activities in
+ * ``changed`` index the new data, and should include all clients and
+ * shipments that were added or modified. Clients and pickups that do not
+ * have a neighbourhood yet are always considered changed. The activities in
+ * ``removed`` index the earlier version of the data: the clients and
+ * shipments after a removed one are assumed to have shifted down in the new
+ * data. Changes to vehicle types, or to the travel distances and durations
+ * between unchanged activities, are not detected: the full neighbourhood
+ * should be recomputed in that case.
+ *
+ * Raises
+ * ------
+ * IndexError
+ *     When the given profile does not exist, or a changed activity does not
+ *     exist in the new data.
+ * ValueError
+ *     When a changed or removed activity is not a client or shipment
+ *     activity.
  */
 std::unordered_map<Activity, std::vector<Activity>>
-computeNeighbours(ProblemData const &data, NeighbourhoodParams const &params);
+updateNeighbours(ProblemData const &data,
+                 std::unordered_map<Activity, std::vector<Activity>> const
+                     &neighbours,
+                 std::vector<Activity> const &changed,
+                 std::vector<Activity> const &removed,
+                 NeighbourhoodParams const &params,
+                 std::optional<size_t> profile = std::nullopt);
 }  // namespace pyvrp::search
 
 #endif  // PYVRP_SEARCH_NEIGHBOURHOOD_H
@@ -0,0 +1,19 @@
+#include "FirstFeasible.h"
+
+#include <limits>
+
+using pyvrp::stop::FirstFeasible;
+
+bool FirstFeasible::operator()(Cost bestCost)
+{
+    // This function is called with the output of CostEvaluator::cost on the
+    // best solution, which is the maximum cost value when the best solution
+    // is infeasible. Thus, when the cost is below that value, we have at
+    // least one feasible solution and we can terminate.
+    return bestCost < std::numeric_limits<Cost>::max();
+}
+
+std::unique_ptr<pyvrp::stop::StoppingCriterion> FirstFeasible::clone() const
+{
+    return std::make_unique<FirstFeasible>(*this);
+}
@@ -0,0 +1,22 @@
+#ifndef PYVRP_STOP_FIRSTFEASIBLE_H
+#define PYVRP_STOP_FIRSTFEASIBLE_H
+
+#include "StoppingCriterion.h"
+
+namespace pyvrp::stop
+{
+/**
+ * FirstFeasible()
+ *
+ * Terminates the search after a feasible solution has been observed.
+ */
+class FirstFeasible : public StoppingCriterion
+{
+public:
+    bool operator()(Cost bestCost) override;
+
+    std::unique_ptr<StoppingCriterion> clone() const override;
+};
+}  // namespace pyvrp::stop
+
+#endif  // PYVRP_STOP_FIRSTFEASIBLE_H
@@ -0,0 +1,21 @@
+#include "MaxIterations.h"
+
+#include <stdexcept>
+
+using pyvrp::stop::MaxIterations;
+
+MaxIterations::MaxIterations(int64_t maxIterations) : maxIters_(maxIterations)
+{
+    if (maxIterations < 0)
+        throw std::invalid_argument("max_iterations < 0 not understood.");
+}
+
+bool MaxIterations::operator()([[maybe_unused]] Cost bestCost)
+{
+    return ++currIter_ > maxIters_;
+}
+
+std::unique_ptr<pyvrp::stop::StoppingCriterion> MaxIterations::clone() const
+{
+    return std::make_unique<MaxIterations>(*this);
+}
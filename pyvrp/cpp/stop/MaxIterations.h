@@ -0,0 +1,41 @@
+#ifndef PYVRP_STOP_MAXITERATIONS_H
+#define PYVRP_STOP_MAXITERATIONS_H
+
+#include "StoppingCriterion.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace pyvrp::stop
+{
+/**
+ * MaxIterations(max_iterations: float)
+ *
+ * Criterion that stops after a maximum number of iterations.
+ *
+ * Parameters
+ * ----------
+ * max_iterations
+ *     The maximum number of iterations. May be infinite, in which case this
+ *     criterion never stops.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When ``max_iterations`` is negative.
+ */
+class MaxIterations : public StoppingCriterion
+{
+    size_t maxIters_;
+    size_t currIter_ = 0;
+
+public:
+    MaxIterations(int64_t maxIterations);
+
+    bool operator()(Cost bestCost) override;
+
+    std::unique_ptr<StoppingCriterion> clone() const override;
+};
+}  // namespace pyvrp::stop
+
+#endif  // PYVRP_STOP_MAXITERATIONS_H
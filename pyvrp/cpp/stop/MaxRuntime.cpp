@@ -0,0 +1,36 @@
+#include "MaxRuntime.h"
+
+#include <stdexcept>
+
+using pyvrp::stop::MaxRuntime;
+
+MaxRuntime::MaxRuntime(double maxRuntime, int64_t checkInterval)
+    : maxRuntime_(maxRuntime), checkInterval_(checkInterval)
+{
+    if (maxRuntime < 0)
+        throw std::invalid_argument("max_runtime < 0 not understood.");
+
+    if (checkInterval <= 0)
+        throw std::invalid_argument("check_interval must be positive.");
+}
+
+bool MaxRuntime::operator()([[maybe_unused]] Cost bestCost)
+{
+    if (stop_)  // the clock only moves forward, so we remain stopped
+        return true;
+
+    if (numCalls_++ % checkInterval_ != 0)
+        return false;
+
+    auto const now = Clock::now();
+    if (!start_)
+        start_ = now;
+
+    stop_ = now - *start_ > maxRuntime_;
+    return stop_;
+}
+
+std::unique_ptr<pyvrp::stop::StoppingCriterion> MaxRuntime::clone() const
+{
+    return std::make_unique<MaxRuntime>(*this);
+}
@@ -0,0 +1,56 @@
+#ifndef PYVRP_STOP_MAXRUNTIME_H
+#define PYVRP_STOP_MAXRUNTIME_H
+
+#include "StoppingCriterion.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace pyvrp::stop
+{
+/**
+ * MaxRuntime(max_runtime: float, check_interval: int = 1)
+ *
+ * Criterion that stops after a specified maximum runtime (in seconds). The
+ * runtime is measured from the first time this criterion is called.
+ *
+ * Parameters
+ * ----------
+ * max_runtime
+ *     Maximum runtime, in seconds.
+ * check_interval
+ *     The clock is only read every ``check_interval`` calls. Reading the
+ *     clock is relatively expensive compared to very short iterations, so
+ *     larger values reduce overhead at the cost of stopping up to
+ *     ``check_interval - 1`` iterations late. Default 1, which reads the
+ *     clock on every call.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When ``max_runtime`` is negative, or ``check_interval`` is not
+ *     positive.
+ */
+class MaxRuntime : public StoppingCriterion
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::chrono::duration<double> maxRuntime_;
+    size_t checkInterval_;
+
+    std::optional<Clock::time_point> start_;
+    size_t numCalls_ = 0;
+    bool stop_ = false;
+
+public:
+    MaxRuntime(double maxRuntime, int64_t checkInterval = 1);
+
+    bool operator()(Cost bestCost) override;
+
+    std::unique_ptr<StoppingCriterion> clone() const override;
+};
+}  // namespace pyvrp::stop
+
+#endif  // PYVRP_STOP_MAXRUNTIME_H
@@ -0,0 +1,52 @@
+#include "MultipleCriteria.h"
+
+#include <stdexcept>
+
+using pyvrp::stop::MultipleCriteria;
+using pyvrp::stop::StoppingCriterion;
+
+MultipleCriteria::MultipleCriteria(
+    std::vector<std::shared_ptr<StoppingCriterion>> criteria, bool requireAll)
+    : criteria_(std::move(criteria)), requireAll_(requireAll)
+{
+    if (criteria_.empty())
+        throw std::invalid_argument("Expected one or more stopping criteria.");
+}
+
+bool MultipleCriteria::operator()(Cost bestCost)
+{
+    if (!requireAll_)
+    {
+        for (auto &criterion : criteria_)
+            if ((*criterion)(bestCost))
+                return true;
+
+        return false;
+    }
+
+    bool stop = true;
+    for (auto &criterion : criteria_)
+        stop &= (*criterion)(bestCost);
+
+    return stop;
+}
+
+std::unique_ptr<StoppingCriterion> MultipleCriteria::clone() const
+{
+    // Cloning copies the combined criteria as well, so that the clone does
+    // not share any state with this criterion.
+    std::vector<std::shared_ptr<StoppingCriterion>> criteria;
+    criteria.reserve(criteria_.size());
+    for (auto const &criterion : criteria_)
+        criteria.push_back(criterion->clone());
+
+    return std::make_unique<MultipleCriteria>(std::move(criteria), requireAll_);
+}
+
+std::vector<std::shared_ptr<StoppingCriterion>> const &
+MultipleCriteria::criteria() const
+{
+    return criteria_;
+}
+
+bool MultipleCriteria::requireAll() const { return requireAll_; }
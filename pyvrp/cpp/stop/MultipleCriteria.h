@@ -0,0 +1,62 @@
+#ifndef PYVRP_STOP_MULTIPLECRITERIA_H
+#define PYVRP_STOP_MULTIPLECRITERIA_H
+
+#include "StoppingCriterion.h"
+
+#include <memory>
+#include <vector>
+
+namespace pyvrp::stop
+{
+/**
+ * MultipleCriteria(
+ *     criteria: list[StoppingCriterion],
+ *     require_all: bool = False,
+ * )
+ *
+ * Aggregate criterion that manages multiple stopping criteria at once.
+ *
+ * Parameters
+ * ----------
+ * criteria
+ *     Stopping criteria to combine. These may be native or Python-defined
+ *     stopping criteria. The criteria are shared, not copied. They are
+ *     available, and may be replaced, via the ``criteria`` attribute.
+ * require_all
+ *     When ``False`` (default), stops as soon as any of the criteria stops.
+ *     The criteria are then evaluated in order, and evaluation stops at the
+ *     first criterion that stops. When ``True``, stops only when all criteria
+ *     stop. All criteria are then evaluated on each call, so that stateful
+ *     criteria observe every iteration.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When no criteria are given.
+ */
+class MultipleCriteria : public StoppingCriterion
+{
+    std::vector<std::shared_ptr<StoppingCriterion>> criteria_;
+    bool requireAll_;
+
+public:
+    MultipleCriteria(std::vector<std::shared_ptr<StoppingCriterion>> criteria,
+                     bool requireAll = false);
+
+    bool operator()(Cost bestCost) override;
+
+    std::unique_ptr<StoppingCriterion> clone() const override;
+
+    /**
+     * Returns the combined stopping criteria.
+     */
+    std::vector<std::shared_ptr<StoppingCriterion>> const &criteria() const;
+
+    /**
+     * Returns whether all criteria must stop before this criterion stops.
+     */
+    bool requireAll() const;
+};
+}  // namespace pyvrp::stop
+
+#endif  // PYVRP_STOP_MULTIPLECRITERIA_H
@@ -0,0 +1,29 @@
+#include "NoImprovement.h"
+
+#include <stdexcept>
+
+using pyvrp::stop::NoImprovement;
+
+NoImprovement::NoImprovement(int64_t maxIterations) : maxIters_(maxIterations)
+{
+    if (maxIterations < 0)
+        throw std::invalid_argument("max_iterations < 0 not understood.");
+}
+
+bool NoImprovement::operator()(Cost bestCost)
+{
+    if (!target_ || bestCost < *target_)
+    {
+        target_ = bestCost;
+        counter_ = 0;
+    }
+    else
+        counter_++;
+
+    return counter_ >= maxIters_;
+}
+
+std::unique_ptr<pyvrp::stop::StoppingCriterion> NoImprovement::clone() const
+{
+    return std::make_unique<NoImprovement>(*this);
+}
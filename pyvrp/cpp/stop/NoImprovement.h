@@ -0,0 +1,44 @@
+#ifndef PYVRP_STOP_NOIMPROVEMENT_H
+#define PYVRP_STOP_NOIMPROVEMENT_H
+
+#include "StoppingCriterion.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace pyvrp::stop
+{
+/**
+ * NoImprovement(max_iterations: float)
+ *
+ * Criterion that stops if the best solution has not been improved for a fixed
+ * number of iterations.
+ *
+ * Parameters
+ * ----------
+ * max_iterations
+ *     The maximum number of non-improving iterations. May be infinite, in
+ *     which case this criterion never stops.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When ``max_iterations`` is negative.
+ */
+class NoImprovement : public StoppingCriterion
+{
+    size_t maxIters_;
+    std::optional<Cost> target_;
+    size_t counter_ = 0;
+
+public:
+    NoImprovement(int64_t maxIterations);
+
+    bool operator()(Cost bestCost) override;
+
+    std::unique_ptr<StoppingCriterion> clone() const override;
+};
+}  // namespace pyvrp::stop
+
+#endif  // PYVRP_STOP_NOIMPROVEMENT_H
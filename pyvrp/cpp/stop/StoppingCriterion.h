@@ -0,0 +1,36 @@
+#ifndef PYVRP_STOP_STOPPINGCRITERION_H
+#define PYVRP_STOP_STOPPINGCRITERION_H
+
+#include "Measure.h"
+
+#include <memory>
+
+namespace pyvrp::stop
+{
+/**
+ * Base class for native stopping criteria. Native criteria are evaluated
+ * without returning to Python, which makes them cheap to check from native
+ * search loops. They can be combined using ``|`` (stop when either criterion
+ * stops) and ``&`` (stop when both criteria stop). Python-defined stopping
+ * criteria may be combined with native criteria in the same way.
+ */
+class StoppingCriterion
+{
+public:
+    virtual ~StoppingCriterion() = default;
+
+    /**
+     * Returns whether the search should stop, given the cost of the current
+     * best solution.
+     */
+    virtual bool operator()(Cost bestCost) = 0;
+
+    /**
+     * Returns an independent copy of this stopping criterion, including its
+     * current state.
+     */
+    virtual std::unique_ptr<StoppingCriterion> clone() const = 0;
+};
+}  // namespace pyvrp::stop
+
+#endif  // PYVRP_STOP_STOPPINGCRITERION_H
@@ -0,0 +1,214 @@
+#include "bindings.h"
+#include "FirstFeasible.h"
+#include "MaxIterations.h"
+#include "MaxRuntime.h"
+#include "MultipleCriteria.h"
+#include "NoImprovement.h"
+#include "StoppingCriterion.h"
+#include "stop_docs.h"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace py = pybind11;
+
+using pyvrp::stop::FirstFeasible;
+using pyvrp::stop::MaxIterations;
+using pyvrp::stop::MaxRuntime;
+using pyvrp::stop::MultipleCriteria;
+using pyvrp::stop::NoImprovement;
+using pyvrp::stop::StoppingCriterion;
+
+namespace
+{
+// Fallback adapter that wraps a Python-defined stopping criterion, so it can
+// be combined with native criteria. Calling it returns to Python.
+class PythonCriterion : public StoppingCriterion
+{
+    py::object criterion_;
+
+public:
+    explicit PythonCriterion(py::object criterion)
+        : criterion_(std::move(criterion))
+    {
+    }
+
+    ~PythonCriterion() override
+    {
+        py::gil_scoped_acquire gil;
+        criterion_ = py::object();
+    }
+
+    bool operator()(pyvrp::Cost bestCost) override
+    {
+        py::gil_scoped_acquire gil;
+        return criterion_(bestCost).cast<bool>();
+    }
+
+    py::object const &criterion() const { return criterion_; }
+
+    std::unique_ptr<StoppingCriterion> clone() const override
+    {
+        py::gil_scoped_acquire gil;
+        auto const deepcopy = py::module_::import("copy").attr("deepcopy");
+        return std::make_unique<PythonCriterion>(deepcopy(criterion_));
+    }
+};
+
+// Returns the given object as a native stopping criterion, wrapping it in an
+// adapter if it is a Python-defined criterion.
+std::shared_ptr<StoppingCriterion> toNative(py::object const &criterion)
+{
+    if (py::isinstance<StoppingCriterion>(criterion))
+        return criterion.cast<std::shared_ptr<StoppingCriterion>>();
+
+    if (!PyCallable_Check(criterion.ptr()))
+        throw py::type_error("Stopping criterion must be callable.");
+
+    return std::make_shared<PythonCriterion>(criterion);
+}
+
+// Returns the given objects as native stopping criteria.
+std::vector<std::shared_ptr<StoppingCriterion>>
+toNative(std::vector<py::object> const &criteria)
+{
+    std::vector<std::shared_ptr<StoppingCriterion>> native;
+    native.reserve(criteria.size());
+    for (auto const &criterion : criteria)
+        native.push_back(toNative(criterion));
+
+    return native;
+}
+
+// Returns the given native stopping criterion as a Python object. Adapters
+// return the Python-defined criterion they wrap.
+py::object toPython(std::shared_ptr<StoppingCriterion> const &criterion)
+{
+    if (auto const *adapter = dynamic_cast<PythonCriterion *>(criterion.get()))
+        return adapter->criterion();
+
+    return py::cast(criterion);
+}
+
+// Returns the given iteration limit as an integer. Infinite limits are never
+// reached, so these are treated as the largest representable limit. Finite
+// fractional limits are rounded in the direction of the given function, which
+// gives the same stopping behaviour as comparing against the limit directly.
+template <typename Round> int64_t toLimit(double maxIterations, Round round)
+{
+    if (std::isnan(maxIterations))
+        throw py::value_error("max_iterations must not be NaN.");
+
+    if (maxIterations < 0)
+        throw py::value_error("max_iterations < 0 not understood.");
+
+    auto constexpr max = std::numeric_limits<int64_t>::max();
+    if (maxIterations >= static_cast<double>(max))  // includes infinity
+        return max;
+
+    return static_cast<int64_t>(round(maxIterations));
+}
+
+std::shared_ptr<MultipleCriteria>
+combine(py::object const &lhs, py::object const &rhs, bool requireAll)
+{
+    std::vector<std::shared_ptr<StoppingCriterion>> criteria
+        = {toNative(lhs), toNative(rhs)};
+
+    return std::make_shared<MultipleCriteria>(criteria, requireAll);
+}
+}  // namespace
+
+PYBIND11_MODULE(_stop, m)
+{
+    py::class_<StoppingCriterion, std::shared_ptr<StoppingCriterion>>(
+        m, "StoppingCriterion", DOC(pyvrp, stop, StoppingCriterion))
+        .def("__call__",
+             &StoppingCriterion::operator(),
+             py::arg("best_cost"),
+             DOC(pyvrp, stop, StoppingCriterion, __call__))
+        .def("__or__",
+             [](py::object self, py::object other)
+             { return combine(self, other, false); })
+        .def("__and__",
+             [](py::object self, py::object other)
+             { return combine(self, other, true); })
+        .def("__copy__",
+             [](StoppingCriterion const &criterion)
+             { return std::shared_ptr<StoppingCriterion>(criterion.clone()); })
+        .def(
+            "__deepcopy__",
+            [](StoppingCriterion const &criterion, py::dict)
+            { return std::shared_ptr<StoppingCriterion>(criterion.clone()); },
+            py::arg("memo"));
+
+    py::class_<FirstFeasible,
+               StoppingCriterion,
+               std::shared_ptr<FirstFeasible>>(
+        m, "FirstFeasible", DOC(pyvrp, stop, FirstFeasible))
+        .def(py::init<>());
+
+    py::class_<MaxIterations,
+               StoppingCriterion,
+               std::shared_ptr<MaxIterations>>(
+        m, "MaxIterations", DOC(pyvrp, stop, MaxIterations))
+        .def(py::init<int64_t>(), py::arg("max_iterations"))
+        .def(py::init(
+                 [](double maxIterations)
+                 {
+                     auto const floor = [](double x) { return std::floor(x); };
+                     return MaxIterations(toLimit(maxIterations, floor));
+                 }),
+             py::arg("max_iterations"));
+
+    py::class_<MaxRuntime, StoppingCriterion, std::shared_ptr<MaxRuntime>>(
+        m, "MaxRuntime", DOC(pyvrp, stop, MaxRuntime))
+        .def(py::init<double, int64_t>(),
+             py::arg("max_runtime"),
+             py::arg("check_interval") = 1);
+
+    py::class_<NoImprovement,
+               StoppingCriterion,
+               std::shared_ptr<NoImprovement>>(
+        m, "NoImprovement", DOC(pyvrp, stop, NoImprovement))
+        .def(py::init<int64_t>(), py::arg("max_iterations"))
+        .def(py::init(
+                 [](double maxIterations)
+                 {
+                     auto const ceil = [](double x) { return std::ceil(x); };
+                     return NoImprovement(toLimit(maxIterations, ceil));
+                 }),
+             py::arg("max_iterations"));
+
+    py::class_<MultipleCriteria,
+               StoppingCriterion,
+               std::shared_ptr<MultipleCriteria>>(
+        m, "MultipleCriteria", DOC(pyvrp, stop, MultipleCriteria))
+        .def(py::init(
+                 [](std::vector<py::object> const &criteria, bool requireAll)
+                 { return MultipleCriteria(toNative(criteria), requireAll); }),
+             py::arg("criteria"),
+             py::arg("require_all") = false)
+        .def_property(
+            "criteria",
+            [](MultipleCriteria const &criteria)
+            {
+                py::list result;
+                for (auto const &criterion : criteria.criteria())
+                    result.append(toPython(criterion));
+
+                return result;
+            },
+            [](MultipleCriteria &criteria,
+               std::vector<py::object> const &newCriteria)
+            {
+                auto const requireAll = criteria.requireAll();
+                criteria = MultipleCriteria(toNative(newCriteria), requireAll);
+            })
+        .def_property_readonly("require_all", &MultipleCriteria::requireAll);
+}
@@ -0,0 +1,401 @@
+from __future__ import annotations
+
+import math
+import time
+from collections import Counter
+from concurrent.futures import ThreadPoolExecutor
+from dataclasses import dataclass
+from typing import TYPE_CHECKING
+
+import numpy as np
+
+from pyvrp.PenaltyManager import PenaltyManager
+from pyvrp.Result import Result
+from pyvrp.Statistics import Statistics
+from pyvrp._pyvrp import (
+    Activity,
+    ActivityType,
+    Client,
+    Depot,
+    ProblemData,
+    RandomNumberGenerator,
+    Route,
+    Shipment,
+    Solution,
+)
+from pyvrp.solve import SolveParams, solve
+from pyvrp.stop import MaxIterations
+
+if TYPE_CHECKING:
+    from pyvrp.stop import StoppingCriterion
+
+
+@dataclass
+class DecompositionParams:
+    """
+    Parameters for the route-based decomposition solver.
+
+    Parameters
+    ----------
+    max_subproblem_size
+        Maximum number of clients and shipment steps in each subproblem.
+        Subproblems consist of whole routes, so a subproblem may exceed this
+        size when it consists of a single route.
+    num_iterations
+        Number of iterations of the iterated local search used to solve each
+        subproblem, and to construct the initial solution.
+    num_threads
+        Maximum number of threads used to solve subproblems in parallel. If
+        not provided, the default of
+        :class:`~concurrent.futures.ThreadPoolExecutor` is used.
+    """
+
+    max_subproblem_size: int = 500
+    num_iterations: int = 1_000
+    num_threads: int | None = None
+
+    def __post_init__(self):
+        if self.max_subproblem_size <= 0:
+            raise ValueError("max_subproblem_size must be positive.")
+
+        if self.num_iterations < 0:
+            raise ValueError("num_iterations < 0 not understood.")
+
+        if self.num_threads is not None and self.num_threads <= 0:
+            raise ValueError("num_threads must be positive.")
+
+
+def partition_routes(
+    data: ProblemData,
+    solution: Solution,
+    max_subproblem_size: int,
+    offset: float = 0.0,
+) -> list[list[int]]:
+    """
+    Partitions the routes of the given solution into groups of spatially close
+    routes. Each route is represented by the barycentre of the locations it
+    visits. The routes are sorted by the polar angle of their barycentre
+    around the centre of the depots, and consecutive routes are grouped until
+    a group would exceed the maximum subproblem size. Each group thus forms a
+    polar sector.
+
+    Parameters
+    ----------
+    data
+        Problem data instance.
+    solution
+        Solution whose routes to partition.
+    max_subproblem_size
+        Maximum number of clients and shipment steps in each group. A group
+        always contains at least one route.
+    offset
+        Fraction of a full rotation, in [0, 1), at which the first sector
+        starts. Varying the offset changes which routes are grouped together.
+
+    Returns
+    -------
+    list[list[int]]
+        Groups of route indices. Each route belongs to exactly one group.
+    """
+    depots = [data.location(depot.location) for depot in data.depots()]
+    centre_x = np.mean([loc.x for loc in depots])
+    centre_y = np.mean([loc.y for loc in depots])
+
+    angles = []
+    sizes = []
+    for route in solution.routes():
+        visits = [_location(data, act) for act in route.activities()[1:-1]]
+        locs = [data.location(loc) for loc in visits if loc is not None]
+
+        x = np.mean([loc.x for loc in locs]) - centre_x
+        y = np.mean([loc.y for loc in locs]) - centre_y
+
+        angle = (math.atan2(y, x) / (2 * math.pi) - offset) % 1.0
+        angles.append(angle)
+        sizes.append(len(locs))
+
+    groups: list[list[int]] = []
+    group_size = 0
+    for idx in np.argsort(angles, kind="stable"):
+        if not groups or group_size + sizes[idx] > max_subproblem_size:
+            groups.append([])
+            group_size = 0
+
+        groups[-1].append(int(idx))
+        group_size += sizes[idx]
+
+    return groups
+
+
+def solve_decomposed(
+    data: ProblemData,
+    stop: StoppingCriterion,
+    seed: int = 0,
+    params: SolveParams = SolveParams(),
+    decomposition: DecompositionParams = DecompositionParams(),
+    initial_solution: Solution | None = None,
+) -> Result:
+    """
+    Solves the given problem data instance by repeatedly decomposing the best
+    solution into smaller subproblems. This is useful for very large instances,
+    where a single local search spends most of its time on routes that are far
+    from each other.
+
+    Each round partitions the routes of the best solution into polar sectors
+    using :func:`~pyvrp.decomposition.partition_routes`, with a random offset.
+    Each sector becomes a subproblem, containing only the clients, shipments,
+    and vehicles of its routes, and only the locations these visit. The
+    subproblems are solved in parallel threads, each starting from its part of
+    the best solution. Improved routes are then combined into a new best
+    solution. Since subproblems never become worse, neither does the best
+    solution.
+
+    .. note::
+
+       Clients that are not visited by the best solution do not belong to any
+       subproblem, and are thus never inserted. Clients in client groups are
+       treated as regular clients in the subproblems, which are required when
+       their group is required.
+
+    Parameters
+    ----------
+    data
+        Problem data instance to solve.
+    stop
+        Stopping criterion to use. The criterion is checked after each round.
+    seed
+        Seed value to use for the random number stream. Default 0.
+    params
+        Solver parameters to use for the initial solution and subproblems. If
+        not provided, a default will be used.
+    decomposition
+        Decomposition parameters. If not provided, a default will be used.
+    initial_solution
+        Optional solution to start from. If not provided, an initial solution
+        is obtained by solving the full instance for the configured number of
+        iterations.
+
+    Returns
+    -------
+    Result
+        A Result object containing the best found solution. The number of
+        iterations is the number of decomposition rounds.
+    """
+    start = time.perf_counter()
+    rng = RandomNumberGenerator(seed=seed)
+
+    best = initial_solution
+    if best is None:
+        stop_init = MaxIterations(decomposition.num_iterations)
+        res = solve(data, stop_init, seed, collect_stats=False, params=params)
+        best = res.best
+
+    penalties = params.penalty.midpoint_penalties(data)
+    cost_eval = PenaltyManager(penalties, params.penalty).max_cost_evaluator()
+
+    def solve_subproblem(sub: _Subproblem, seed: int) -> Solution:
+        stop_sub = MaxIterations(decomposition.num_iterations)
+        res = solve(
+            sub.data,
+            stop_sub,
+            seed,
+            collect_stats=False,
+            params=params,
+            initial_solution=sub.solution,
+        )
+
+        # The search's best solution is the best feasible solution, which may
+        # still be worse than the initial solution in terms of penalised cost
+        # when no feasible solution was found.
+        new_cost = cost_eval.penalised_cost(res.best)
+        if new_cost < cost_eval.penalised_cost(sub.solution):
+            return res.best
+
+        return sub.solution
+
+    iters = 0
+    while not stop(cost_eval.cost(best)):
+        iters += 1
+
+        routes = best.routes()
+        groups = partition_routes(
+            data, best, decomposition.max_subproblem_size, rng.rand()
+        )
+
+        subs = [_Subproblem(data, [routes[idx] for idx in g]) for g in groups]
+        seeds = [rng.randint(np.iinfo(np.int32).max) for _ in subs]
+
+        with ThreadPoolExecutor(decomposition.num_threads) as executor:
+            sols = list(executor.map(solve_subproblem, subs, seeds))
+
+        new_routes = []
+        for sub, sol in zip(subs, sols):
+            new_routes.extend(sub.lift(sol))
+
+        best = Solution(data, new_routes)
+
+    runtime = time.perf_counter() - start
+    return Result(best, Statistics(collect_stats=False), iters, runtime)
+
+
+def _location(data: ProblemData, activity: Activity) -> int | None:
+    match activity.type:
+        case ActivityType.CLIENT:
+            return data.client(activity.idx).location
+        case ActivityType.PICKUP:
+            return data.shipment(activity.idx).pickup.location
+        case ActivityType.DELIVERY:
+            return data.shipment(activity.idx).delivery.location
+        case _:
+            return None
+
+
+class _Subproblem:
+    """
+    Subproblem consisting of the given routes. The subproblem data contains
+    only the clients, shipments, and locations visited by these routes, and
+    the vehicles that perform them.
+    """
+
+    def __init__(self, data: ProblemData, routes: list[Route]):
+        self._data = data
+        self._clients: list[int] = []
+        self._shipments: list[int] = []
+        locs = {depot.location for depot in data.depots()}
+
+        for route in routes:
+            for activity in route.activities()[1:-1]:
+                if activity.is_client():
+                    self._clients.append(activity.idx)
+                elif activity.is_pickup():
+                    self._shipments.append(activity.idx)
+
+                if (loc := _location(data, activity)) is not None:
+                    locs.add(loc)
+
+        self._client2sub = {c: i for i, c in enumerate(self._clients)}
+        self._shipment2sub = {s: i for i, s in enumerate(self._shipments)}
+        self._locs = sorted(locs)
+        self._loc2sub = {loc: idx for idx, loc in enumerate(self._locs)}
+
+        counts = Counter(route.vehicle_type() for route in routes)
+        self._veh_types = sorted(counts)
+        self._veh_type2sub = {t: i for i, t in enumerate(self._veh_types)}
+
+        self.data = data.replace(
+            locations=[data.location(loc) for loc in self._locs],
+            clients=[self._client(data, c) for c in self._clients],
+            depots=[self._depot(depot) for depot in data.depots()],
+            vehicle_types=[
+                data.vehicle_type(t).replace(num_available=counts[t])
+                for t in self._veh_types
+            ],
+            distance_matrices=[
+                data.distance_submatrix(profile, self._locs)
+                for profile in range(data.num_profiles)
+            ],
+            duration_matrices=[
+                data.duration_submatrix(profile, self._locs)
+                for profile in range(data.num_profiles)
+            ],
+            groups=[],
+            shipments=[self._shipment(data, s) for s in self._shipments],
+        )
+
+        self.solution = Solution(
+            self.data,
+            [
+                Route(
+                    self.data,
+                    [self._to_sub(act) for act in route.activities()[1:-1]],
+                    self._veh_type2sub[route.vehicle_type()],
+                )
+                for route in routes
+            ],
+        )
+
+    def lift(self, solution: Solution) -> list[Route]:
+        """
+        Returns the routes of the given subproblem solution, in terms of the
+        original problem data.
+        """
+        return [
+            Route(
+                self._data,
+                [self._from_sub(act) for act in route.activities()[1:-1]],
+                self._veh_types[route.vehicle_type()],
+            )
+            for route in solution.routes()
+        ]
+
+    def _client(self, data: ProblemData, idx: int) -> Client:
+        client = data.client(idx)
+
+        required = client.required
+        if client.group is not None:
+            required = required or data.group(client.group).required
+
+        return Client(
+            self._loc2sub[client.location],
+            client.delivery,
+            client.pickup,
+            client.service_duration,
+            client.tw_early,
+            client.tw_late,
+            client.release_time,
+            client.prize,
+            required,
+            None,
+            client.lateness_cost,
+            name=client.name,
+        )
+
+    def _depot(self, depot: Depot) -> Depot:
+        return Depot(
+            self._loc2sub[depot.location],
+            depot.tw_early,
+            depot.tw_late,
+            depot.service_duration,
+            name=depot.name,
+        )
+
+    def _shipment(self, data: ProblemData, idx: int) -> Shipment:
+        shipment = data.shipment(idx)
+        pickup = shipment.pickup
+        delivery = shipment.delivery
+
+        return Shipment(
+            self._loc2sub[pickup.location],
+            self._loc2sub[delivery.location],
+            pickup.tw_early,
+            pickup.tw_late,
+            pickup.service_duration,
+            delivery.tw_early,
+            delivery.tw_late,
+            delivery.service_duration,
+            shipment.amount,
+            shipment.prize,
+            shipment.required,
+            pickup.lateness_cost,
+            delivery.lateness_cost,
+            name=shipment.name,
+        )
+
+    def _to_sub(self, activity: Activity) -> Activity:
+        if activity.is_client():
+            return Activity(activity.type, self._client2sub[activity.idx])
+
+        if activity.is_shipment():
+            return Activity(activity.type, self._shipment2sub[activity.idx])
+
+        return activity  # depots are not renumbered
+
+    def _from_sub(self, activity: Activity) -> Activity:
+        if activity.is_client():
+            return Activity(activity.type, self._clients[activity.idx])
+
+        if activity.is_shipment():
+            return Activity(activity.type, self._shipments[activity.idx])
+
+        return activity
+
@@ -1,25 +1,52 @@
-import numpy as np
+from __future__ import annotations
 
-from pyvrp._pyvrp import CostEvaluator, ProblemData, VehicleType
-from pyvrp.solve import SolveParams, solve
+import itertools
+import threading
+from collections import Counter
+from concurrent.futures import ThreadPoolExecutor
+from typing import TYPE_CHECKING
+
+from pyvrp._pyvrp import ProblemData, Route, Solution, VehicleType
+from pyvrp.solve import SolveParams, _compute_neighbours, _solve
 from pyvrp.stop import FirstFeasible, MultipleCriteria, StoppingCriterion
 
+if TYPE_CHECKING:
+    from collections.abc import Sequence
+
+    from pyvrp._pyvrp import Activity
+
+    # A route of the best solution, as the index of its vehicle type in the
+    # original problem instance, and its activities, excluding start and end
+    # depots.
+    FleetRoute = tuple[int, list[Activity]]
+
 
 def minimise_fleet(
     data: ProblemData,
     stop: StoppingCriterion,
     seed: int = 0,
     params: SolveParams = SolveParams(),
-) -> VehicleType:
+    num_threads: int = 1,
+) -> list[VehicleType]:
     """
     Attempts to reduce the number of vehicles needed to achieve a feasible
     solution to the given problem instance, subject to a stopping criterion.
 
-    .. warning::
+    The procedure first solves the instance with its given fleet, until a
+    feasible solution is found. Then it repeatedly attempts to find a feasible
+    solution using a smaller fleet. Each attempt is warm-started from the
+    best feasible solution found so far, with its smallest routes removed. The
+    vehicles of the remaining routes form the attempt's fleet, so instances
+    with multiple vehicle types are supported as well.
 
-       This function is currently unable to solve instances with multiple
-       vehicle types. Support for such a setting may be added in future
-       versions of PyVRP.
+    With multiple threads, several fleet sizes are attempted at the same time.
+    One thread always attempts to use one vehicle fewer than the best feasible
+    solution, while the others bisect the remaining range of fleet sizes down
+    to a simple lower bound. All attempts share the problem data and granular
+    neighbourhood. Attempts are cancelled once a feasible solution using at
+    most as many vehicles as the attempt's fleet size has been found. When
+    every remaining fleet size is already being attempted, idle threads wait
+    for an attempt to finish and then pick up the next fleet size.
 
     Parameters
     ----------
@@ -27,75 +54,229 @@ def minimise_fleet(
         Problem instance with a given vehicle composition.
     stop
         Stopping criterion that determines how much effort to spend on finding
-        smaller fleet compositions.
+        smaller fleet compositions. This criterion is shared by all attempts.
     seed
-        Seed value to use for the random number stream. Default 0.
+        Seed value to use for the random number stream. Default 0. Each
+        attempt derives its own seed from this value.
     params
         Solver parameters to use. If not provided, a default will be used.
+    num_threads
+        Number of fleet sizes to attempt at the same time, each on its own
+        thread. Default 1.
 
     Returns
     -------
-    VehicleType
+    list[VehicleType]
         The smallest fleet composition admitting a feasible solution to the
         problem instance that could be found before the stopping criterion was
-        hit. The original fleet is returned if no feasible solution was found.
+        hit. Vehicle types that are not needed are omitted. The original fleet
+        is returned if no feasible solution was found.
 
     Raises
     ------
     ValueError
-        When the instance contains more than one vehicle type. That setting is
-        not yet supported. Alternatively, when the instance contains optional
-        clients. This method attempts to find a good upper bound on the number
-        of vehicles needed to solve the complete problem.
+        When the instance contains optional clients. This method attempts to
+        find a good upper bound on the number of vehicles needed to solve the
+        complete problem. Alternatively, when ``num_threads`` is not positive.
     """
-    if data.num_vehicle_types != 1:
-        msg = "Fleet minimisation does not understand multiple vehicle types."
-        raise ValueError(msg)
-
     if any(not client.required for client in data.clients()):
         msg = "Fleet minimisation does not work with optional clients."
         raise ValueError(msg)
 
-    feas_fleet = data.vehicle_type(0)
-    lower_bound = _lower_bound(data)
+    if num_threads <= 0:
+        raise ValueError("num_threads must be positive.")
+
+    minimiser = _FleetMinimiser(data, stop, seed, params)
+    return minimiser.run(num_threads)
+
+
+class _FleetMinimiser:
+    """
+    Shared state of the fleet minimisation attempts. All attributes that are
+    modified during the search are guarded by the lock. Idle workers wait on
+    the condition until an attempt finishes.
+    """
+
+    def __init__(
+        self,
+        data: ProblemData,
+        stop: StoppingCriterion,
+        seed: int,
+        params: SolveParams,
+    ):
+        self._data = data
+        self._stop = stop
+        self._seed = seed
+        self._params = params
+        self._neighbours = _compute_neighbours(data, params)
+
+        self._lock = threading.Lock()
+        self._finished = threading.Condition(self._lock)
+        self._best: list[FleetRoute] = []
+        self._lower = max(_lower_bound(data), 1)
+        self._active: set[int] = set()
+        self._exhausted = False
+        self._num_attempts = 0
+
+    @property
+    def _upper(self) -> int:
+        return len(self._best)
+
+    def run(self, num_threads: int) -> list[VehicleType]:
+        init = self._solve(self._data, self._data.num_vehicles, self._seed)
+        if not init.is_feasible():
+            return self._data.vehicle_types()
+
+        self._best = self._routes(init, range(self._data.num_vehicle_types))
+
+        with ThreadPoolExecutor(num_threads) as executor:
+            workers = [executor.submit(self._work) for _ in range(num_threads)]
+            for worker in workers:
+                worker.result()
+
+        counts = Counter(veh_type for veh_type, _ in self._best)
+        return [
+            veh_type.replace(num_available=counts[idx])
+            for idx, veh_type in enumerate(self._data.vehicle_types())
+            if counts[idx] > 0
+        ]
+
+    def _work(self):
+        while (attempt := self._next_attempt()) is not None:
+            self._attempt(*attempt)
+
+    def _next_attempt(self) -> tuple[int, int] | None:
+        """
+        Returns the fleet size and seed of the next attempt, or nothing when
+        the search is over. Waits while every fleet size that could still
+        improve the best solution is already being attempted.
+        """
+        with self._finished:
+            while (size := self._next_size()) is None:
+                if self._exhausted or self._lower >= self._upper:
+                    return None
 
-    while feas_fleet.num_available > lower_bound:
-        # Reduce feasible fleet by one vehicle, and retry solving.
-        fleet = feas_fleet.replace(num_available=feas_fleet.num_available - 1)
-        data = data.replace(vehicle_types=[fleet])
+                self._finished.wait()
 
-        res = solve(
+            # Each attempt gets its own seed, so attempts of the same fleet
+            # size do not repeat the same search.
+            self._num_attempts += 1
+            seed = (self._seed + self._num_attempts) % 2**32
+
+            self._active.add(size)
+            return size, seed
+
+    def _next_size(self) -> int | None:
+        if self._exhausted or self._lower >= self._upper:
+            return None
+
+        # First try to save a single vehicle. That is the easiest attempt that
+        # makes progress, and what a single thread always does.
+        size = self._upper - 1
+        if size in self._active:
+            # Otherwise bisect the largest range of fleet sizes that is not yet
+            # being attempted.
+            active = [s for s in self._active if s < self._upper]
+            points = [self._lower - 1, *sorted(active)]
+            gaps = itertools.pairwise(points)
+            lo, hi = max(gaps, key=lambda gap: gap[1] - gap[0])
+            size = (lo + hi) // 2
+
+        if size < self._lower or size in self._active:
+            return None  # every fleet size is already being attempted
+
+        return size
+
+    def _attempt(self, size: int, seed: int):
+        with self._lock:
+            # Keeps the routes of the best solution that visit the most
+            # clients. Only the vehicles of those routes form the fleet.
+            ordered = sorted(self._best, key=lambda r: len(r[1]), reverse=True)
+            keep = ordered[:size]
+
+        veh_types = sorted({veh_type for veh_type, _ in keep})
+        counts = Counter(veh_type for veh_type, _ in keep)
+        fleet = [
+            self._data.vehicle_type(veh_type).replace(
+                num_available=counts[veh_type]
+            )
+            for veh_type in veh_types
+        ]
+
+        data = self._data.replace(vehicle_types=fleet)
+        index = {veh_type: idx for idx, veh_type in enumerate(veh_types)}
+        routes = [Route(data, acts, index[typ]) for typ, acts in keep]
+
+        best = None
+        try:
+            best = self._solve(data, size, seed, Solution(data, routes))
+        finally:
+            with self._finished:
+                self._active.discard(size)
+
+                if best is None:
+                    # The attempt raised. That ends the search, and the error
+                    # is passed on to the caller.
+                    self._exhausted = True
+                elif best.is_feasible():
+                    if best.num_routes() < self._upper:
+                        self._best = self._routes(best, veh_types)
+                elif size < self._upper:
+                    # The attempt was not cancelled, so it must have hit the
+                    # stopping criterion. That ends the search.
+                    self._exhausted = True
+
+                self._finished.notify_all()
+
+    def _solve(
+        self,
+        data: ProblemData,
+        size: int,
+        seed: int,
+        initial_solution: Solution | None = None,
+    ) -> Solution:
+        def cancelled(best_cost: float) -> bool:
+            with self._lock:
+                return self._exhausted or size >= self._upper
+
+        # The best solution is empty before the first solve, which must thus
+        # not be cancelled.
+        criteria = [FirstFeasible(), self._stop]
+        if initial_solution is not None:
+            criteria.append(cancelled)
+
+        res = _solve(
             data,
-            stop=MultipleCriteria([FirstFeasible(), stop]),
-            seed=seed,
-            collect_stats=False,
-            display=False,
-            params=params,
+            MultipleCriteria(criteria),
+            seed,
+            *self._neighbours,
+            False,
+            False,
+            self._params,
+            initial_solution,
         )
-        best = res.best
-        cost_eval = CostEvaluator([0] * data.num_load_dimensions, 0, 0)
-
-        if stop(cost_eval.cost(best)) or not best.is_feasible():
-            return feas_fleet
 
-        feas_fleet = fleet
-        if best.num_routes() < data.num_vehicles:
-            # Then we can make a bigger jump because more than one vehicle of
-            # the feasible fleet was unused.
-            feas_fleet = fleet.replace(num_available=best.num_routes())
+        return res.best
 
-    return feas_fleet
+    def _routes(
+        self,
+        sol: Solution,
+        veh_types: Sequence[int],
+    ) -> list[FleetRoute]:
+        return [
+            (veh_types[route.vehicle_type()], route.activities()[1:-1])
+            for route in sol.routes()
+        ]
 
 
 def _lower_bound(data: ProblemData) -> int:
-    vehicle_type = data.vehicle_type(0)
-
     # TODO additional simple bounding techniques exist, for example based on
     # time properties. See https://doi.org/10.1007/978-3-319-07046-9_30 for
     # details.
 
     # Computes a bound based on packing delivery or pickup demands in the given
-    # vehicles over all load dimensions. The strongest bound is returned.
+    # vehicles over all load dimensions, using the vehicles with the largest
+    # capacity first. The strongest bound is returned.
     bound = 0
     for dim in range(data.num_load_dimensions):
         delivery = sum(c.delivery[dim] for c in data.clients())
@@ -104,7 +285,20 @@ def _lower_bound(data: ProblemData) -> int:
 
         # Vehicle capacity applies per trip - if more than one trip is allowed,
         # the capacity needs to be scaled as well.
-        capacity = vehicle_type.capacity[dim] * vehicle_type.max_trips
-        bound = max(int(np.ceil(demand / max(capacity, 1))), bound)
+        capacities = sorted(
+            (
+                veh_type.capacity[dim] * veh_type.max_trips
+                for veh_type in data.vehicle_types()
+                for _ in range(veh_type.num_available)
+            ),
+            reverse=True,
+        )
+
+        num_vehicles = 0
+        while demand > 0 and num_vehicles < len(capacities):
+            demand -= capacities[num_vehicles]
+            num_vehicles += 1
+
+        bound = max(num_vehicles, bound)
 
     return bound
@@ -1,5 +1,4 @@
 import matplotlib.pyplot as plt
-import numpy as np
 
 from pyvrp.Result import Result
 
@@ -34,19 +33,16 @@ def plot_objectives(
     if num_to_skip is None:
         num_to_skip = int(0.05 * result.num_iterations)
 
-    def _plot(x, y, *args, **kwargs):
-        ax.plot(x[num_to_skip:], y[num_to_skip:], *args, **kwargs)
+    columns = result.stats.to_numpy()
+    x = columns["iteration"]
+    skip = x > num_to_skip  # statistics need not be recorded every iteration
 
-    x = 1 + np.arange(result.num_iterations)
+    def _plot(y, *args, **kwargs):
+        ax.plot(x[skip], y[skip], *args, **kwargs)
 
-    y = [datum.current_cost for datum in result.stats]
-    _plot(x, y, label="Current")
-
-    y = [datum.candidate_cost for datum in result.stats]
-    _plot(x, y, label="Candidate", alpha=0.2, zorder=1)
-
-    y = [datum.best_cost for datum in result.stats]
-    _plot(x, y, label="Best")
+    _plot(columns["current_cost"], label="Current")
+    _plot(columns["candidate_cost"], label="Candidate", alpha=0.2, zorder=1)
+    _plot(columns["best_cost"], label="Best")
 
     # Use best-found solution to set reasonable y-limits, if available.
     if result.is_feasible():
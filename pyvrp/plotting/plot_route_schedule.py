@@ -2,7 +2,7 @@ import matplotlib.pyplot as plt
 import numpy as np
 from matplotlib.collections import LineCollection
 
-from pyvrp import ActivityType, ProblemData, Route
+from pyvrp import ActivityType, ProblemData, Route, ScheduledActivity
 
 
 def plot_route_schedule(
@@ -45,8 +45,14 @@ def plot_route_schedule(
         _, ax = plt.subplots()
 
     vehicle_type = data.vehicle_type(route.vehicle_type())
-    distances = data.distance_matrix(vehicle_type.profile)
-    durations = data.duration_matrix(vehicle_type.profile)
+    stops = [_stop(data, activity) for activity in route]
+
+    # We only need the distances and durations between consecutive stops, so
+    # we do not retrieve the full matrices, which may need to be copied.
+    locs = [data.depot(vehicle_type.start_depot).location]
+    locs += [stop.location for stop in stops]
+    distances = data.distance_submatrix(vehicle_type.profile, locs)
+    durations = data.duration_submatrix(vehicle_type.profile, locs)
 
     track_load = load_dimension < data.num_load_dimensions
 
@@ -73,38 +79,26 @@ def plot_route_schedule(
         trace_drive_serv.append((dist, drive_time + serv_time))
         trace_load.append((dist, load))
 
-    prev_loc = data.depot(vehicle_type.start_depot).location
-    for activity in route:
+    for idx, (activity, stop) in enumerate(zip(route, stops)):
         load_diff = 0
 
-        match activity.type:
-            case ActivityType.DEPOT:
-                stop = data.depot(activity.idx)  # type: ignore
-
-            case ActivityType.CLIENT:
-                client = data.client(activity.idx)
-                stop = client  # type: ignore
-
-                if track_load:
+        if track_load:
+            match activity.type:
+                case ActivityType.CLIENT:
+                    client = data.client(activity.idx)
                     load_diff -= client.delivery[load_dimension]
                     load_diff += client.pickup[load_dimension]
 
-            case ActivityType.PICKUP:
-                shipment = data.shipment(activity.idx)
-                stop = shipment.pickup  # type: ignore
-
-                if track_load:
+                case ActivityType.PICKUP:
+                    shipment = data.shipment(activity.idx)
                     load_diff += shipment.amount[load_dimension]
 
-            case ActivityType.DELIVERY:
-                shipment = data.shipment(activity.idx)
-                stop = shipment.delivery  # type: ignore
-
-                if track_load:
+                case ActivityType.DELIVERY:
+                    shipment = data.shipment(activity.idx)
                     load_diff -= shipment.amount[load_dimension]
 
-        drive_time += durations[prev_loc, stop.location]
-        dist += distances[prev_loc, stop.location]
+        drive_time += durations[idx, idx + 1]
+        dist += distances[idx, idx + 1]
 
         arrive = activity.start_time - activity.wait_duration
         add_traces(dist, arrive, drive_time, serv_time, load)
@@ -122,8 +116,6 @@ def plot_route_schedule(
 
         timewindow_lines.append(((dist, stop.tw_early), (dist, stop.tw_late)))
 
-        prev_loc = stop.location
-
     xs, ys = zip(*trace_time)
     ax.plot(xs, ys, label="Time (earliest)")
 
@@ -187,3 +179,18 @@ def plot_route_schedule(
 
     if title:
         ax.set_title(title)
+
+
+def _stop(data: ProblemData, activity: ScheduledActivity):
+    match activity.type:
+        case ActivityType.DEPOT:
+            return data.depot(activity.idx)
+
+        case ActivityType.CLIENT:
+            return data.client(activity.idx)
+
+        case ActivityType.PICKUP:
+            return data.shipment(activity.idx).pickup
+
+        case ActivityType.DELIVERY:
+            return data.shipment(activity.idx).delivery
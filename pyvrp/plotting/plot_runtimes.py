@@ -18,12 +18,13 @@ def plot_runtimes(result: Result, ax: plt.Axes | None = None):
     if not ax:
         _, ax = plt.subplots()
 
-    x = 1 + np.arange(result.num_iterations)
-    ax.plot(x, result.stats.runtimes)
+    x = result.stats.iterations
+    y = result.stats.runtimes
+    ax.plot(x, y)
 
-    if result.num_iterations > 1:  # need data to plot a trendline
-        b, c = np.polyfit(x, result.stats.runtimes, 1)
-        ax.plot(b * x + c)
+    if len(x) > 1:  # need data to plot a trendline
+        b, c = np.polyfit(x, y, 1)
+        ax.plot(x, b * x + c)
 
     ax.set_xlim(left=0)
 
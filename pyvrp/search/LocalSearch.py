@@ -1,3 +1,7 @@
+import csv
+from pathlib import Path
+from typing import Literal
+
 from pyvrp._pyvrp import (
     Activity,
     CostEvaluator,
@@ -8,6 +12,7 @@ from pyvrp._pyvrp import (
 from pyvrp.search._search import (
     BinaryOperator,
     LocalSearchStatistics,
+    OperatorSelectionParams,
     PerturbationManager,
     UnaryOperator,
 )
@@ -31,6 +36,9 @@ class LocalSearch:
         granular neighbourhood.
     perturbation_manager
         Perturbation manager that handles perturbation during each invocation.
+    selection_params
+        Operator selection parameters. By default, all operators are evaluated
+        in a uniformly random order.
     """
 
     def __init__(
@@ -39,8 +47,11 @@ class LocalSearch:
         rng: RandomNumberGenerator,
         neighbours: dict[Activity, list[Activity]],
         perturbation_manager: PerturbationManager = PerturbationManager(),
+        selection_params: OperatorSelectionParams = OperatorSelectionParams(),
     ):
-        self._ls = _LocalSearch(data, neighbours, perturbation_manager)
+        self._ls = _LocalSearch(
+            data, neighbours, perturbation_manager, selection_params
+        )
         self._rng = rng
 
     def add_operator(self, op: UnaryOperator | BinaryOperator):
@@ -70,6 +81,28 @@ class LocalSearch:
         """
         self._ls.neighbours = neighbours
 
+    @property
+    def profile_neighbours(self) -> list[dict[Activity, list[Activity]]]:
+        """
+        Returns the per-profile granular neighbourhoods currently used by the
+        local search. This list is empty if the local search does not use
+        per-profile neighbourhoods.
+        """
+        return self._ls.profile_neighbours
+
+    @profile_neighbours.setter
+    def profile_neighbours(
+        self,
+        neighbours: list[dict[Activity, list[Activity]]],
+    ):
+        """
+        Sets per-profile granular neighbourhoods, one for each routing profile.
+        When set, the local search only evaluates moves between a client or
+        pickup and a neighbour in a route of the profile whose neighbourhood
+        contains that neighbour. Pass an empty list to disable.
+        """
+        self._ls.profile_neighbours = neighbours
+
     @property
     def unary_operators(self) -> list[UnaryOperator]:
         """
@@ -91,6 +124,69 @@ class LocalSearch:
         """
         return self._ls.statistics
 
+    def statistics_to_csv(
+        self,
+        where: Path | str,
+        delimiter: str = ",",
+        quoting: Literal[0, 1, 2, 3] = csv.QUOTE_MINIMAL,
+        **kwargs,
+    ):
+        """
+        Writes per-operator statistics about the most recently improved
+        solution to the given location, as a CSV file. Each row corresponds to
+        one operator. The timing and shortcut columns are only populated when
+        PyVRP is compiled with the ``operator_timing`` build option.
+
+        Parameters
+        ----------
+        where
+            Filesystem location to write to.
+        delimiter
+            Value separator. Default comma.
+        quoting
+            Quoting strategy. Default only quotes values when necessary.
+        kwargs
+            Additional keyword arguments. These are passed to
+            :class:`csv.DictWriter`.
+        """
+        header = [
+            "operator",
+            "num_evaluations",
+            "num_applications",
+            "num_shortcuts",
+            "num_skips",
+            "improving_delta",
+            "avg_improving_delta",
+            "evaluate_time",
+            "apply_time",
+            "update_time",
+        ]
+
+        with open(where, "w") as fh:
+            writer = csv.DictWriter(
+                fh, header, delimiter=delimiter, quoting=quoting, **kwargs
+            )
+            writer.writeheader()
+
+            for name, stats in self.statistics.operators:
+                num_apps = stats.num_applications
+                writer.writerow(
+                    {
+                        "operator": name,
+                        "num_evaluations": stats.num_evaluations,
+                        "num_applications": num_apps,
+                        "num_shortcuts": stats.num_shortcuts,
+                        "num_skips": stats.num_skips,
+                        "improving_delta": stats.improving_delta,
+                        "avg_improving_delta": (
+                            stats.improving_delta / num_apps if num_apps else 0
+                        ),
+                        "evaluate_time": stats.evaluate_time,
+                        "apply_time": stats.apply_time,
+                        "update_time": stats.update_time,
+                    }
+                )
+
     def __call__(
         self,
         solution: Solution,
@@ -119,3 +215,38 @@ class LocalSearch:
         """
         self._ls.shuffle(self._rng)
         return self._ls(solution, cost_evaluator, exhaustive)
+
+    def search_around(
+        self,
+        solution: Solution,
+        cost_evaluator: CostEvaluator,
+        activities: list[Activity],
+    ) -> Solution:
+        """
+        This method re-optimises the given solution around the given client
+        and shipment activities. It first inserts any missing required clients,
+        shipments, and groups, and then searches only the neighbourhoods of the
+        given activities, and of the activities affected by improving moves.
+
+        This is useful when a few clients or shipments were added or changed,
+        since it avoids a full search of the solution. Use
+        :func:`~pyvrp.search.neighbourhood.update_neighbours` to quickly
+        update the neighbourhood in that case as well.
+
+        Parameters
+        ----------
+        solution
+            The solution to improve through local search.
+        cost_evaluator
+            Cost evaluator to use.
+        activities
+            The (changed) client and shipment activities to search around.
+
+        Returns
+        -------
+        Solution
+            The improved solution. This is not the same object as the
+            solution that was passed in.
+        """
+        self._ls.shuffle(self._rng)
+        return self._ls.search_around(solution, cost_evaluator, activities)
@@ -3,11 +3,15 @@ from typing import Type
 from .LocalSearch import LocalSearch as LocalSearch
 from .SearchMethod import SearchMethod as SearchMethod
 from ._search import BinaryOperator as BinaryOperator
+from ._search import EliminateRoute as EliminateRoute
+from ._search import GeneticAlgorithmParams as GeneticAlgorithmParams
 from ._search import InsertOptionalClient as InsertOptionalClient
 from ._search import InsertOptionalShipment as InsertOptionalShipment
 from ._search import NeighbourhoodParams as NeighbourhoodParams
+from ._search import OperatorSelectionParams as OperatorSelectionParams
 from ._search import PerturbationManager as PerturbationManager
 from ._search import PerturbationParams as PerturbationParams
+from ._search import RecreateMethod as RecreateMethod
 from ._search import Relocate1 as Relocate1
 from ._search import Relocate2 as Relocate2
 from ._search import Relocate3 as Relocate3
@@ -22,6 +26,7 @@ from ._search import RemoveOptionalShipment as RemoveOptionalShipment
 from ._search import ReplaceGroup as ReplaceGroup
 from ._search import ReplaceOptionalClient as ReplaceOptionalClient
 from ._search import ReplaceOptionalShipment as ReplaceOptionalShipment
+from ._search import RuinMethod as RuinMethod
 from ._search import Swap11 as Swap11
 from ._search import Swap21 as Swap21
 from ._search import Swap22 as Swap22
@@ -30,7 +35,10 @@ from ._search import Swap32 as Swap32
 from ._search import Swap33 as Swap33
 from ._search import SwapTails as SwapTails
 from ._search import UnaryOperator as UnaryOperator
+from ._search import broken_pairs_distance as broken_pairs_distance
+from ._search import srex as srex
 from .neighbourhood import compute_neighbours as compute_neighbours
+from .neighbourhood import update_neighbours as update_neighbours
 
 OPERATORS: list[Type[UnaryOperator | BinaryOperator]] = [
     Relocate1,
@@ -1,3 +1,4 @@
+from enum import Enum
 from typing import Iterator, overload
 
 import pyvrp
@@ -14,6 +15,12 @@ from pyvrp._pyvrp import (
 class OperatorStatistics:
     num_evaluations: int
     num_applications: int
+    num_shortcuts: int
+    num_skips: int
+    improving_delta: int
+    evaluate_time: float
+    apply_time: float
+    update_time: float
 
 class UnaryOperator:
     def __init__(self, data: ProblemData) -> None: ...
@@ -45,6 +52,7 @@ class BinaryOperator:
     @staticmethod
     def supports(data: ProblemData) -> bool: ...
 
+class EliminateRoute(UnaryOperator): ...
 class RelocateDelivery(UnaryOperator): ...
 class RelocatePickup(UnaryOperator): ...
 class RemoveAdjacentDepot(UnaryOperator): ...
@@ -82,7 +90,22 @@ class SearchSpace:
         self,
         neighbours: dict[Activity, list[Activity]],
     ) -> None: ...
+    @property
+    def profile_neighbours(self) -> list[dict[Activity, list[Activity]]]: ...
+    @profile_neighbours.setter
+    def profile_neighbours(
+        self,
+        neighbours: list[dict[Activity, list[Activity]]],
+    ) -> None: ...
+    def has_profile_neighbours(self) -> bool: ...
+    @overload
     def neighbours_of(self, activity: Activity) -> list[Activity]: ...
+    @overload
+    def neighbours_of(
+        self,
+        activity: Activity,
+        profile: int,
+    ) -> list[Activity]: ...
     def is_promising(self, activity: Activity) -> bool: ...
     @overload
     def mark_promising(self, activity: Activity) -> None: ...
@@ -94,13 +117,31 @@ class SearchSpace:
     def veh_type_order(self) -> list[tuple[int, int]]: ...
     def shuffle(self, rng: RandomNumberGenerator) -> None: ...
 
+class RuinMethod(Enum):
+    NEIGHBOURHOOD = 0
+    STRINGS = 1
+    WORST = 2
+
+class RecreateMethod(Enum):
+    GREEDY = 0
+    BLINK = 1
+    REGRET = 2
+
 class PerturbationParams:
     min_perturbations: int
     max_perturbations: int
+    ruin_method: RuinMethod
+    recreate_method: RecreateMethod
+    max_string_length: int
+    blink_rate: float
     def __init__(
         self,
         min_perturbations: int = 1,
         max_perturbations: int = 25,
+        ruin_method: RuinMethod = RuinMethod.NEIGHBOURHOOD,
+        recreate_method: RecreateMethod = RecreateMethod.GREEDY,
+        max_string_length: int = 10,
+        blink_rate: float = 0.01,
     ) -> None: ...
     def __eq__(self, other: object) -> bool: ...
 
@@ -118,10 +159,23 @@ class PerturbationManager:
         cost_evaluator: CostEvaluator,
     ) -> None: ...
 
+class OperatorSelectionParams:
+    adaptive: bool
+    decay: float
+    min_probability: float
+    def __init__(
+        self,
+        adaptive: bool = False,
+        decay: float = 0.8,
+        min_probability: float = 0.1,
+    ) -> None: ...
+    def __eq__(self, other: object) -> bool: ...
+
 class LocalSearchStatistics:
     num_moves: int
     num_improving: int
     num_updates: int
+    operators: list[tuple[str, OperatorStatistics]]
 
 class LocalSearch:
     def __init__(
@@ -129,6 +183,7 @@ class LocalSearch:
         data: ProblemData,
         neighbours: dict[Activity, list[Activity]],
         perturbation_manager: PerturbationManager = ...,
+        selection_params: OperatorSelectionParams = ...,
     ) -> None: ...
     def add_operator(self, op: UnaryOperator | BinaryOperator) -> None: ...
     @property
@@ -139,6 +194,13 @@ class LocalSearch:
         neighbours: dict[Activity, list[Activity]],
     ) -> None: ...
     @property
+    def profile_neighbours(self) -> list[dict[Activity, list[Activity]]]: ...
+    @profile_neighbours.setter
+    def profile_neighbours(
+        self,
+        neighbours: list[dict[Activity, list[Activity]]],
+    ) -> None: ...
+    @property
     def unary_operators(self) -> list[UnaryOperator]: ...
     @property
     def binary_operators(self) -> list[BinaryOperator]: ...
@@ -151,8 +213,50 @@ class LocalSearch:
         cost_evaluator: CostEvaluator,
         exhaustive: bool = False,
     ) -> pyvrp.Solution: ...
+    def search_around(
+        self,
+        solution: pyvrp.Solution,
+        cost_evaluator: CostEvaluator,
+        activities: list[Activity],
+    ) -> pyvrp.Solution: ...
     def shuffle(self, rng: RandomNumberGenerator) -> None: ...
 
+class GeneticAlgorithmParams:
+    min_pop_size: int
+    generation_size: int
+    num_elite: int
+    num_close: int
+    num_threads: int
+    def __init__(
+        self,
+        min_pop_size: int = 25,
+        generation_size: int = 40,
+        num_elite: int = 4,
+        num_close: int = 5,
+        num_threads: int = 1,
+    ) -> None: ...
+    def __eq__(self, other: object) -> bool: ...
+
+class GeneticAlgorithm:
+    def __init__(
+        self,
+        data: ProblemData,
+        searches: list[LocalSearch],
+        params: GeneticAlgorithmParams = ...,
+    ) -> None: ...
+    def add(
+        self,
+        solution: pyvrp.Solution,
+        cost_evaluator: CostEvaluator,
+    ) -> None: ...
+    def step(
+        self,
+        cost_evaluator: CostEvaluator,
+        rng: RandomNumberGenerator,
+    ) -> list[pyvrp.Solution]: ...
+    def num_feasible(self) -> int: ...
+    def num_infeasible(self) -> int: ...
+
 class Solution:
     clients: list[Node]
     shipments: list[tuple[Node, Node]]
@@ -212,6 +316,7 @@ class Route:
     def duration(self) -> int: ...
     def overtime(self) -> int: ...
     def duration_cost(self) -> int: ...
+    def lateness_cost(self) -> int: ...
     def unit_duration_cost(self) -> int: ...
     def unit_overtime_cost(self) -> int: ...
     def has_duration_cost(self) -> bool: ...
@@ -276,15 +381,40 @@ class NeighbourhoodParams:
     weight_wait_time: float
     num_neighbours: int
     symmetric_proximity: bool
+    per_profile: bool
+    spatial_oversampling: float
     def __init__(
         self,
         weight_wait_time: float = 0.2,
         num_neighbours: int = 50,
         symmetric_proximity: bool = True,
+        per_profile: bool = False,
+        spatial_oversampling: float = 0.0,
     ) -> None: ...
     def __eq__(self, other: object) -> bool: ...
 
 def compute_neighbours(
     data: ProblemData,
     params: NeighbourhoodParams,
+    profile: int | None = None,
 ) -> dict[Activity, list[Activity]]: ...
+def update_neighbours(
+    data: ProblemData,
+    neighbours: dict[Activity, list[Activity]],
+    changed: list[Activity],
+    removed: list[Activity],
+    params: NeighbourhoodParams,
+    profile: int | None = None,
+) -> dict[Activity, list[Activity]]: ...
+def broken_pairs_distance(
+    data: ProblemData,
+    first: pyvrp.Solution,
+    second: pyvrp.Solution,
+) -> float: ...
+def srex(
+    first: pyvrp.Solution,
+    second: pyvrp.Solution,
+    data: ProblemData,
+    cost_evaluator: CostEvaluator,
+    rng: RandomNumberGenerator,
+) -> pyvrp.Solution: ...
@@ -4,13 +4,16 @@ from typing import TYPE_CHECKING
 
 from pyvrp.search._search import NeighbourhoodParams
 from pyvrp.search._search import compute_neighbours as _compute_neighbours
+from pyvrp.search._search import update_neighbours as _update_neighbours
 
 if TYPE_CHECKING:
     from pyvrp import Activity, ProblemData
 
 
 def compute_neighbours(
-    data: ProblemData, params: NeighbourhoodParams = NeighbourhoodParams()
+    data: ProblemData,
+    params: NeighbourhoodParams = NeighbourhoodParams(),
+    profile: int | None = None,
 ) -> dict[Activity, list[Activity]]:
     """
     Computes neighbours defining the neighbourhood for a problem instance.
@@ -21,6 +24,10 @@ def compute_neighbours(
         ProblemData for which to compute the neighbourhood.
     params
         NeighbourhoodParams that define how the neighbourhood is computed.
+    profile
+        Optional routing profile. If given, only vehicle types using this
+        profile are considered when computing the neighbourhood. Default
+        ``None``, which considers all vehicle types.
 
     Returns
     -------
@@ -28,4 +35,58 @@ def compute_neighbours(
         A mapping from activities to neighbouring activities for each client
         and pickup activity.
     """
-    return _compute_neighbours(data, params)  # delegate to C++ implementation
+    # Delegate to the C++ implementation.
+    return _compute_neighbours(data, params, profile)
+
+
+def update_neighbours(
+    data: ProblemData,
+    neighbours: dict[Activity, list[Activity]],
+    changed: list[Activity],
+    removed: list[Activity] = [],
+    params: NeighbourhoodParams = NeighbourhoodParams(),
+    profile: int | None = None,
+) -> dict[Activity, list[Activity]]:
+    """
+    Updates a neighbourhood after a few clients or shipments were added,
+    removed, or modified. This is much faster than recomputing the full
+    neighbourhood using :func:`~compute_neighbours`, since only the
+    neighbourhoods that involve changed or removed activities are recomputed.
+    All other neighbourhoods only consider the changed activities as new
+    candidate neighbours.
+
+    .. note::
+
+       Changes to the vehicle types, or to the travel distances and durations
+       between unchanged activities, are not detected. The full neighbourhood
+       should be recomputed in that case.
+
+    Parameters
+    ----------
+    data
+        The new ProblemData instance.
+    neighbours
+        Neighbourhood computed for an earlier version of the data, using the
+        same parameters and profile.
+    changed
+        Client and shipment activities in the new data that were added or
+        modified. Clients and shipments that do not have a neighbourhood yet
+        are always considered added, so these need not be passed.
+    removed
+        Client and shipment activities of the earlier data that were removed.
+        Clients and shipments after a removed one are assumed to have shifted
+        down by one index in the new data. Default empty.
+    params
+        NeighbourhoodParams that define how the neighbourhood is computed.
+    profile
+        Optional routing profile. See :func:`~compute_neighbours` for details.
+
+    Returns
+    -------
+    dict
+        The updated neighbourhood for the new data. This equals the result of
+        :func:`~compute_neighbours` on the new data.
+    """
+    return _update_neighbours(
+        data, neighbours, changed, removed, params, profile
+    )
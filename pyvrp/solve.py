@@ -1,9 +1,12 @@
 from __future__ import annotations
 
 import tomllib
+from concurrent.futures import ThreadPoolExecutor
+from copy import deepcopy
 from typing import TYPE_CHECKING
 
 import pyvrp.search
+from pyvrp.GeneticAlgorithm import GeneticAlgorithm
 from pyvrp.IteratedLocalSearch import (
     IteratedLocalSearch,
     IteratedLocalSearchParams,
@@ -13,10 +16,14 @@ from pyvrp._pyvrp import ProblemData, RandomNumberGenerator, Solution
 from pyvrp.search import (
     OPERATORS,
     BinaryOperator,
+    GeneticAlgorithmParams,
     LocalSearch,
     NeighbourhoodParams,
+    OperatorSelectionParams,
     PerturbationManager,
     PerturbationParams,
+    RecreateMethod,
+    RuinMethod,
     UnaryOperator,
     compute_neighbours,
 )
@@ -25,12 +32,17 @@ if TYPE_CHECKING:
     import pathlib
 
     from pyvrp.Result import Result
+    from pyvrp.Statistics import Statistics
+    from pyvrp._pyvrp import Activity
     from pyvrp.stop import StoppingCriterion
 
+    Neighbours = dict[Activity, list[Activity]]
+
 
 class SolveParams:
     """
-    Solver parameters for PyVRP's iterated local search algorithm.
+    Solver parameters for PyVRP's iterated local search and genetic
+    algorithms.
 
     Parameters
     ----------
@@ -46,6 +58,11 @@ class SolveParams:
         Time (in seconds) between iteration logs. Default 5s.
     perturbation
         Perturbation parameters.
+    selection
+        Operator selection parameters.
+    genetic
+        Genetic algorithm parameters. When provided, the solver uses the
+        native genetic algorithm instead of the iterated local search.
     """
 
     def __init__(
@@ -56,6 +73,8 @@ class SolveParams:
         operators: list[type[UnaryOperator | BinaryOperator]] = OPERATORS,
         display_interval: float = 5.0,
         perturbation: PerturbationParams = PerturbationParams(),
+        selection: OperatorSelectionParams = OperatorSelectionParams(),
+        genetic: GeneticAlgorithmParams | None = None,
     ):
         self._ils = ils
         self._penalty = penalty
@@ -63,6 +82,8 @@ class SolveParams:
         self._operators = operators
         self._display_interval = display_interval
         self._perturbation = perturbation
+        self._selection = selection
+        self._genetic = genetic
 
     def __eq__(self, other: object) -> bool:
         return (
@@ -73,6 +94,8 @@ class SolveParams:
             and self.operators == other.operators
             and self.display_interval == other.display_interval
             and self.perturbation == other.perturbation
+            and self.selection == other.selection
+            and self.genetic == other.genetic
         )
 
     @property
@@ -99,6 +122,14 @@ class SolveParams:
     def perturbation(self):
         return self._perturbation
 
+    @property
+    def selection(self):
+        return self._selection
+
+    @property
+    def genetic(self):
+        return self._genetic
+
     @classmethod
     def from_file(cls, loc: str | pathlib.Path):
         """
@@ -111,13 +142,28 @@ class SolveParams:
         if "operators" in data:
             operators = [getattr(pyvrp.search, op) for op in data["operators"]]
 
+        perturbation = data.get("perturbation", {})
+        if "ruin_method" in perturbation:
+            method = perturbation["ruin_method"]
+            perturbation["ruin_method"] = getattr(RuinMethod, method)
+
+        if "recreate_method" in perturbation:
+            method = perturbation["recreate_method"]
+            perturbation["recreate_method"] = getattr(RecreateMethod, method)
+
+        genetic = None
+        if "genetic" in data:
+            genetic = GeneticAlgorithmParams(**data["genetic"])
+
         return cls(
             IteratedLocalSearchParams(**data.get("ils", {})),
             PenaltyParams(**data.get("penalty", {})),
             NeighbourhoodParams(**data.get("neighbourhood", {})),
             operators,
             data.get("display_interval", 5.0),
-            PerturbationParams(**data.get("perturbation", {})),
+            PerturbationParams(**perturbation),
+            OperatorSelectionParams(**data.get("selection", {})),
+            genetic,
         )
 
 
@@ -125,7 +171,7 @@ def solve(
     data: ProblemData,
     stop: StoppingCriterion,
     seed: int = 0,
-    collect_stats: bool = True,
+    collect_stats: bool | Statistics = True,
     display: bool = False,
     params: SolveParams = SolveParams(),
     initial_solution: Solution | None = None,
@@ -143,7 +189,9 @@ def solve(
         Seed value to use for the random number stream. Default 0.
     collect_stats
         Whether to collect statistics about the solver's progress. Default
-        ``True``.
+        ``True``. A :class:`~pyvrp.Statistics.Statistics` object may also be
+        passed, in which case statistics are collected into that object. This
+        allows configuring which iterations are recorded.
     display
         Whether to display information about the solver progress. Default
         ``False``. Progress information is only available when
@@ -160,24 +208,158 @@ def solve(
         A Result object, containing statistics (if collected) and the best
         found solution.
     """
-    rng = RandomNumberGenerator(seed=seed)
+    neighbours, profile_neighbours = _compute_neighbours(data, params)
+    return _solve(
+        data,
+        stop,
+        seed,
+        neighbours,
+        profile_neighbours,
+        collect_stats,
+        display,
+        params,
+        initial_solution,
+    )
+
+
+def solve_many(
+    data: ProblemData,
+    stop: StoppingCriterion,
+    seeds: list[int],
+    num_threads: int | None = None,
+    collect_stats: bool = True,
+    params: SolveParams = SolveParams(),
+) -> list[Result]:
+    """
+    Solves the given problem data instance once for each of the given seeds,
+    using multiple threads in a single process. This is more memory-efficient
+    than solving in separate processes, since all runs share the same problem
+    data and granular neighbourhood, which are computed only once.
+
+    Each run uses its own random number generator, seeded with the run's seed,
+    and its own copy of the stopping criterion. The local search releases the
+    GIL, so the runs proceed in parallel for most of their runtime. Each
+    run's result equals that of :func:`~pyvrp.solve.solve` with the same seed,
+    except for the runtime statistics.
+
+    .. note::
+
+       Any callbacks configured in the solver parameters are shared by all
+       runs, and may thus be called concurrently from multiple threads.
+
+    Parameters
+    ----------
+    data
+        Problem data instance to solve.
+    stop
+        Stopping criterion to use. Each run uses its own copy of this
+        criterion.
+    seeds
+        Seed values to use for the random number streams, one for each run.
+    num_threads
+        Maximum number of threads to use. If not provided, the default of
+        :class:`~concurrent.futures.ThreadPoolExecutor` is used.
+    collect_stats
+        Whether to collect statistics about the solver's progress. Default
+        ``True``.
+    params
+        Solver parameters to use. If not provided, a default will be used.
+
+    Returns
+    -------
+    list[Result]
+        The results of the runs, one for each seed, in the order of the given
+        seeds.
+    """
+    neighbours, profile_neighbours = _compute_neighbours(data, params)
+    stops = [deepcopy(stop) for _ in seeds]
+
+    def run(seed: int, stop: StoppingCriterion) -> Result:
+        return _solve(
+            data,
+            stop,
+            seed,
+            neighbours,
+            profile_neighbours,
+            collect_stats,
+            False,
+            params,
+            None,
+        )
+
+    with ThreadPoolExecutor(num_threads) as executor:
+        return list(executor.map(run, seeds, stops))
+
+
+def _compute_neighbours(
+    data: ProblemData,
+    params: SolveParams,
+) -> tuple[Neighbours, list[Neighbours] | None]:
     neighbours = compute_neighbours(data, params.neighbourhood)
-    perturbation = PerturbationManager(params.perturbation)
-    ls = LocalSearch(data, rng, neighbours, perturbation)
 
-    for op in params.operators:
-        if op.supports(data):
-            ls.add_operator(op(data))
+    profile_neighbours = None
+    if params.neighbourhood.per_profile and data.num_profiles > 1:
+        profile_neighbours = [
+            compute_neighbours(data, params.neighbourhood, profile)
+            for profile in range(data.num_profiles)
+        ]
+
+    return neighbours, profile_neighbours
+
+
+def _solve(
+    data: ProblemData,
+    stop: StoppingCriterion,
+    seed: int,
+    neighbours: Neighbours,
+    profile_neighbours: list[Neighbours] | None,
+    collect_stats: bool | Statistics,
+    display: bool,
+    params: SolveParams,
+    initial_solution: Solution | None,
+) -> Result:
+    rng = RandomNumberGenerator(seed=seed)
+
+    def make_search() -> LocalSearch:
+        perturbation = PerturbationManager(params.perturbation)
+        ls = LocalSearch(data, rng, neighbours, perturbation, params.selection)
+
+        if profile_neighbours is not None:
+            ls.profile_neighbours = profile_neighbours
+
+        for op in params.operators:
+            if op.supports(data):
+                ls.add_operator(op(data))
+
+        return ls
+
+    ls = make_search()
 
     penalties = params.penalty.midpoint_penalties(data)
     pm = PenaltyManager(penalties, params.penalty)
 
-    init = initial_solution
-    if init is None:
+    def make_random() -> Solution:
         # Start from a random initial solution to ensure it's not completely
         # empty (because starting from empty solutions can be a bit difficult).
         random = Solution.make_random(data, rng)
-        init = ls(random, pm.max_cost_evaluator(), exhaustive=True)
+        return ls(random, pm.max_cost_evaluator(), exhaustive=True)
+
+    init = initial_solution
+    if init is None:
+        init = make_random()
+
+    if params.genetic is not None:
+        # The genetic algorithm educates offspring in parallel. Each thread
+        # needs its own local search, with its own operators.
+        genetic = params.genetic
+        searches = [ls]
+        searches += [make_search() for _ in range(genetic.num_threads - 1)]
+
+        population = [init]
+        population += [make_random() for _ in range(genetic.min_pop_size - 1)]
+
+        ga = GeneticAlgorithm(data, pm, rng, searches, population, genetic)
+        return ga.run(stop, collect_stats, display, params.display_interval)
 
     algo = IteratedLocalSearch(data, pm, ls, init, params.ils)
     return algo.run(stop, collect_stats, display, params.display_interval)
@@ -1,6 +1,6 @@
-from .FirstFeasible import FirstFeasible as FirstFeasible
-from .MaxIterations import MaxIterations as MaxIterations
-from .MaxRuntime import MaxRuntime as MaxRuntime
-from .MultipleCriteria import MultipleCriteria as MultipleCriteria
-from .NoImprovement import NoImprovement as NoImprovement
+from ._stop import FirstFeasible as FirstFeasible
+from ._stop import MaxIterations as MaxIterations
+from ._stop import MaxRuntime as MaxRuntime
+from ._stop import MultipleCriteria as MultipleCriteria
+from ._stop import NoImprovement as NoImprovement
 from .StoppingCriterion import StoppingCriterion as StoppingCriterion
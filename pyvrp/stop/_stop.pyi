@@ -0,0 +1,46 @@
+from typing import Callable
+
+class StoppingCriterion:
+    def __call__(self, best_cost: int) -> bool: ...
+    def __or__(
+        self,
+        other: StoppingCriterion | Callable[[int], bool],
+    ) -> MultipleCriteria: ...
+    def __and__(
+        self,
+        other: StoppingCriterion | Callable[[int], bool],
+    ) -> MultipleCriteria: ...
+    def __copy__(self) -> StoppingCriterion: ...
+    def __deepcopy__(self, memo: dict) -> StoppingCriterion: ...
+
+class FirstFeasible(StoppingCriterion):
+    def __init__(self) -> None: ...
+
+class MaxIterations(StoppingCriterion):
+    def __init__(self, max_iterations: float) -> None: ...
+
+class MaxRuntime(StoppingCriterion):
+    def __init__(
+        self,
+        max_runtime: float,
+        check_interval: int = 1,
+    ) -> None: ...
+
+class NoImprovement(StoppingCriterion):
+    def __init__(self, max_iterations: float) -> None: ...
+
+class MultipleCriteria(StoppingCriterion):
+    def __init__(
+        self,
+        criteria: list[StoppingCriterion | Callable[[int], bool]],
+        require_all: bool = False,
+    ) -> None: ...
+    @property
+    def criteria(self) -> list[StoppingCriterion | Callable[[int], bool]]: ...
+    @criteria.setter
+    def criteria(
+        self,
+        criteria: list[StoppingCriterion | Callable[[int], bool]],
+    ) -> None: ...
+    @property
+    def require_all(self) -> bool: ...
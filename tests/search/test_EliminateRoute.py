@@ -0,0 +1,70 @@
+from numpy.testing import assert_, assert_equal
+
+from pyvrp import CostEvaluator, RandomNumberGenerator, Solution, VehicleType
+from pyvrp.search import EliminateRoute, LocalSearch, compute_neighbours
+from tests.helpers import make_search_route
+
+
+def test_cannot_evaluate_without_local_search(ok_small):
+    """
+    Tests that EliminateRoute needs the granular neighbourhood of a local
+    search, and thus cannot evaluate moves when used on its own.
+    """
+    route = make_search_route(ok_small, ["C0", "C1"])
+    cost_eval = CostEvaluator([0], 0, 0)
+
+    op = EliminateRoute(ok_small)
+    assert_equal(op.evaluate(route[1], cost_eval), (0, False))
+
+
+def test_supports(ok_small):
+    """
+    Tests that EliminateRoute supports instances with more than one vehicle.
+    """
+    assert_(EliminateRoute.supports(ok_small))
+
+    veh_type = ok_small.vehicle_type(0).replace(num_available=1)
+    data = ok_small.replace(vehicle_types=[veh_type])
+    assert_(not EliminateRoute.supports(data))
+
+
+def test_eliminates_routes_with_high_fixed_cost(ok_small):
+    """
+    Tests that EliminateRoute empties routes when the fixed vehicle cost saved
+    outweighs the cost of relocating the route's clients.
+    """
+    veh_type = VehicleType(4, capacity=[10], fixed_cost=100_000)
+    data = ok_small.replace(vehicle_types=[veh_type])
+
+    rng = RandomNumberGenerator(seed=42)
+    ls = LocalSearch(data, rng, compute_neighbours(data))
+    ls.add_operator(EliminateRoute(data))
+
+    sol = Solution(data, [[0], [1], [2], [3]])
+    cost_eval = CostEvaluator([0], 0, 0)
+    improved = ls(sol, cost_eval, exhaustive=True)
+
+    # Each client is relocated into a different route. Starting with a client
+    # in each route, that should empty at least two of the routes.
+    assert_(improved.num_routes() <= 2)
+    assert_(improved.is_complete())
+    assert_(cost_eval.penalised_cost(improved) < cost_eval.penalised_cost(sol))
+
+
+def test_does_not_eliminate_routes_if_not_improving(ok_small):
+    """
+    Tests that EliminateRoute does not empty routes when relocating the
+    route's clients is more expensive than keeping the route.
+    """
+    veh_type = VehicleType(4, capacity=[5])
+    data = ok_small.replace(vehicle_types=[veh_type])
+
+    rng = RandomNumberGenerator(seed=42)
+    ls = LocalSearch(data, rng, compute_neighbours(data))
+    ls.add_operator(EliminateRoute(data))
+
+    # Each route is fully loaded, so relocating any client results in a lot of
+    # excess load. That is not worth the saved distance.
+    sol = Solution(data, [[0], [1], [2], [3]])
+    cost_eval = CostEvaluator([100_000], 0, 0)
+    assert_equal(ls(sol, cost_eval, exhaustive=True), sol)
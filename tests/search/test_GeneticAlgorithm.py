@@ -0,0 +1,188 @@
+import pytest
+from numpy.testing import assert_, assert_allclose, assert_equal, assert_raises
+
+from pyvrp import CostEvaluator, RandomNumberGenerator, Solution
+from pyvrp.search import (
+    GeneticAlgorithmParams,
+    NeighbourhoodParams,
+    SwapTails,
+    broken_pairs_distance,
+    compute_neighbours,
+    srex,
+)
+from pyvrp.search._search import GeneticAlgorithm
+from pyvrp.search._search import LocalSearch as _LocalSearch
+from tests.helpers import read_solution
+
+
+@pytest.mark.parametrize(
+    ("min_pop_size", "num_elite", "num_close", "num_threads"),
+    [
+        (0, 0, 5, 1),  # min_pop_size must be positive
+        (4, 5, 5, 1),  # num_elite cannot exceed min_pop_size
+        (25, 4, 0, 1),  # num_close must be positive
+        (25, 4, 5, 0),  # num_threads must be positive
+    ],
+)
+def test_params_raises_invalid_values(
+    min_pop_size: int,
+    num_elite: int,
+    num_close: int,
+    num_threads: int,
+):
+    """
+    Tests that the genetic algorithm parameters are validated.
+    """
+    with assert_raises(ValueError):
+        GeneticAlgorithmParams(
+            min_pop_size,
+            num_elite=num_elite,
+            num_close=num_close,
+            num_threads=num_threads,
+        )
+
+
+def test_params_default_values():
+    """
+    Tests that the genetic algorithm parameters have the expected defaults.
+    """
+    params = GeneticAlgorithmParams()
+    assert_equal(params.min_pop_size, 25)
+    assert_equal(params.generation_size, 40)
+    assert_equal(params.num_elite, 4)
+    assert_equal(params.num_close, 5)
+    assert_equal(params.num_threads, 1)
+    assert_equal(params, GeneticAlgorithmParams())
+
+
+def test_broken_pairs_distance(ok_small):
+    """
+    Tests the broken pairs distance on a few small solutions of the OkSmall
+    instance.
+    """
+    sol1 = Solution(ok_small, [[0, 1, 2, 3]])
+    sol2 = Solution(ok_small, [[0, 1], [2, 3]])
+    sol3 = Solution(ok_small, [[3, 2, 1, 0]])
+
+    # The distance is zero for equal solutions, and symmetric otherwise.
+    assert_allclose(broken_pairs_distance(ok_small, sol1, sol1), 0.0)
+    assert_allclose(
+        broken_pairs_distance(ok_small, sol1, sol2),
+        broken_pairs_distance(ok_small, sol2, sol1),
+    )
+
+    # Splitting the single route changes the successor of client 1 and the
+    # predecessor of client 2, which is two of the eight pairs.
+    assert_allclose(broken_pairs_distance(ok_small, sol1, sol2), 2 / 8)
+
+    # Reversing the route changes all predecessors and successors.
+    assert_allclose(broken_pairs_distance(ok_small, sol1, sol3), 1.0)
+
+
+def test_srex_same_parents(ok_small):
+    """
+    Tests that crossover of a solution with itself returns that solution.
+    """
+    sol = Solution(ok_small, [[0, 1], [2, 3]])
+    cost_eval = CostEvaluator([20], 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    for _ in range(10):
+        assert_equal(srex(sol, sol, ok_small, cost_eval, rng), sol)
+
+
+def test_srex_empty_parent(ok_small):
+    """
+    Tests that crossover with an empty parent returns the other parent.
+    """
+    empty = Solution(ok_small, [])
+    sol = Solution(ok_small, [[0, 1], [2, 3]])
+    cost_eval = CostEvaluator([20], 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    assert_equal(srex(empty, sol, ok_small, cost_eval, rng), sol)
+    assert_equal(srex(sol, empty, ok_small, cost_eval, rng), sol)
+
+
+def test_srex_different_parents(rc208):
+    """
+    Tests that crossover of two different parents returns a valid solution,
+    which may have some unplanned clients that the local search later inserts
+    again.
+    """
+    bks = read_solution("data/RC208.sol", rc208)
+    cost_eval = CostEvaluator([20], 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    for _ in range(10):
+        other = Solution.make_random(rc208, rng)
+        offspring = srex(bks, other, rc208, cost_eval, rng)
+
+        num_clients = offspring.num_clients()
+        num_unplanned = len(offspring.unplanned())
+        assert_(num_clients > 0)
+        assert_equal(num_clients + num_unplanned, rc208.num_clients)
+
+
+def test_step_raises_empty_population(ok_small):
+    """
+    Tests that performing a generation raises when the population is empty.
+    """
+    neighbours = compute_neighbours(ok_small, NeighbourhoodParams())
+    ls = _LocalSearch(ok_small, neighbours)
+    algo = GeneticAlgorithm(ok_small, [ls])
+
+    cost_eval = CostEvaluator([20], 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    with assert_raises(RuntimeError):
+        algo.step(cost_eval, rng)
+
+
+def test_raises_wrong_number_of_searches(ok_small):
+    """
+    Tests that the genetic algorithm requires exactly one local search for
+    each thread.
+    """
+    neighbours = compute_neighbours(ok_small, NeighbourhoodParams())
+    ls = _LocalSearch(ok_small, neighbours)
+
+    with assert_raises(ValueError):
+        GeneticAlgorithm(ok_small, [ls], GeneticAlgorithmParams(num_threads=2))
+
+    with assert_raises(ValueError):  # searches must be distinct objects
+        GeneticAlgorithm(
+            ok_small,
+            [ls, ls],
+            GeneticAlgorithmParams(num_threads=2),
+        )
+
+
+def test_population_size_is_bounded(rc208):
+    """
+    Tests that survivor selection keeps the number of solutions in each
+    subpopulation between the minimum population size and the minimum plus
+    the generation size, and that each generation returns one educated,
+    complete offspring for each thread.
+    """
+    neighbours = compute_neighbours(rc208, NeighbourhoodParams())
+    searches = [_LocalSearch(rc208, neighbours) for _ in range(2)]
+    for ls in searches:
+        ls.add_operator(SwapTails(rc208))
+
+    params = GeneticAlgorithmParams(5, 4, 2, 3, num_threads=2)
+    algo = GeneticAlgorithm(rc208, searches, params)
+
+    cost_eval = CostEvaluator([20], 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    for _ in range(10):
+        algo.add(Solution.make_random(rc208, rng), cost_eval)
+
+    for _ in range(10):
+        offspring = algo.step(cost_eval, rng)
+        assert_equal(len(offspring), 2)
+        assert_(all(sol.is_complete() for sol in offspring))
+
+        for size in [algo.num_feasible(), algo.num_infeasible()]:
+            assert_(size <= params.min_pop_size + params.generation_size)
@@ -2,7 +2,7 @@ import logging
 
 import numpy as np
 import pytest
-from numpy.testing import assert_, assert_equal
+from numpy.testing import assert_, assert_equal, assert_raises
 
 from pyvrp import (
     Activity,
@@ -11,6 +11,7 @@ from pyvrp import (
     CostEvaluator,
     Depot,
     Location,
+    PiecewiseLinearFunction,
     ProblemData,
     RandomNumberGenerator,
     Route,
@@ -20,6 +21,8 @@ from pyvrp import (
 from pyvrp.search import (
     InsertOptionalClient,
     LocalSearch,
+    NeighbourhoodParams,
+    OperatorSelectionParams,
     PerturbationManager,
     PerturbationParams,
     Relocate1,
@@ -464,6 +467,187 @@ def test_search_statistics(ok_small):
     assert_equal(stats.num_updates, 0)
 
 
+def test_per_operator_statistics(ok_small, tmp_path):
+    """
+    Tests that the local search statistics include a per-operator breakdown,
+    and that this breakdown can be written to a CSV file.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    ls = LocalSearch(ok_small, rng, compute_neighbours(ok_small))
+
+    relocate = Relocate1(ok_small)
+    swap = Swap11(ok_small)
+    ls.add_operator(relocate)
+    ls.add_operator(swap)
+
+    sol = Solution.make_random(ok_small, rng)
+    cost_eval = CostEvaluator([20], 6, 0)
+    improved = ls(sol, cost_eval, exhaustive=True)
+
+    # There should be one entry per operator, and these should match what the
+    # operators themselves track.
+    stats = ls.statistics
+    assert_equal(len(stats.operators), 2)
+
+    by_name = dict(stats.operators)
+    assert_equal(set(by_name.keys()), {relocate.name, swap.name})
+
+    for op in (relocate, swap):
+        op_stats = by_name[op.name]
+        assert_equal(op_stats.num_evaluations, op.statistics.num_evaluations)
+        assert_equal(op_stats.num_applications, op.statistics.num_applications)
+        assert_(op_stats.evaluate_time >= 0)
+        assert_(op_stats.apply_time >= 0)
+        assert_(op_stats.update_time >= 0)
+
+    # Each applied move is improving, so the summed improving deltas should
+    # explain the full cost difference between the two solutions.
+    total_delta = sum(s.improving_delta for s in by_name.values())
+    before = cost_eval.penalised_cost(sol)
+    after = cost_eval.penalised_cost(improved)
+    assert_equal(after - before, total_delta)
+
+    # Writing the statistics to CSV should result in one row per operator,
+    # plus a header.
+    where = tmp_path / "operators.csv"
+    ls.statistics_to_csv(where)
+
+    with open(where) as fh:
+        lines = fh.read().splitlines()
+
+    assert_equal(len(lines), 3)
+    assert_(lines[0].startswith("operator,num_evaluations,num_applications"))
+
+
+def test_lower_bound_skips_moves(rc208):
+    """
+    Tests that the local search skips moves between routes whose distance-based
+    lower bound shows they cannot be improving, and that skipping these moves
+    does not prevent the search from finding a local optimum.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    ls = LocalSearch(
+        rc208,
+        rng,
+        compute_neighbours(rc208),
+        PerturbationManager(PerturbationParams(0, 0)),  # disable perturbation
+    )
+
+    relocate = Relocate1(rc208)
+    swap = Swap11(rc208)
+    ls.add_operator(relocate)
+    ls.add_operator(swap)
+
+    sol = Solution.make_random(rc208, rng)
+    cost_eval = CostEvaluator([20], 6, 0)
+    improved = ls(sol, cost_eval, exhaustive=True)
+
+    # Most moves between routes are poor, and should be skipped based on their
+    # lower bound. Skipped moves are not counted as evaluations.
+    assert_(relocate.statistics.num_skips > 0)
+    assert_(swap.statistics.num_skips > 0)
+    num_evals = sum(op.statistics.num_evaluations for op in (relocate, swap))
+    assert_equal(ls.statistics.num_moves, num_evals)
+
+    # The skipped moves cannot be improving, so the improved solution should be
+    # a local optimum: another search should not find any improving moves.
+    ls(improved, cost_eval, exhaustive=True)
+    assert_equal(ls.statistics.num_improving, 0)
+
+
+@pytest.mark.parametrize(
+    ("decay", "min_probability"),
+    [
+        (-0.1, 0.1),  # decay < 0
+        (1.0, 0.1),  # decay >= 1
+        (0.8, 0.0),  # min_probability <= 0
+        (0.8, 1.1),  # min_probability > 1
+    ],
+)
+def test_operator_selection_params_raises_invalid(
+    decay: float,
+    min_probability: float,
+):
+    """
+    Tests that the operator selection parameters raise when given invalid
+    decay or minimum probability arguments.
+    """
+    with assert_raises(ValueError):
+        OperatorSelectionParams(True, decay, min_probability)
+
+
+def test_operator_selection_params_eq():
+    """
+    Tests OperatorSelectionParams's ``__eq__`` implementation.
+    """
+    params = OperatorSelectionParams()
+    assert_(params == OperatorSelectionParams())
+    assert_(params != OperatorSelectionParams(adaptive=True))
+    assert_(params != OperatorSelectionParams(decay=0.5))
+    assert_(params != "")
+
+
+def test_adaptive_operator_selection(rc208):
+    """
+    Tests that local search with adaptive operator selection still improves
+    solutions, and that it throttles operators that do not find improving
+    moves.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    neighbours = compute_neighbours(rc208)
+    params = OperatorSelectionParams(adaptive=True, decay=0)
+    ls = LocalSearch(rc208, rng, neighbours, selection_params=params)
+
+    relocate = Relocate1(rc208)
+    remove = RemoveOptionalClient(rc208)  # all clients are required in RC208,
+    ls.add_operator(relocate)  # so this operator never finds improvements.
+    ls.add_operator(remove)
+
+    cost_eval = CostEvaluator([20], 6, 0)
+    sol = Solution.make_random(rc208, rng)
+    improved = ls(sol, cost_eval, exhaustive=True)
+    assert_(cost_eval.penalised_cost(improved) < cost_eval.penalised_cost(sol))
+
+    # The remove operator never finds improving moves, so it should get the
+    # minimum score, and thus be skipped in most subsequent searches.
+    num_used = 0
+    for _ in range(50):
+        improved = ls(improved, cost_eval)
+        num_used += remove.statistics.num_evaluations > 0
+
+    assert_(num_used < 25)
+
+
+def test_profile_neighbours(ok_small_two_profiles):
+    """
+    Tests that local search with per-profile neighbourhoods still improves
+    solutions.
+    """
+    data = ok_small_two_profiles
+    rng = RandomNumberGenerator(seed=42)
+    neighbours = compute_neighbours(data)
+
+    ls = LocalSearch(data, rng, neighbours)
+    ls.add_operator(Relocate1(data))
+    assert_equal(ls.profile_neighbours, [])
+
+    params = NeighbourhoodParams(num_neighbours=3)
+    ls.profile_neighbours = [
+        compute_neighbours(data, params, profile)
+        for profile in range(data.num_profiles)
+    ]
+    assert_equal(len(ls.profile_neighbours), data.num_profiles)
+
+    cost_eval = CostEvaluator([20], 6, 0)
+    sol = Solution.make_random(data, rng)
+    improved = ls(sol, cost_eval, exhaustive=True)
+    assert_(cost_eval.penalised_cost(improved) < cost_eval.penalised_cost(sol))
+
+    # Setting an empty list disables per-profile neighbourhoods again.
+    ls.profile_neighbours = []
+    assert_equal(ls.profile_neighbours, [])
+
+
 def test_operators_property(ok_small):
     """
     Tests adding and accessing operators to the LocalSearch object.
@@ -763,3 +947,116 @@ def test_shipment_improves_over_random(small_shipments):
     improved_cost = cost_eval.penalised_cost(improved)
     rnd_cost = cost_eval.penalised_cost(rnd_sol)
     assert_(improved_cost < rnd_cost)
+
+
+def test_search_around_inserts_new_clients(ok_small):
+    """
+    Tests that searching around the activities of newly added clients inserts
+    those clients into an existing solution.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    cost_eval = CostEvaluator([20], 6, 0)
+
+    ls = LocalSearch(ok_small, rng, compute_neighbours(ok_small))
+    ls.add_operator(Relocate1(ok_small))
+    sol = ls(Solution.make_random(ok_small, rng), cost_eval, exhaustive=True)
+
+    # Add a new required client at the location of client 2, and re-optimise
+    # the existing solution around this new client.
+    clients = ok_small.clients()
+    clients.append(clients[2])
+    data = ok_small.replace(clients=clients)
+
+    routes = [
+        [act.idx for act in route.activities() if act.is_client()]
+        for route in sol.routes()
+    ]
+    init = Solution(data, routes)
+    assert_(not init.is_complete())
+
+    ls = LocalSearch(data, rng, compute_neighbours(data))
+    ls.add_operator(Relocate1(data))
+
+    improved = ls.search_around(init, cost_eval, [Activity("C4")])
+    assert_(improved.is_complete())
+    assert_(improved.is_feasible())
+
+
+def test_search_around_raises_invalid_activities(ok_small):
+    """
+    Tests that searching around depots or unknown activities raises.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    ls = LocalSearch(ok_small, rng, compute_neighbours(ok_small))
+    ls.add_operator(Relocate1(ok_small))
+
+    sol = Solution.make_random(ok_small, rng)
+    cost_eval = CostEvaluator([20], 6, 0)
+
+    with assert_raises(ValueError):
+        ls.search_around(sol, cost_eval, [Activity("D0")])
+
+    with assert_raises(IndexError):
+        ls.search_around(sol, cost_eval, [Activity("C4")])
+
+
+def test_search_trades_distance_against_lateness():
+    """
+    Tests that the local search accounts for lateness costs when evaluating
+    moves, and accepts a longer route when that reduces lateness costs enough.
+    """
+    matrix = np.array(
+        [
+            [0, 10, 12],
+            [12, 0, 10],
+            [10, 12, 0],
+        ]
+    )
+
+    # Visiting client 0 first is shortest (distance 30), but then client 1 is
+    # visited at time 20. Visiting client 1 first is longer (distance 36), but
+    # then client 1 is visited at time 12.
+    lateness = PiecewiseLinearFunction([(0, 0), (15, 0), (16, 10)])
+    data = ProblemData(
+        locations=[Location(0, 0), Location(1, 1), Location(2, 2)],
+        clients=[Client(location=1), Client(location=2)],
+        depots=[Depot(location=0)],
+        vehicle_types=[VehicleType()],
+        distance_matrices=[matrix],
+        duration_matrices=[matrix],
+    )
+
+    rng = RandomNumberGenerator(seed=42)
+    cost_eval = CostEvaluator([], 0, 0)
+
+    def visits(sol: Solution) -> list[int]:
+        activities = sol.routes()[0].activities()
+        return [act.idx for act in activities if act.is_client()]
+
+    ls = LocalSearch(data, rng, compute_neighbours(data))
+    ls.add_operator(Relocate1(data))
+    ls.add_operator(Swap11(data))
+
+    # Without lateness costs, the shortest route is optimal.
+    sol = ls(Solution(data, [[1, 0]]), cost_eval, exhaustive=True)
+    assert_equal(visits(sol), [0, 1])
+    assert_equal(sol.distance(), 30)
+
+    # With a large lateness cost for client 1, visiting client 1 after client
+    # 0 costs 50 in lateness. It is better to visit client 1 first.
+    clients = [Client(location=1), Client(location=2, lateness_cost=lateness)]
+    late = data.replace(clients=clients)
+    assert_(late.has_lateness_costs())
+
+    ls = LocalSearch(late, rng, compute_neighbours(late))
+    ls.add_operator(Relocate1(late))
+    ls.add_operator(Swap11(late))
+
+    init = Solution(late, [[0, 1]])
+    assert_equal(init.lateness_cost(), 50)
+
+    sol = ls(init, cost_eval, exhaustive=True)
+    assert_equal(visits(sol), [1, 0])
+    assert_equal(sol.distance(), 36)
+    assert_equal(sol.lateness_cost(), 0)
+    assert_(cost_eval.penalised_cost(sol) < cost_eval.penalised_cost(init))
@@ -1,3 +1,4 @@
+import pytest
 from numpy.testing import assert_, assert_allclose, assert_equal, assert_raises
 
 import pyvrp
@@ -5,6 +6,8 @@ from pyvrp import Activity, CostEvaluator, RandomNumberGenerator
 from pyvrp.search import (
     PerturbationManager,
     PerturbationParams,
+    RecreateMethod,
+    RuinMethod,
     compute_neighbours,
 )
 from pyvrp.search._search import SearchSpace, Solution
@@ -21,6 +24,29 @@ def test_raises_max_smaller_than_min():
     PerturbationParams(0, 0)  # but min == max should be fine
 
 
+@pytest.mark.parametrize(
+    ("max_string_length", "blink_rate"),
+    [
+        (0, 0.01),  # max_string_length must be positive
+        (10, -0.1),  # blink_rate cannot be negative
+        (10, 1.0),  # blink_rate must be smaller than one
+    ],
+)
+def test_raises_invalid_ruin_recreate_values(
+    max_string_length: int,
+    blink_rate: float,
+):
+    """
+    Tests that the PerturbationParams's constructor raises when the ruin and
+    recreate arguments are invalid.
+    """
+    with assert_raises(ValueError):
+        PerturbationParams(
+            max_string_length=max_string_length,
+            blink_rate=blink_rate,
+        )
+
+
 def test_eq():
     """
     Tests that PerturbationParams's ``__eq__`` implementation is correct.
@@ -28,6 +54,8 @@ def test_eq():
     params = PerturbationParams()
     assert_(params == PerturbationParams())
     assert_(params != PerturbationParams(1, 10))
+    assert_(params != PerturbationParams(ruin_method=RuinMethod.STRINGS))
+    assert_(params != PerturbationParams(blink_rate=0.5))
 
     assert_(params != "")
     assert_(params != 123)
@@ -52,6 +80,39 @@ def test_shuffle():
         assert_equal(manager.num_perturbations(), 0)
 
 
+@pytest.mark.parametrize(
+    ("ruin_method", "recreate_method", "draws_seed"),
+    [
+        (RuinMethod.NEIGHBOURHOOD, RecreateMethod.GREEDY, False),
+        (RuinMethod.NEIGHBOURHOOD, RecreateMethod.BLINK, True),
+        (RuinMethod.STRINGS, RecreateMethod.GREEDY, True),
+        (RuinMethod.WORST, RecreateMethod.GREEDY, True),
+    ],
+)
+def test_shuffle_draws_seed_only_when_needed(
+    ruin_method: RuinMethod,
+    recreate_method: RecreateMethod,
+    draws_seed: bool,
+):
+    """
+    Tests that shuffling only draws a seed for the ruin and recreate methods
+    that need random numbers, so the default configuration does not consume
+    any more random numbers than just the number of perturbations.
+    """
+    params = PerturbationParams(1, 10, ruin_method, recreate_method)
+    manager = PerturbationManager(params)
+
+    rng = RandomNumberGenerator(seed=42)
+    manager.shuffle(rng)
+
+    expected = RandomNumberGenerator(seed=42)
+    expected.randint(10)
+    if draws_seed:
+        expected()
+
+    assert_equal(rng.state(), expected.state())
+
+
 def test_num_perturbations_randomness():
     """
     Tests the bounds and randomness of repeated shuffles.
@@ -267,3 +328,68 @@ def test_perturb_shipment_empty_route(small_shipments):
     perturbed = sol.unload()
     assert_equal(perturbed.num_shipments(), 4)
     assert_(perturbed.is_complete())
+
+
+@pytest.mark.parametrize("ruin_method", [RuinMethod.STRINGS, RuinMethod.WORST])
+@pytest.mark.parametrize(
+    "recreate_method",
+    [RecreateMethod.GREEDY, RecreateMethod.BLINK, RecreateMethod.REGRET],
+)
+def test_ruin_and_recreate(
+    ok_small,
+    ruin_method: RuinMethod,
+    recreate_method: RecreateMethod,
+):
+    """
+    Tests that the ruin and recreate methods remove clients, and then insert
+    them again, marking the affected clients as promising.
+    """
+    sol = Solution(ok_small)
+    sol.load(pyvrp.Solution(ok_small, [[0, 1], [2, 3]]))
+
+    search_space = SearchSpace(ok_small, compute_neighbours(ok_small))
+    cost_eval = CostEvaluator([20], 6, 0)
+
+    params = PerturbationParams(2, 2, ruin_method, recreate_method)
+    perturbation = PerturbationManager(params)
+    perturbation.perturb(sol, search_space, cost_eval)
+
+    # All removed clients should have been inserted again, so the perturbed
+    # solution is still complete. The removed clients are promising.
+    perturbed = sol.unload()
+    assert_(perturbed.is_complete())
+
+    clients = [Activity(f"C{idx}") for idx in range(ok_small.num_clients)]
+    num_promising = sum(search_space.is_promising(act) for act in clients)
+    assert_(num_promising >= 1)
+
+
+@pytest.mark.parametrize("ruin_method", [RuinMethod.STRINGS, RuinMethod.WORST])
+def test_ruin_and_recreate_shipments(small_shipments, ruin_method: RuinMethod):
+    """
+    Tests that the ruin and recreate methods remove and insert pickups and
+    deliveries together.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    rnd_sol = pyvrp.Solution.make_random(small_shipments, rng)
+
+    sol = Solution(small_shipments)
+    sol.load(rnd_sol)
+
+    neighbours = compute_neighbours(small_shipments)
+    search_space = SearchSpace(small_shipments, neighbours)
+    cost_eval = CostEvaluator([1], 1, 0)
+
+    params = PerturbationParams(4, 4, ruin_method, RecreateMethod.REGRET)
+    perturbation = PerturbationManager(params)
+
+    for _ in range(5):
+        perturbation.shuffle(rng)
+        search_space.shuffle(rng)
+        perturbation.perturb(sol, search_space, cost_eval)
+
+        # Every shipment should still be planned, since all removed shipments
+        # are inserted again.
+        perturbed = sol.unload()
+        assert_(perturbed.is_complete())
+        assert_equal(perturbed.num_shipments(), 4)
@@ -8,9 +8,11 @@ from pyvrp import (
     Client,
     Depot,
     Location,
+    PiecewiseLinearFunction,
     ProblemData,
     VehicleType,
 )
+from pyvrp import Route as SolRoute
 from pyvrp.search._search import Node, Route
 from tests.helpers import make_search_route
 
@@ -1029,6 +1031,53 @@ def test_multi_trip_with_release_times():
     assert_equal(after.time_warp(), 0)
 
 
+
+def test_multi_trip_lateness_cost():
+    """
+    Tests that the search route evaluates lateness costs on the same schedule
+    as ``pyvrp::Route``, also when the route consists of multiple trips with
+    binding release times.
+    """
+    matrix = [
+        [0, 30, 20, 40],
+        [0, 0, 10, 0],
+        [5, 0, 0, 0],
+        [10, 0, 0, 0],
+    ]
+
+    cost = PiecewiseLinearFunction([(0, 0), (85, 0), (86, 2)])
+    data = ProblemData(
+        locations=[Location(0, 0) for _ in range(4)],
+        clients=[
+            Client(
+                loc,
+                tw_early=early,
+                tw_late=late,
+                release_time=release,
+                lateness_cost=cost,
+            )
+            for loc, early, late, release in [
+                (1, 60, 100, 40),
+                (2, 70, 90, 50),
+                (3, 80, 150, 100),
+            ]
+        ],
+        depots=[Depot(0)],
+        vehicle_types=[VehicleType(reload_depots=[0])],
+        distance_matrices=[matrix],
+        duration_matrices=[matrix],
+    )
+
+    # Service starts at 80, 90, and 140, respectively. The first client is
+    # served in time, but the second and third are late by 5 and 55, at a cost
+    # of two per unit of lateness.
+    route = make_search_route(data, ["C0", "C1", "D0", "C2"])
+    assert_equal(route.lateness_cost(), 120)
+
+    activities = [Activity(desc) for desc in ["C0", "C1", "D0", "C2"]]
+    assert_equal(SolRoute(data, activities, 0).lateness_cost(), 120)
+
+
 def test_multi_trip_duration_caches(ok_small_multiple_trips):
     """
     Tests that the route duration caches correctly account for reload depots.
@@ -228,3 +228,57 @@ def test_raises_neighbourhood_keys_other_than_clients_pickups(small_shipments):
 
     with assert_raises(RuntimeError):
         SearchSpace(small_shipments, neighbours)
+
+
+def test_profile_neighbours(ok_small_two_profiles):
+    """
+    Tests setting and getting per-profile neighbourhoods.
+    """
+    data = ok_small_two_profiles
+    neighbours = compute_neighbours(data)
+    search_space = SearchSpace(data, neighbours)
+
+    # Per-profile neighbourhoods are not set by default, in which case the
+    # regular neighbourhood is used for every profile.
+    assert_(not search_space.has_profile_neighbours())
+    assert_equal(search_space.profile_neighbours, [])
+
+    act = Activity("C0")
+    assert_equal(search_space.neighbours_of(act, 1), neighbours[act])
+
+    # Now we set one neighbourhood for each profile. These should then be
+    # returned for the corresponding profile.
+    profile_neighbours = [
+        {act: list(reversed(vs)) for act, vs in neighbours.items()},
+        neighbours,
+    ]
+
+    search_space.profile_neighbours = profile_neighbours
+    assert_(search_space.has_profile_neighbours())
+    assert_equal(search_space.profile_neighbours, profile_neighbours)
+    for profile, expected in enumerate(profile_neighbours):
+        assert_equal(search_space.neighbours_of(act, profile), expected[act])
+
+    # The regular neighbourhood should not have changed.
+    assert_equal(search_space.neighbours_of(act), neighbours[act])
+
+    # Setting an empty list disables per-profile neighbourhoods again.
+    search_space.profile_neighbours = []
+    assert_(not search_space.has_profile_neighbours())
+
+
+def test_profile_neighbours_raises_wrong_number_of_profiles(
+    ok_small_two_profiles,
+):
+    """
+    Tests that setting per-profile neighbourhoods raises when the number of
+    neighbourhoods does not match the number of profiles.
+    """
+    neighbours = compute_neighbours(ok_small_two_profiles)
+    search_space = SearchSpace(ok_small_two_profiles, neighbours)
+
+    with assert_raises(RuntimeError):
+        search_space.profile_neighbours = [neighbours]
+
+    with assert_raises(RuntimeError):
+        search_space.profile_neighbours = [neighbours, neighbours, neighbours]
@@ -1,7 +1,14 @@
+import pytest
 from numpy.testing import assert_, assert_equal
 
 import pyvrp
-from pyvrp import Activity, Client, CostEvaluator, RandomNumberGenerator
+from pyvrp import (
+    Activity,
+    Client,
+    CostEvaluator,
+    RandomNumberGenerator,
+    Shipment,
+)
 from pyvrp.search import compute_neighbours
 from pyvrp.search._search import SearchSpace, Solution
 
@@ -115,6 +122,48 @@ def test_insert_shipment(small_shipments):
     assert_equal(str(sol), """Route #1: L0 U0\nRoute #2: \n""")
 
 
+@pytest.mark.parametrize("num_dims", [2, 4, 8])
+def test_insert_shipments_multiple_load_dimensions(
+    small_shipments, num_dims: int
+):
+    """
+    Tests that inserting shipments evaluates all load dimensions, also when
+    there are more load dimensions than are stored inline. Only the last load
+    dimension has non-zero amounts, so the insertions should be the same as
+    with just that single dimension.
+    """
+
+    def insert_all(num_dims: int) -> str:
+        shipments = [
+            Shipment(
+                shipment.pickup.location,
+                shipment.delivery.location,
+                amount=[0] * (num_dims - 1) + shipment.amount,
+            )
+            for shipment in small_shipments.shipments()
+        ]
+
+        veh_type = small_shipments.vehicle_type(0)
+        capacity = [0] * (num_dims - 1) + veh_type.capacity
+        data = small_shipments.replace(
+            vehicle_types=[veh_type.replace(capacity=capacity)],
+            shipments=shipments,
+        )
+
+        sol = Solution(data)
+        search_space = SearchSpace(data, compute_neighbours(data))
+        cost_eval = CostEvaluator([100] * num_dims, 0, 0)
+
+        for pickup, delivery in sol.shipments:
+            args = (search_space, cost_eval, True)
+            assert_(sol.insert(pickup, delivery, *args))
+            pickup.route.update()
+
+        return str(sol)
+
+    assert_equal(insert_all(num_dims), insert_all(1))
+
+
 def test_insert_mixed_client_and_shipment(small_shipments):
     """
     Tests inserting a shipment and a client in a mixed instance.
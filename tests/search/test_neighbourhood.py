@@ -11,7 +11,11 @@ from pyvrp import (
     Shipment,
     VehicleType,
 )
-from pyvrp.search import NeighbourhoodParams, compute_neighbours
+from pyvrp.search import (
+    NeighbourhoodParams,
+    compute_neighbours,
+    update_neighbours,
+)
 
 
 def test_neighbourhood_params_raises_for_empty_neighbourhoods():
@@ -22,6 +26,18 @@ def test_neighbourhood_params_raises_for_empty_neighbourhoods():
         NeighbourhoodParams(num_neighbours=0)
 
 
+@mark.parametrize("spatial_oversampling", [-1.0, 0.5, 0.99])
+def test_neighbourhood_params_raises_invalid_oversampling(
+    spatial_oversampling: float,
+):
+    """
+    Tests that ``NeighbourhoodParams`` raises when the spatial over-sampling
+    factor is positive but smaller than one, or negative.
+    """
+    with assert_raises(ValueError):
+        NeighbourhoodParams(spatial_oversampling=spatial_oversampling)
+
+
 # fmt: off
 @mark.parametrize(
     (
@@ -205,6 +221,47 @@ def test_multiple_routing_profiles(ok_small):
     assert_equal(compute_neighbours(data), compute_neighbours(ok_small))
 
 
+def test_per_profile_neighbours(ok_small):
+    """
+    Tests that computing the neighbourhood for a particular profile only uses
+    the vehicle types of that profile.
+    """
+    huge_mat = np.where(np.eye(ok_small.num_locations), 0, 10_000)
+    data = ok_small.replace(
+        vehicle_types=[
+            VehicleType(1, capacity=[10], profile=1),
+            *ok_small.vehicle_types(),
+        ],
+        distance_matrices=[huge_mat, *ok_small.distance_matrices()],
+        duration_matrices=[huge_mat, *ok_small.duration_matrices()],
+    )
+
+    # Profile 1 only has the new vehicle type, which uses the huge matrix. The
+    # original vehicle types use profile 0, with the original matrices. So the
+    # neighbourhood for profile 0 should match that of the original data.
+    neighbours = compute_neighbours(data, profile=0)
+    assert_equal(neighbours, compute_neighbours(ok_small))
+
+    # Profile 1's neighbourhood is computed using the huge matrix only. That
+    # still results in a valid neighbourhood for each client.
+    neighbours = compute_neighbours(data, NeighbourhoodParams(0, 2), 1)
+    assert_equal(len(neighbours), data.num_clients)
+    for activity, neighbourhood in neighbours.items():
+        assert_equal(len(neighbourhood), 2)
+        assert_(activity not in neighbourhood)
+
+
+def test_per_profile_neighbours_raises_unknown_profile(ok_small):
+    """
+    Tests that computing the neighbourhood for a profile that does not exist
+    raises.
+    """
+    assert_equal(ok_small.num_profiles, 1)
+
+    with assert_raises(IndexError):
+        compute_neighbours(ok_small, profile=1)
+
+
 def test_zero_clients_or_shipments():
     """
     Tests that the neighbourhood for an instance with zero clients and
@@ -298,3 +355,102 @@ def test_mixed_client_shipments(small_shipments):
     # case, there is always one other client, and three other shipments. Thus,
     # a total of seven activities can be in the neighbourhood.
     assert_equal(len(neighbours[Activity("C0")]), 7)
+
+
+@mark.parametrize("instance", ["rc208", "small_shipments", "ok_small"])
+def test_spatial_neighbours_equal_dense_with_large_oversampling(
+    request,
+    instance: str,
+):
+    """
+    Tests that the spatial neighbourhood computation returns the same
+    neighbourhoods as the dense computation when the over-sampling factor is
+    large enough for all activities to be candidates.
+    """
+    data = request.getfixturevalue(instance)
+    num_activities = data.num_clients + 2 * data.num_shipments
+
+    dense = compute_neighbours(data, NeighbourhoodParams(num_neighbours=10))
+    spatial = compute_neighbours(
+        data,
+        NeighbourhoodParams(
+            num_neighbours=10,
+            spatial_oversampling=num_activities,
+        ),
+    )
+
+    assert_equal(spatial, dense)
+
+
+def test_spatial_neighbourhood_sizes(rc208):
+    """
+    Tests that the spatial neighbourhoods are of the requested size, and do
+    not contain duplicates or the activity itself, even when the number of
+    candidates is limited.
+    """
+    dense = compute_neighbours(rc208, NeighbourhoodParams(num_neighbours=10))
+    spatial = compute_neighbours(
+        rc208,
+        NeighbourhoodParams(num_neighbours=10, spatial_oversampling=3),
+    )
+
+    assert_equal(spatial.keys(), dense.keys())
+    for activity, neighbourhood in spatial.items():
+        assert_equal(len(neighbourhood), 10)
+        assert_(activity not in neighbourhood)
+        assert_equal(len(set(neighbourhood)), len(neighbourhood))
+
+
+def test_update_neighbours_equals_full_computation(rc208):
+    """
+    Tests that updating the neighbourhood after adding, modifying, and
+    removing clients results in the same neighbourhood as a full
+    recomputation on the new data.
+    """
+    params = NeighbourhoodParams(num_neighbours=10)
+    neighbours = compute_neighbours(rc208, params)
+
+    # Removes client 3, changes the location of client 10 (which becomes
+    # client 9 after removing client 3), and adds a copy of client 20 at the
+    # end.
+    clients = rc208.clients()
+    clients[10] = clients[10].replace(location=clients[40].location)
+    clients.append(clients[20])
+    del clients[3]
+
+    data = rc208.replace(clients=clients)
+    updated = update_neighbours(
+        data,
+        neighbours,
+        changed=[Activity("C9")],
+        removed=[Activity("C3")],
+        params=params,
+    )
+
+    assert_equal(updated, compute_neighbours(data, params))
+
+
+def test_update_neighbours_without_changes(rc208):
+    """
+    Tests that updating the neighbourhood without any changes returns the
+    same neighbourhood.
+    """
+    neighbours = compute_neighbours(rc208)
+    assert_equal(update_neighbours(rc208, neighbours, []), neighbours)
+
+
+def test_update_neighbours_raises_invalid_activities(ok_small):
+    """
+    Tests that updating the neighbourhood raises when depots or unknown
+    activities are passed as changed or removed activities.
+    """
+    neighbours = compute_neighbours(ok_small)
+
+    with assert_raises(ValueError):
+        update_neighbours(ok_small, neighbours, [Activity("D0")])
+
+    with assert_raises(ValueError):
+        update_neighbours(ok_small, neighbours, [], [Activity("D0")])
+
+    with assert_raises(IndexError):
+        update_neighbours(ok_small, neighbours, [Activity("C4")])
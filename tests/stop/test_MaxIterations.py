@@ -44,3 +44,32 @@ def test_after_max_iterations():
 
     for _ in range(100):
         assert_(stop(1))
+
+
+def test_infinite_max_iterations():
+    """
+    Tests that ``MaxIterations`` accepts an infinite number of iterations, in
+    which case it never stops.
+    """
+    stop = MaxIterations(float("inf"))
+
+    for _ in range(1_000):
+        assert_(not stop(1))
+
+    with assert_raises(ValueError):  # but not NaN, or negative infinity
+        MaxIterations(float("nan"))
+
+    with assert_raises(ValueError):
+        MaxIterations(-float("inf"))
+
+
+def test_fractional_max_iterations():
+    """
+    Tests that fractional maximum iterations stop once the number of
+    iterations exceeds the given maximum.
+    """
+    stop = MaxIterations(2.5)
+
+    assert_(not stop(1))
+    assert_(not stop(1))
+    assert_(stop(1))
@@ -46,3 +46,30 @@ def test_after_max_runtime(max_runtime):
 
     for _ in range(100):
         assert_(stop(1))
+
+
+@mark.parametrize("check_interval", [0, -1])
+def test_raise_invalid_check_interval(check_interval: int):
+    """
+    The clock check interval must be positive.
+    """
+    with assert_raises(ValueError):
+        MaxRuntime(1, check_interval)
+
+
+def test_check_interval():
+    """
+    Tests that ``MaxRuntime`` only reads the clock every ``check_interval``
+    calls, and keeps stopping once the maximum runtime has passed.
+    """
+    stop = MaxRuntime(0.01, check_interval=3)
+    assert_(not stop(1))  # trigger the first time measurement
+
+    sleep(0.01)
+
+    assert_(not stop(1))  # these calls do not read the clock
+    assert_(not stop(1))
+    assert_(stop(1))  # but this one does
+
+    for _ in range(100):
+        assert_(stop(1))
@@ -1,10 +1,13 @@
-from numpy.testing import assert_, assert_raises
+from copy import deepcopy
+
+from numpy.testing import assert_, assert_equal, assert_raises
 from pytest import mark
 
 from pyvrp.stop import (
     MaxIterations,
     MaxRuntime,
     MultipleCriteria,
+    NoImprovement,
 )
 from tests.helpers import sleep
 
@@ -51,3 +54,98 @@ def test_after_max_runtime(max_runtime):
 
     for _ in range(100):
         assert_(stop(1))
+
+
+def test_require_all():
+    """
+    Tests that the stopping criterion only stops when all criteria stop when
+    require_all is set, and that all criteria are evaluated on each call.
+    """
+    stop = MultipleCriteria([MaxIterations(1), MaxIterations(3)], True)
+    assert_(stop.require_all)
+
+    assert_(not stop(1))  # neither criterion stops
+    assert_(not stop(1))  # only the first criterion stops
+    assert_(not stop(1))
+    assert_(stop(1))  # now both criteria stop
+
+
+def test_operators():
+    """
+    Tests that stopping criteria can be combined using | and &.
+    """
+    either = MaxIterations(1) | MaxIterations(3)
+    assert_(isinstance(either, MultipleCriteria))
+    assert_(not either.require_all)
+    assert_(not either(1))
+    assert_(either(1))
+
+    both = MaxIterations(1) & MaxIterations(3)
+    assert_(isinstance(both, MultipleCriteria))
+    assert_(both.require_all)
+    assert_equal([both(1) for _ in range(4)], [False, False, False, True])
+
+
+def test_python_criterion():
+    """
+    Tests that Python-defined stopping criteria can be combined with native
+    criteria.
+    """
+
+    class BelowTarget:
+        def __init__(self, target: int):
+            self.target = target
+            self.num_calls = 0
+
+        def __call__(self, best_cost: int) -> bool:
+            self.num_calls += 1
+            return best_cost < self.target
+
+    below = BelowTarget(10)
+    stop = MultipleCriteria([MaxIterations(5), below])
+    assert_(stop.criteria[1] is below)
+
+    assert_(not stop(20))
+    assert_(stop(5))
+    assert_equal(below.num_calls, 2)
+
+    # This also works with the operators, and with plain functions.
+    stop = MaxIterations(5) | (lambda best_cost: best_cost < 10)
+    assert_(not stop(20))
+    assert_(stop(5))
+
+    with assert_raises(TypeError):  # but not with things that are not
+        MultipleCriteria([MaxIterations(5), 5])  # callable
+
+
+def test_deepcopy():
+    """
+    Tests that copying a stopping criterion also copies its state, and that
+    the copy is independent of the original.
+    """
+    stop = MultipleCriteria([MaxIterations(2), NoImprovement(5)])
+    assert_(not stop(1))
+
+    copied = deepcopy(stop)
+    assert_(not stop(1))
+    assert_(stop(1))  # original has now done three iterations
+
+    assert_(not copied(1))  # but the copy only two
+    assert_(copied(1))
+
+
+def test_criteria_can_be_replaced():
+    """
+    Tests that the combined criteria can be replaced, and that the replacement
+    keeps the ``require_all`` setting.
+    """
+    stop = MultipleCriteria([MaxIterations(0)], require_all=True)
+    assert_(stop(1))
+
+    stop.criteria = [MaxIterations(1), MaxIterations(2)]
+    assert_equal(len(stop.criteria), 2)
+    assert_(stop.require_all)
+    assert_equal([stop(1) for _ in range(3)], [False, False, True])
+
+    with assert_raises(ValueError):
+        stop.criteria = []
@@ -69,3 +69,26 @@ def test_n_max_iterations_with_single_improvement(n, k):
 
     for _ in range(n):
         assert_(stop(1))
+
+
+def test_infinite_max_iterations():
+    """
+    Tests that ``NoImprovement`` accepts an infinite number of non-improving
+    iterations, in which case it never stops.
+    """
+    stop = NoImprovement(float("inf"))
+
+    for _ in range(1_000):
+        assert_(not stop(1))
+
+
+def test_fractional_max_iterations():
+    """
+    Tests that fractional maximum iterations stop once the number of
+    non-improving iterations reaches the given maximum.
+    """
+    stop = NoImprovement(1.5)
+
+    assert_(not stop(1))
+    assert_(not stop(1))
+    assert_(stop(1))
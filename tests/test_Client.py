@@ -3,7 +3,7 @@ import pickle
 import pytest
 from numpy.testing import assert_, assert_equal, assert_raises
 
-from pyvrp import Client
+from pyvrp import Client, PiecewiseLinearFunction
 
 
 @pytest.mark.parametrize(
@@ -179,3 +179,39 @@ def test_client_load_dimensions_are_padded_with_zeroes(
     client = Client(0, delivery=delivery, pickup=pickup)
     assert_equal(client.delivery, exp_delivery)
     assert_equal(client.pickup, exp_pickup)
+
+
+def test_lateness_cost():
+    """
+    Tests that clients store an optional lateness cost function, and that the
+    function must be monotonically increasing.
+    """
+    assert_(Client(location=0).lateness_cost is None)
+
+    cost = PiecewiseLinearFunction([(0, 0), (10, 0), (20, 50)])
+    client = Client(location=0, lateness_cost=cost)
+    assert_equal(client.lateness_cost, cost)
+    assert_(client != Client(location=0))
+    assert_equal(pickle.loads(pickle.dumps(client)), client)
+
+    with assert_raises(ValueError):
+        decreasing = PiecewiseLinearFunction([(0, 10), (10, 0)])
+        Client(location=0, lateness_cost=decreasing)
+
+
+def test_lateness_cost_must_be_non_negative():
+    """
+    Tests that the lateness cost function may not be negative from the start
+    of the time window onwards, since service never starts before then.
+    """
+    earliness = PiecewiseLinearFunction([(0, -10), (10, 0), (20, 10)])
+
+    with assert_raises(ValueError):  # negative at tw_early = 0
+        Client(location=0, lateness_cost=earliness)
+
+    with assert_raises(ValueError):  # still negative at tw_early = 5
+        Client(location=0, tw_early=5, lateness_cost=earliness)
+
+    # But this is fine: the function is non-negative from tw_early = 10.
+    client = Client(location=0, tw_early=10, lateness_cost=earliness)
+    assert_equal(client.lateness_cost, earliness)
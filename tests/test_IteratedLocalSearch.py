@@ -10,6 +10,7 @@ from pyvrp import (
     RandomNumberGenerator,
     Result,
     Solution,
+    Statistics,
 )
 from pyvrp.search import (
     LocalSearch,
@@ -130,6 +131,28 @@ def test_ils_result_has_correct_stats(ok_small):
     assert_equal(datum.current_feas, init.is_feasible())
 
 
+def test_ils_collects_into_given_statistics(ok_small):
+    """
+    Tests that ILS collects statistics into the given statistics object, if
+    one is passed instead of a boolean.
+    """
+    params = PerturbationParams(0, 0)  # disable perturbation
+    perturbation = PerturbationManager(params)
+
+    pm = PenaltyManager(initial_penalties=([20], 6, 6))
+    rng = RandomNumberGenerator(42)
+    neighbours = compute_neighbours(ok_small)
+    ls = LocalSearch(ok_small, rng, neighbours, perturbation)
+    init = Solution.make_random(ok_small, rng)
+    ils = IteratedLocalSearch(ok_small, pm, ls, init)
+
+    stats = Statistics(sampling="every", interval=4)
+    result = ils.run(MaxIterations(10), collect_stats=stats)
+    assert_(result.stats is stats)
+    assert_equal(stats.num_iterations, 10)
+    assert_equal(stats.iterations, [1, 5, 9])
+
+
 def test_ils_acceptance_behaviour(ok_small):
     """
     Tests ILS acceptance behaviour over a fixed trajectory.
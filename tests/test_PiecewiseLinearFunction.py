@@ -1,5 +1,6 @@
 import pickle
 
+import numpy as np
 import pytest
 from numpy.testing import assert_, assert_equal, assert_raises
 
@@ -170,3 +171,78 @@ def test_pickle():
     pickled = pickle.dumps(fn)
     unpickled = pickle.loads(pickled)
     assert_equal(fn, unpickled)
+
+
+def test_call_many_breakpoints():
+    """
+    Tests calling a function with many breakpoints, which uses a different
+    search structure than functions with only a few breakpoints.
+    """
+    breakpoints = list(range(0, 500, 10))
+    segments = [(idx, 0) for idx in range(len(breakpoints) + 1)]
+    fn = PiecewiseLinearFunction(breakpoints, segments)
+
+    assert_equal(fn(-1), 0)
+    for idx, breakpoint in enumerate(breakpoints, 1):
+        assert_equal(fn(breakpoint - 1), idx - 1)
+        assert_equal(fn(breakpoint), idx)
+        assert_equal(fn(breakpoint + 9), idx)
+
+
+@pytest.mark.parametrize("num_breakpoints", [2, 50])
+def test_evaluate(num_breakpoints: int):
+    """
+    Tests that evaluating an array of points returns the same values as
+    calling the function on each point, in an array of the same shape.
+    """
+    breakpoints = list(range(0, 10 * num_breakpoints, 10))
+    segments = [(idx, idx % 3 - 1) for idx in range(num_breakpoints + 1)]
+    fn = PiecewiseLinearFunction(breakpoints, segments)
+
+    x = np.arange(-50, 10 * num_breakpoints + 50).reshape(-1, 2)
+    values = fn.evaluate(x)
+    assert_equal(values.shape, x.shape)
+    assert_equal(values, [[fn(x1), fn(x2)] for x1, x2 in x])
+
+    assert_equal(fn.evaluate([]).size, 0)
+
+
+def test_compose():
+    """
+    Tests composing two functions, including when the inner function crosses
+    the outer function's breakpoints between integers.
+    """
+    outer = PiecewiseLinearFunction([5], [(0, 1), (0, 2)])
+    inner = PiecewiseLinearFunction([0], [(0, -1), (0, 2)])
+    composed = outer.compose(inner)
+
+    for x in range(-20, 20):
+        assert_equal(composed(x), outer(inner(x)))
+
+    # The inner function is at least five for x <= -5 and x >= 3, where the
+    # outer function doubles its argument.
+    assert_equal(composed.breakpoints, [-4, 0, 3])
+    assert_equal(composed.segments, [(0, -2), (0, -1), (0, 2), (0, 4)])
+
+
+def test_minimum():
+    """
+    Tests the pointwise minimum of two functions, including when the functions
+    intersect between integers.
+    """
+    fn1 = PiecewiseLinearFunction([], [(0, 2)])
+    fn2 = PiecewiseLinearFunction([10], [(5, 0), (15, -1)])
+    minimum = fn1.minimum(fn2)
+
+    for x in range(-20, 30):
+        assert_equal(minimum(x), min(fn1(x), fn2(x)))
+
+    # The functions intersect at x = 2.5, so fn2 is the minimum from x = 3
+    # onwards. That includes the decreasing segment after x = 10.
+    assert_equal(minimum.breakpoints, [3, 10])
+    assert_equal(minimum.segments, [(0, 2), (5, 0), (15, -1)])
+
+    # The minimum is symmetric, and the minimum of a function with itself is
+    # that same function.
+    assert_equal(fn2.minimum(fn1), minimum)
+    assert_equal(fn2.minimum(fn2), fn2)
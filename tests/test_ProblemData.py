@@ -10,8 +10,10 @@ from pyvrp import (
     ClientGroup,
     Depot,
     Location,
+    PiecewiseLinearFunction,
     ProblemData,
     Shipment,
+    Solution,
     VehicleType,
 )
 
@@ -312,9 +314,10 @@ def test_matrices_are_not_copies():
     """
     The matrices returned by ``distance_matrix()`` and ``duration_matrix()``
     offer views into data owned by the underlying ``ProblemData`` instance.
-    There is no copying going on when accessing this data.
+    There is no copying going on when accessing this data, unless the matrices
+    are symmetric (see ``test_symmetric_matrices``).
     """
-    mat = np.array([[0, 0], [0, 0]])
+    mat = np.array([[0, 1], [2, 0]])
     data = ProblemData(
         locations=[Location(0, 0), Location(0, 1)],
         clients=[Client(1)],
@@ -342,6 +345,91 @@ def test_matrices_are_not_copies():
     assert_(dur1.base is dur2.base)
 
 
+def test_symmetric_matrices():
+    """
+    Tests that profiles with symmetric distance and duration matrices are
+    detected as such, and that their matrices are returned as read-only copies
+    that are equal to the original matrices.
+    """
+    sym_mat = np.array([[0, 1, 2], [1, 0, 3], [2, 3, 0]])
+    asym_mat = np.array([[0, 1, 2], [1, 0, 3], [2, 4, 0]])
+    data = ProblemData(
+        locations=[Location(0, 0), Location(0, 1), Location(1, 1)],
+        clients=[Client(1), Client(2)],
+        depots=[Depot(0)],
+        vehicle_types=[VehicleType(2), VehicleType(2, profile=1)],
+        distance_matrices=[sym_mat, sym_mat],
+        duration_matrices=[sym_mat, asym_mat],
+    )
+
+    # The first profile is symmetric. The second is not, because its duration
+    # matrix is not symmetric.
+    assert_(data.is_symmetric(profile=0))
+    assert_(not data.is_symmetric(profile=1))
+
+    for profile in range(data.num_profiles):
+        assert_equal(data.distance_matrix(profile), sym_mat)
+
+    assert_equal(data.duration_matrix(profile=0), sym_mat)
+    assert_equal(data.duration_matrix(profile=1), asym_mat)
+
+    # Symmetric matrices are stored compactly, so they are returned as copies.
+    # These copies cannot be modified, just like the views of other matrices.
+    dist_mat = data.distance_matrix(profile=0)
+    assert_(dist_mat.flags["OWNDATA"])
+
+    with assert_raises(ValueError):
+        dist_mat[0, 1] = 1_000
+
+    # Symmetric matrices should be equal to and survive a round-trip through
+    # pickle, like regular matrices do.
+    assert_equal(pickle.loads(pickle.dumps(data)), data)
+
+
+def test_submatrices():
+    """
+    Tests that ``distance_submatrix()`` and ``duration_submatrix()`` return the
+    entries of the given locations, in the given order, both for symmetric and
+    regular matrices.
+    """
+    sym_mat = np.array([[0, 1, 2], [1, 0, 3], [2, 3, 0]])
+    asym_mat = np.array([[0, 1, 2], [1, 0, 3], [2, 4, 0]])
+    data = ProblemData(
+        locations=[Location(0, 0), Location(0, 1), Location(1, 1)],
+        clients=[Client(1), Client(2)],
+        depots=[Depot(0)],
+        vehicle_types=[VehicleType(2)],
+        distance_matrices=[sym_mat],
+        duration_matrices=[asym_mat],
+    )
+
+    for locs in ([0, 1, 2], [2, 0], [1, 1]):
+        idcs = np.ix_(locs, locs)
+        assert_equal(data.distance_submatrix(0, locs), sym_mat[idcs])
+        assert_equal(data.duration_submatrix(0, locs), asym_mat[idcs])
+
+
+def test_submatrices_raise_invalid_index(ok_small):
+    """
+    Tests that ``distance_submatrix()`` and ``duration_submatrix()`` raise when
+    the profile or one of the locations is out of bounds.
+    """
+    assert_equal(ok_small.num_profiles, 1)
+    assert_equal(ok_small.num_locations, 5)
+
+    with assert_raises(IndexError):
+        ok_small.distance_submatrix(1, [0, 1])
+
+    with assert_raises(IndexError):
+        ok_small.duration_submatrix(1, [0, 1])
+
+    with assert_raises(IndexError):
+        ok_small.distance_submatrix(0, [0, 5])
+
+    with assert_raises(IndexError):
+        ok_small.duration_submatrix(0, [5])
+
+
 def test_raises_when_accessing_an_invalid_index(ok_small):
     """
     Tests that calling depot(idx), client(idx), and shipment(idx) raises when
@@ -573,6 +661,49 @@ def test_pickle_data(ok_small, rc208):
     assert_equal(pickle.loads(bytes), rc208)
 
 
+@pytest.mark.parametrize("mmap", [True, False])
+def test_save_and_load(
+    ok_small_two_profiles, small_shipments, tmp_path, mmap: bool
+):
+    """
+    Tests that problem data instances can be written to and read from a binary
+    file, both with and without memory-mapping the matrices.
+    """
+    for data in [ok_small_two_profiles, small_shipments]:
+        where = tmp_path / "data.bin"
+        data.save(where)
+
+        loaded = ProblemData.load(where, mmap=mmap)
+        assert_equal(loaded, data)
+        assert_equal(loaded.distance_matrix(1), data.distance_matrix(1))
+        assert_equal(loaded.duration_matrix(0), data.duration_matrix(0))
+
+
+def test_load_raises_invalid_files(ok_small, tmp_path):
+    """
+    Tests that loading raises when the file does not contain problem data, or
+    is truncated.
+    """
+    where = tmp_path / "data.bin"
+    where.write_bytes(b"not a PyVRP file")
+
+    with assert_raises(ValueError):
+        ProblemData.load(where)
+
+    sol = Solution(ok_small, [[0, 1], [2, 3]])
+    sol.save(where)
+
+    with assert_raises(ValueError):  # a solution, not problem data
+        ProblemData.load(where)
+
+    ok_small.save(where)
+    where.write_bytes(where.read_bytes()[:-8])
+
+    for mmap in [True, False]:
+        with assert_raises(ValueError):
+            ProblemData.load(where, mmap=mmap)
+
+
 def test_problem_data_raises_when_pickup_and_delivery_dimensions_differ():
     """
     Tests that the ``ProblemData`` constructor raises a ``ValueError`` when
@@ -730,6 +861,27 @@ def test_has_time_windows(small_cvrp, pr107, small_spd, ok_small, rc208):
     assert_(not small_spd.has_time_windows())  # is VRPSPD
 
 
+def test_has_lateness_costs(ok_small):
+    """
+    Tests that ``has_lateness_costs()`` correctly identifies whether any client
+    or shipment step has a lateness cost.
+    """
+    assert_(not ok_small.has_lateness_costs())
+
+    cost = PiecewiseLinearFunction([(0, 0), (1, 1)])
+    clients = ok_small.clients()
+    clients[0] = Client(location=1, lateness_cost=cost)
+    assert_(ok_small.replace(clients=clients).has_lateness_costs())
+
+    # Shipments without lateness costs do not count, but a lateness cost on
+    # either the pickup or delivery step does.
+    shipments = [Shipment(1, 2)]
+    assert_(not ok_small.replace(shipments=shipments).has_lateness_costs())
+
+    shipments = [Shipment(1, 2, delivery_lateness_cost=cost)]
+    assert_(ok_small.replace(shipments=shipments).has_lateness_costs())
+
+
 def test_accessors(ok_small):
     """
     Tests accessing locations, depots, and clients on the data instance.
@@ -828,3 +980,88 @@ def test_replace_shipments(ok_small):
     assert_equal(data.shipment(0), shipments[0])
     assert_equal(data.shipment(1), shipments[1])
     assert_equal(data.shipments(), shipments)
+
+
+def test_from_edges(ok_small):
+    """
+    Tests that constructing a data instance from all edges results in the
+    same instance as constructing it from the full matrices.
+    """
+    dist = ok_small.distance_matrix(0)
+    dur = ok_small.duration_matrix(0)
+    frm, to = np.nonzero(np.ones_like(dist))
+
+    data = ProblemData.from_edges(
+        ok_small.locations(),
+        ok_small.clients(),
+        ok_small.depots(),
+        ok_small.vehicle_types(),
+        [(frm, to, dist[frm, to], dur[frm, to])],
+        missing_value=100,
+    )
+
+    assert_equal(data, ok_small)
+
+
+def test_from_edges_missing_and_duplicate_edges():
+    """
+    Tests that edges that are not given are set to the missing value, except
+    on the diagonal, and that the last of a duplicate edge is used.
+    """
+    frm = np.array([0, 1, 1, 0])
+    to = np.array([1, 0, 0, 0])
+    dist = np.array([1, 2, 3, 4])
+    dur = np.array([5, 6, 7, 8])
+
+    data = ProblemData.from_edges(
+        locations=[Location(0, 0), Location(1, 1), Location(2, 2)],
+        clients=[Client(1), Client(2)],
+        depots=[Depot(0)],
+        vehicle_types=[VehicleType(profile=1)],
+        edges=[(frm, to, dist, dur), (frm[:1], to[:1], dist[:1], dur[:1])],
+        missing_value=99,
+    )
+
+    assert_equal(data.num_profiles, 2)
+
+    # First profile: the (1, 0) edge is given twice, so the last value is
+    # used. The explicitly given (0, 0) edge replaces the default of zero.
+    assert_equal(
+        data.distance_matrix(0), [[4, 1, 99], [3, 0, 99], [99, 99, 0]]
+    )
+    assert_equal(
+        data.duration_matrix(0), [[8, 5, 99], [7, 0, 99], [99, 99, 0]]
+    )
+
+    # Second profile has just the one (0, 1) edge.
+    assert_equal(
+        data.distance_matrix(1), [[0, 1, 99], [99, 0, 99], [99, 99, 0]]
+    )
+    assert_equal(
+        data.duration_matrix(1), [[0, 5, 99], [99, 0, 99], [99, 99, 0]]
+    )
+
+
+@pytest.mark.parametrize(
+    ("edges", "exception"),
+    [
+        (([0], [2], [1], [1]), IndexError),  # location 2 does not exist
+        (([2], [0], [1], [1]), IndexError),  # location 2 does not exist
+        (([0, 1], [1], [1], [1]), ValueError),  # arrays of unequal length
+        (([0], [1], [1], [1, 2]), ValueError),  # arrays of unequal length
+        (([0], [1], [1]), ValueError),  # missing duration array
+    ],
+)
+def test_from_edges_raises_invalid_edges(edges, exception):
+    """
+    Tests that constructing a data instance from invalid edges raises.
+    """
+    with assert_raises(exception):
+        ProblemData.from_edges(
+            locations=[Location(0, 0), Location(1, 1)],
+            clients=[Client(1)],
+            depots=[Depot(0)],
+            vehicle_types=[VehicleType()],
+            edges=[tuple(np.array(arr) for arr in edges)],
+            missing_value=10,
+        )
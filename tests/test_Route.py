@@ -6,8 +6,10 @@ from numpy.testing import assert_, assert_equal, assert_raises
 from pyvrp import (
     Activity,
     Client,
+    CostEvaluator,
     Depot,
     Location,
+    PiecewiseLinearFunction,
     ProblemData,
     RandomNumberGenerator,
     Route,
@@ -977,3 +979,115 @@ def test_raises_shipment_crossing_reload_depot(small_shipments):
     with assert_raises(ValueError):
         # Pickup, reload, then delivery. So the shipment crosses the depot.
         Route(data, map(Activity, ["L0", "D0", "U0"]), 0)
+
+
+def test_activities(ok_small_multiple_trips):
+    """
+    Tests that the route's activities include the start, end, and reload
+    depots, and match the activities in the route schedule.
+    """
+    data = ok_small_multiple_trips
+    route = Route(data, [Activity("C0"), Activity("D0"), Activity("C1")], 0)
+
+    activities = route.activities()
+    assert_equal(len(activities), len(route))
+    assert_equal(
+        activities,
+        [
+            Activity("D0"),
+            Activity("C0"),
+            Activity("D0"),
+            Activity("C1"),
+            Activity("D0"),
+        ],
+    )
+
+    for activity, scheduled in zip(activities, route.schedule()):
+        assert_equal(activity.type, scheduled.type)
+        assert_equal(activity.idx, scheduled.idx)
+
+
+def test_schedule_after_data_is_deleted(ok_small):
+    """
+    The route schedule is computed only when it is first needed. This test
+    checks that the route keeps the data alive until then, so the schedule is
+    still available after the data goes out of scope.
+    """
+    data = ok_small.replace()
+    route = Route(data, [1, 2], 0)
+    expected = Route(ok_small, [1, 2], 0).schedule()
+    del data
+
+    assert_equal(route.schedule(), expected)
+    assert_equal(route[1].start_time, expected[1].start_time)
+
+
+def test_lateness_cost(ok_small):
+    """
+    Tests that the lateness cost of a route evaluates the clients' lateness
+    cost functions at their service start times, and that this cost is part of
+    the solution's objective.
+    """
+    cost = PiecewiseLinearFunction([(0, 0), (15_000, 0), (16_000, 1_000)])
+    clients = ok_small.clients()
+    clients[1] = Client(
+        location=2,
+        delivery=[5],
+        service_duration=360,
+        tw_early=12_000,
+        tw_late=19_500,
+        lateness_cost=cost,
+    )
+    data = ok_small.replace(clients=clients)
+
+    route = Route(data, [1, 2], 0)
+    start = route.schedule()[2].start_time
+    assert_equal(route.lateness_cost(), cost(start))
+
+    # Routes that do not visit clients with lateness costs are not charged.
+    assert_equal(Route(data, [1, 3], 0).lateness_cost(), 0)
+
+    sol = Solution(data, [route])
+    assert_equal(sol.lateness_cost(), route.lateness_cost())
+
+    before = Solution(ok_small, [Route(ok_small, [1, 2], 0)])
+    cost_eval = CostEvaluator([0], 0, 0)
+    assert_equal(
+        cost_eval.penalised_cost(sol),
+        cost_eval.penalised_cost(before) + sol.lateness_cost(),
+    )
+
+
+def test_lateness_cost_multiple_trips(ok_small_multiple_trips):
+    """
+    Tests that the lateness cost of a multi-trip route evaluates the clients'
+    lateness cost functions at their service start times, also for clients on
+    trips after the first.
+    """
+    cost = PiecewiseLinearFunction([(0, 0), (10_000, 0), (10_001, 1)])
+    clients = [
+        Client(
+            location=client.location,
+            delivery=client.delivery,
+            pickup=client.pickup,
+            service_duration=client.service_duration,
+            tw_early=client.tw_early,
+            tw_late=client.tw_late,
+            release_time=client.release_time,
+            lateness_cost=cost,
+        )
+        for client in ok_small_multiple_trips.clients()
+    ]
+    data = ok_small_multiple_trips.replace(clients=clients)
+
+    activities = [Activity(des) for des in ["C0", "C1", "D0", "C2"]]
+    route = Route(data, activities, vehicle_type=0)
+    assert_equal(route.num_trips(), 2)
+
+    expected = sum(
+        cost(activity.start_time)
+        for activity in route.schedule()
+        if activity.is_client()
+    )
+    assert_(expected > 0)
+    assert_equal(route.lateness_cost(), expected)
@@ -4,7 +4,7 @@ import numpy as np
 import pytest
 from numpy.testing import assert_, assert_equal, assert_raises
 
-from pyvrp import Shipment, ShipmentStep
+from pyvrp import PiecewiseLinearFunction, Shipment, ShipmentStep
 
 _INT_MAX = np.iinfo(np.int64).max
 
@@ -177,3 +177,44 @@ def test_pickle():
     pickled = pickle.dumps(shipment)
     unpickled = pickle.loads(pickled)
     assert_equal(unpickled, shipment)
+
+
+def test_lateness_cost():
+    """
+    Tests that the pickup and delivery steps of a shipment store their own
+    optional lateness cost functions.
+    """
+    shipment = Shipment(0, 1)
+    assert_(shipment.pickup.lateness_cost is None)
+    assert_(shipment.delivery.lateness_cost is None)
+
+    cost = PiecewiseLinearFunction([(0, 0), (10, 0), (20, 50)])
+    shipment = Shipment(0, 1, delivery_lateness_cost=cost)
+    assert_(shipment.pickup.lateness_cost is None)
+    assert_equal(shipment.delivery.lateness_cost, cost)
+    assert_equal(pickle.loads(pickle.dumps(shipment)), shipment)
+
+    step = ShipmentStep(0, lateness_cost=cost)
+    assert_equal(step.lateness_cost, cost)
+    assert_(step != ShipmentStep(0))
+
+    with assert_raises(ValueError):
+        decreasing = PiecewiseLinearFunction([(0, 10), (10, 0)])
+        ShipmentStep(0, lateness_cost=decreasing)
+
+
+def test_lateness_cost_must_be_non_negative():
+    """
+    Tests that the lateness cost functions of shipment steps may not be
+    negative from the start of the step's time window onwards.
+    """
+    earliness = PiecewiseLinearFunction([(0, -10), (10, 0), (20, 10)])
+
+    with assert_raises(ValueError):
+        ShipmentStep(0, lateness_cost=earliness)
+
+    with assert_raises(ValueError):
+        Shipment(0, 1, pickup_lateness_cost=earliness)
+
+    step = ShipmentStep(0, tw_early=10, lateness_cost=earliness)
+    assert_equal(step.lateness_cost, earliness)
@@ -705,6 +705,26 @@ def test_solution_can_be_pickled(ok_small):
     assert_equal(after_pickle, before_pickle)
 
 
+def test_save_and_load(ok_small_multiple_trips, tmp_path):
+    """
+    Tests that a solution can be written to and read from a binary file.
+    """
+    data = ok_small_multiple_trips
+    routes = [
+        Route(data, [Activity("C0"), Activity("D0"), Activity("C1")], 0),
+        Route(data, [3], 0),
+    ]
+
+    sol = Solution(data, routes)
+    where = tmp_path / "solution.bin"
+    sol.save(where)
+
+    loaded = Solution.load(where, data)
+    assert_equal(loaded, sol)
+    assert_equal(loaded.routes(), sol.routes())
+    assert_equal(loaded.unplanned(), sol.unplanned())
+
+
 @pytest.mark.parametrize(
     ("assignment", "expected"), [((0, 0), 0), ((0, 1), 10), ((1, 1), 20)]
 )
@@ -159,3 +159,119 @@ def test_not_collecting(ok_small):
     stats.collect(sol, sol, sol, cost_eval)
 
     assert_equal(stats, Statistics(collect_stats=False))
+
+
+@pytest.mark.parametrize(
+    ("sampling", "interval"), [("unknown", 1), ("every", 0), ("every", -1)]
+)
+def test_raises_invalid_sampling(sampling, interval: int):
+    """
+    Tests that the statistics object raises when given an unknown sampling
+    strategy, or an invalid recording interval.
+    """
+    with pytest.raises(ValueError):
+        Statistics(sampling=sampling, interval=interval)
+
+
+@pytest.mark.parametrize(
+    ("sampling", "interval", "expected"),
+    [
+        ("every", 1, list(range(1, 26))),
+        ("every", 3, [1, 4, 7, 10, 13, 16, 19, 22, 25]),
+        ("log", 1, [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 20]),
+    ],
+)
+def test_sampling_records_expected_iterations(
+    ok_small,
+    sampling,
+    interval: int,
+    expected: list[int],
+):
+    """
+    Tests that the statistics object records only the iterations selected by
+    the sampling strategy, but still counts all iterations.
+    """
+    sol = Solution(ok_small, [[0, 1], [2, 3]])
+    cost_eval = CostEvaluator([20], 6, 6)
+
+    stats = Statistics(sampling=sampling, interval=interval)
+    for _ in range(25):
+        stats.collect(sol, sol, sol, cost_eval)
+
+    assert_equal(stats.num_iterations, 25)
+    assert_equal(len(stats), len(expected))
+    assert_equal(stats.iterations, expected)
+    assert_equal(len(stats.runtimes), len(expected))
+    assert_(stats.total_runtime >= sum(stats.runtimes))
+
+
+def test_improving_sampling_records_only_improvements(ok_small):
+    """
+    Tests that the improving sampling strategy records the first iteration,
+    and then only those iterations where the best solution improves.
+    """
+    worse = Solution(ok_small, [[0, 1, 2, 3]])
+    better = Solution(ok_small, [[0, 1], [2, 3]])
+    cost_eval = CostEvaluator([20], 6, 6)
+    assert_(cost_eval.penalised_cost(better) < cost_eval.penalised_cost(worse))
+
+    stats = Statistics(sampling="improving")
+    for best in [worse, worse, worse, better, better]:
+        stats.collect(worse, worse, best, cost_eval)
+
+    assert_equal(stats.num_iterations, 5)
+    assert_equal(stats.iterations, [1, 4])
+    assert_equal(stats[-1].best_cost, cost_eval.penalised_cost(better))
+
+
+def test_to_numpy_returns_read_only_columns(ok_small):
+    """
+    Tests that the numpy export contains all columns, with the recorded data,
+    and that these columns cannot be modified.
+    """
+    sol = Solution(ok_small, [[0, 1], [2, 3]])
+    cost_eval = CostEvaluator([20], 6, 6)
+    cost = cost_eval.penalised_cost(sol)
+
+    stats = Statistics()
+    for _ in range(3):
+        stats.collect(sol, sol, sol, cost_eval)
+
+    columns = stats.to_numpy()
+    assert_equal(columns["iteration"], [1, 2, 3])
+    assert_equal(columns["runtime"], stats.runtimes)
+
+    for name in ["current", "candidate", "best"]:
+        assert_equal(columns[f"{name}_cost"], [cost, cost, cost])
+        assert_equal(columns[f"{name}_feas"], [True, True, True])
+
+    for column in columns.values():
+        assert_(not column.flags.writeable)
+
+    with pytest.raises(ValueError):
+        columns["best_cost"][0] = 0
+
+
+def test_getitem(ok_small):
+    """
+    Tests that indexing the statistics object returns the recorded data points,
+    and raises when the index is out of range.
+    """
+    curr = Solution(ok_small, [[0, 1, 2, 3]])
+    best = Solution(ok_small, [[0, 1], [2, 3]])
+    cost_eval = CostEvaluator([20], 6, 6)
+
+    stats = Statistics()
+    stats.collect(curr, curr, best, cost_eval)
+    stats.collect(best, best, best, cost_eval)
+
+    assert_equal(stats[0], stats.data[0])
+    assert_equal(stats[-1], stats.data[1])
+    assert_equal(stats[0].current_cost, cost_eval.penalised_cost(curr))
+    assert_equal(stats[-1].current_cost, cost_eval.penalised_cost(best))
+
+    with pytest.raises(IndexError):
+        stats[2]
+
+    with pytest.raises(IndexError):
+        stats[-3]
@@ -0,0 +1,107 @@
+import pytest
+from numpy.testing import assert_, assert_equal, assert_raises
+
+from pyvrp import PenaltyManager, PenaltyParams, Solution
+from pyvrp.decomposition import (
+    DecompositionParams,
+    partition_routes,
+    solve_decomposed,
+)
+from pyvrp.stop import MaxIterations
+from tests.helpers import read_solution
+
+
+@pytest.mark.parametrize(
+    ("max_subproblem_size", "num_iterations", "num_threads"),
+    [
+        (0, 1, None),  # max_subproblem_size must be positive
+        (1, -1, None),  # num_iterations cannot be negative
+        (1, 1, 0),  # num_threads must be positive
+    ],
+)
+def test_params_raises_invalid_values(
+    max_subproblem_size: int,
+    num_iterations: int,
+    num_threads: int | None,
+):
+    """
+    Tests that the decomposition parameters are validated.
+    """
+    with assert_raises(ValueError):
+        DecompositionParams(max_subproblem_size, num_iterations, num_threads)
+
+
+@pytest.mark.parametrize(("size", "offset"), [(1, 0.0), (30, 0.5), (100, 0)])
+def test_partition_routes(rc208, size: int, offset: float):
+    """
+    Tests that partitioning assigns each route to exactly one group, and that
+    the groups do not exceed the maximum subproblem size, unless a group
+    consists of a single route.
+    """
+    bks = read_solution("data/RC208.sol", rc208)
+    groups = partition_routes(rc208, bks, size, offset)
+
+    routes = bks.routes()
+    indices = [idx for group in groups for idx in group]
+    assert_equal(sorted(indices), range(len(routes)))
+
+    for group in groups:
+        num_clients = sum(routes[idx].num_clients() for idx in group)
+        assert_(num_clients <= size or len(group) == 1)
+
+
+def test_partition_routes_polar_sectors(ok_small):
+    """
+    Tests that routes are grouped by the polar angle of their barycentre
+    around the depot.
+    """
+    sol = Solution(ok_small, [[1], [2], [3]])
+
+    # The routes' clients lie at roughly 0.518, 0.501, and 0.512 rotations
+    # around the depot, respectively. All three routes fit in one group when
+    # the maximum subproblem size is three.
+    assert_equal(partition_routes(ok_small, sol, 3), [[1, 2, 0]])
+    assert_equal(partition_routes(ok_small, sol, 1), [[1], [2], [0]])
+
+    # Starting the first sector at 0.505 rotations moves the route at 0.501
+    # rotations to the end.
+    assert_equal(partition_routes(ok_small, sol, 3, 0.505), [[2, 0, 1]])
+
+
+def test_solve_decomposed_zero_rounds(rc208):
+    """
+    Tests that the initial solution is returned as-is when no decomposition
+    rounds are performed.
+    """
+    bks = read_solution("data/RC208.sol", rc208)
+    res = solve_decomposed(rc208, MaxIterations(0), initial_solution=bks)
+
+    assert_equal(res.best, bks)
+    assert_equal(res.num_iterations, 0)
+
+
+@pytest.mark.parametrize("size", [1, 20, 100])
+def test_solve_decomposed_does_not_worsen(rc208, size: int):
+    """
+    Tests that decomposition rounds never worsen the best solution, and that
+    the resulting solution visits all clients.
+    """
+    routes = [list(range(10 * idx, 10 * idx + 10)) for idx in range(10)]
+    init = Solution(rc208, routes)
+
+    params = DecompositionParams(size, num_iterations=50, num_threads=2)
+    res = solve_decomposed(
+        rc208,
+        MaxIterations(2),
+        decomposition=params,
+        initial_solution=init,
+    )
+
+    assert_equal(res.num_iterations, 2)
+    assert_(res.best.is_complete())
+
+    # The decomposition compares solutions using the maximum penalties.
+    penalties = PenaltyParams().midpoint_penalties(rc208)
+    cost_eval = PenaltyManager(penalties).max_cost_evaluator()
+    new_cost = cost_eval.penalised_cost(res.best)
+    assert_(new_cost <= cost_eval.penalised_cost(init))
@@ -1,3 +1,4 @@
+import pytest
 from numpy.testing import assert_, assert_equal, assert_raises
 
 from pyvrp import minimise_fleet
@@ -5,24 +6,23 @@ from pyvrp.stop import MaxIterations
 from tests.helpers import read
 
 
-def test_raises_multiple_vehicle_types(ok_small_multi_depot):
+def test_raises_optional_clients(prize_collecting):
     """
-    Tests that ``minimise_fleet`` raises when given an instance with multiple
-    vehicle types.
+    Tests that ``minimise_fleet`` raises when given an instance with optional
+    clients. Fleet minimisation only works for complete problems.
     """
-    assert_equal(ok_small_multi_depot.num_vehicle_types, 2)
-
     with assert_raises(ValueError):
-        minimise_fleet(ok_small_multi_depot, MaxIterations(1))
+        minimise_fleet(prize_collecting, MaxIterations(1))
 
 
-def test_raises_optional_clients(prize_collecting):
+@pytest.mark.parametrize("num_threads", [0, -1])
+def test_raises_invalid_num_threads(ok_small, num_threads: int):
     """
-    Tests that ``minimise_fleet`` raises when given an instance with optional
-    clients. Fleet minimisation only works for complete problems.
+    Tests that ``minimise_fleet`` raises when the number of threads is not
+    positive.
     """
     with assert_raises(ValueError):
-        minimise_fleet(prize_collecting, MaxIterations(1))
+        minimise_fleet(ok_small, MaxIterations(1), num_threads=num_threads)
 
 
 def test_OkSmall(ok_small):
@@ -32,8 +32,8 @@ def test_OkSmall(ok_small):
     """
     assert_equal(ok_small.num_vehicles, 3)
 
-    vehicle_type = minimise_fleet(ok_small, MaxIterations(10))
-    data = ok_small.replace(vehicle_types=[vehicle_type])
+    fleet = minimise_fleet(ok_small, MaxIterations(10))
+    data = ok_small.replace(vehicle_types=fleet)
     assert_equal(data.num_vehicles, 2)
 
 
@@ -47,8 +47,9 @@ def test_OkSmall_multidimensional_load(ok_small_multiple_load):
 
     # Need at least three because the client demand in the second dimension
     # sums to 5, yet each vehicle can only carry 2.
-    vehicle_type = minimise_fleet(ok_small_multiple_load, MaxIterations(10))
-    assert_equal(vehicle_type.num_available, 3)
+    fleet = minimise_fleet(ok_small_multiple_load, MaxIterations(10))
+    assert_equal(len(fleet), 1)
+    assert_equal(fleet[0].num_available, 3)
 
 
 def test_rc208(rc208):
@@ -58,21 +59,23 @@ def test_rc208(rc208):
     """
     assert_equal(rc208.num_vehicles, 25)
 
-    vehicle_type = minimise_fleet(rc208, MaxIterations(3), seed=1)
-    data = rc208.replace(vehicle_types=[vehicle_type])
+    fleet = minimise_fleet(rc208, MaxIterations(3), seed=1)
+    data = rc208.replace(vehicle_types=fleet)
     assert_(data.num_vehicles < rc208.num_vehicles)
 
 
-def test_X_instance():
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_X_instance(num_threads: int):
     """
     Tests that the fleet minimisation procedure attains the lower bound on this
-    particular X instance.
+    particular X instance, also when attempting multiple fleet sizes in
+    parallel.
     """
     data = read("data/X-n101-50-k13.vrp", round_func="round")
     assert_equal(data.num_vehicles, 100)
 
-    vehicle_type = minimise_fleet(data, MaxIterations(10))
-    data = data.replace(vehicle_types=[vehicle_type])
+    fleet = minimise_fleet(data, MaxIterations(10), num_threads=num_threads)
+    data = data.replace(vehicle_types=fleet)
     assert_equal(data.num_vehicles, 13)
 
 
@@ -86,5 +89,30 @@ def test_lower_bound_multi_trip_instance(ok_small_multiple_trips):
 
     # The vehicle capacity is insufficient to visit every client in a single
     # trip, but this problem can be solved in a single route, as 3 4 | 1 2.
-    vehicle_type = minimise_fleet(data, MaxIterations(10))
-    assert_equal(vehicle_type.num_available, 1)
+    fleet = minimise_fleet(data, MaxIterations(10))
+    assert_equal(len(fleet), 1)
+    assert_equal(fleet[0].num_available, 1)
+
+
+def test_multiple_vehicle_types(ok_small_multi_depot):
+    """
+    Tests that the fleet minimisation procedure supports instances with
+    multiple vehicle types, and returns a smaller fleet made up of the given
+    vehicle types.
+    """
+    assert_equal(ok_small_multi_depot.num_vehicle_types, 2)
+    assert_equal(ok_small_multi_depot.num_vehicles, 3)
+
+    fleet = minimise_fleet(ok_small_multi_depot, MaxIterations(10))
+    data = ok_small_multi_depot.replace(vehicle_types=fleet)
+    assert_(data.num_vehicles < ok_small_multi_depot.num_vehicles)
+
+    # Each vehicle type in the returned fleet should be one of the original
+    # vehicle types, with possibly fewer vehicles available.
+    for veh_type in fleet:
+        assert_(
+            any(
+                veh_type == orig.replace(num_available=veh_type.num_available)
+                for orig in ok_small_multi_depot.vehicle_types()
+            )
+        )
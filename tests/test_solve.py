@@ -6,12 +6,16 @@ from pyvrp.IteratedLocalSearch import IteratedLocalSearchParams
 from pyvrp.PenaltyManager import PenaltyParams
 from pyvrp.search import (
     OPERATORS,
+    GeneticAlgorithmParams,
     NeighbourhoodParams,
+    OperatorSelectionParams,
     PerturbationParams,
+    RecreateMethod,
     Relocate1,
+    RuinMethod,
     SwapTails,
 )
-from pyvrp.solve import SolveParams, solve
+from pyvrp.solve import SolveParams, solve, solve_many
 from pyvrp.stop import MaxIterations
 from tests.helpers import DATA_DIR, read_solution
 
@@ -28,6 +32,8 @@ def test_default_values():
     assert_equal(params.operators, OPERATORS)
     assert_allclose(params.display_interval, 5.0)
     assert_equal(params.perturbation, PerturbationParams())
+    assert_equal(params.selection, OperatorSelectionParams())
+    assert_(params.genetic is None)
 
 
 def test_solve_params_from_file():
@@ -40,7 +46,11 @@ def test_solve_params_from_file():
     penalty = PenaltyParams(100, 1.25, 0.85, 0.43)
     neighbourhood = NeighbourhoodParams(0, 20, True)
     operators = [Relocate1, SwapTails]
-    perturbation = PerturbationParams(1, 10)
+    perturbation = PerturbationParams(
+        1, 10, RuinMethod.STRINGS, RecreateMethod.REGRET
+    )
+    selection = OperatorSelectionParams(True, 0.5, 0.2)
+    genetic = GeneticAlgorithmParams(10, 20, num_threads=2)
 
     assert_equal(params.ils, ils)
     assert_equal(params.penalty, penalty)
@@ -48,6 +58,8 @@ def test_solve_params_from_file():
     assert_equal(params.operators, operators)
     assert_allclose(params.display_interval, 10.0)
     assert_equal(params.perturbation, perturbation)
+    assert_equal(params.selection, selection)
+    assert_equal(params.genetic, genetic)
 
 
 def test_solve_params_from_file_defaults():
@@ -139,3 +151,38 @@ def test_solve_optional_shipments(small_optional_shipments):
     # be the sole planned shipment).
     assert_(Activity("L0") not in res.best.unplanned())
     assert_(Activity("U0") not in res.best.unplanned())
+
+
+def test_solve_many(ok_small):
+    """
+    Tests that solving with multiple seeds in parallel returns one result per
+    seed, each equal to the result of solving with just that seed.
+    """
+    seeds = [0, 1, 2, 0]
+    results = solve_many(ok_small, MaxIterations(10), seeds, num_threads=2)
+    assert_equal(len(results), len(seeds))
+
+    for seed, res in zip(seeds, results):
+        expected = solve(ok_small, stop=MaxIterations(10), seed=seed)
+        assert_equal(res.best, expected.best)
+        assert_equal(res.num_iterations, expected.num_iterations)
+
+    # The runs with the same seed should have followed the same trajectory.
+    assert_equal(results[0].stats.data, results[3].stats.data)
+
+
+def test_solve_genetic(rc208):
+    """
+    Tests that the solver uses the genetic algorithm when genetic algorithm
+    parameters are provided, and that it returns a feasible solution that is
+    reproducible for a fixed seed, also when using multiple threads.
+    """
+    genetic = GeneticAlgorithmParams(min_pop_size=5, num_threads=2)
+    params = SolveParams(genetic=genetic)
+
+    res1 = solve(rc208, stop=MaxIterations(10), seed=1, params=params)
+    res2 = solve(rc208, stop=MaxIterations(10), seed=1, params=params)
+
+    assert_equal(res1.num_iterations, 10)
+    assert_(res1.best.is_feasible())
+    assert_equal(res1.best, res2.best)